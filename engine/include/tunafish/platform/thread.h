@@ -0,0 +1,60 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include "tunafish/core/export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Forward declarations
+typedef struct TF_Thread TF_Thread;
+typedef struct TF_Mutex TF_Mutex;
+typedef struct TF_Condition TF_Condition;
+
+typedef void (*TF_ThreadFunction)(void *user_data);
+
+// Thread API
+TF_API TF_Thread *tf_thread_create(TF_ThreadFunction function, void *user_data);
+
+// Wait for the thread to return and free it
+TF_API void tf_thread_join(TF_Thread *thread);
+
+// Logical processors available to the process (at least 1)
+TF_API u32 tf_thread_get_cpu_count(void);
+
+TF_API void tf_thread_yield(void);
+
+// Mutex API
+TF_API TF_Mutex *tf_mutex_create(void);
+
+TF_API void tf_mutex_destroy(TF_Mutex *mutex);
+
+TF_API void tf_mutex_lock(TF_Mutex *mutex);
+
+TF_API void tf_mutex_unlock(TF_Mutex *mutex);
+
+// Condition variable API (wait atomically releases and re-acquires mutex)
+TF_API TF_Condition *tf_condition_create(void);
+
+TF_API void tf_condition_destroy(TF_Condition *condition);
+
+TF_API void tf_condition_wait(TF_Condition *condition, TF_Mutex *mutex);
+
+TF_API void tf_condition_signal(TF_Condition *condition);
+
+TF_API void tf_condition_broadcast(TF_Condition *condition);
+
+// Atomics (sequentially consistent); return the value before the operation
+TF_API u32 tf_atomic_add_u32(volatile u32 *value, u32 amount);
+
+TF_API u32 tf_atomic_load_u32(const volatile u32 *value);
+
+TF_API void tf_atomic_store_u32(volatile u32 *value, u32 new_value);
+
+#ifdef __cplusplus
+}
+#endif
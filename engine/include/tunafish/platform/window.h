@@ -21,8 +21,12 @@ typedef struct {
     u32 height;
     b32 resizable;
     b32 fullscreen;
+    b32 headless; // Offscreen GL context with no visible window; renderers draw into an FBO
 } TF_WindowConfig;
 
+// Generic GL entry point, as returned by tf_window_get_proc_address
+typedef void (*TF_ProcAddress)(void);
+
 // Window API
 TF_API TF_Window *tf_window_create(const TF_WindowConfig *config);
 
@@ -32,12 +36,36 @@ TF_API b32 tf_window_should_close(TF_Window *window);
 
 TF_API void tf_window_poll_events(TF_Window *window);
 
+// Does nothing while a renderer presents to the window from end_frame
 TF_API void tf_window_swap_buffers(TF_Window *window);
 
+// Refreshes swap_buffers waits for (0 = none) on the thread the context is
+// current on. A negative interval asks for adaptive vsync, where late frames
+// are swapped at once; it returns TF_FALSE, changing nothing, when the driver
+// does not support it. Headless windows have nothing to pace.
+TF_API b32 tf_window_set_swap_interval(TF_Window *window, i32 interval);
+
 TF_API void tf_window_get_size(TF_Window *window, u32 *width, u32 *height);
 
 TF_API void tf_window_set_title(TF_Window *window, const char *title);
 
+// Headless windows have no default framebuffer to present; swap_buffers is a no-op
+TF_API b32 tf_window_is_headless(TF_Window *window);
+
+// A window's GL context is current on one thread at a time; windows start
+// with it current on the thread that created them. Release it before making
+// it current on another thread.
+TF_API b32 tf_window_make_context_current(TF_Window *window);
+
+TF_API void tf_window_release_context(TF_Window *window);
+
+// Looks up a GL function for the context current on this thread, whether it
+// belongs to a GLFW window or an offscreen EGL context
+TF_API TF_ProcAddress tf_window_get_proc_address(const char *name);
+
+// Whether a GL context, a window's or an offscreen one, is current on this thread
+TF_API b32 tf_window_has_current_context(void);
+
 // Internal API for input system
 TF_API struct GLFWwindow *tf_window_get_glfw_window(TF_Window *window);
 
@@ -0,0 +1,49 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/renderer/backend/renderer_backend.h"
+#include "tunafish/core/math.h"
+#include "tunafish/core/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bytes the OpenGL backend streams per immediate triangle (3 x position + color)
+#define TF_NULL_TRIANGLE_BYTES (3 * 7 * sizeof(f32))
+
+// Null-specific data: the recorder keeps the state a real backend would,
+// so it can tell state changes from redundant calls
+typedef struct {
+    // Immediate triangles since the last implicit batch flush
+    u32 pending_triangles;
+
+    // Meshes marked resident, detached again on destroy
+    TF_Mesh **meshes;
+    u32 mesh_count;
+    u32 mesh_capacity;
+
+    // Ids of meshes already resident in another renderer, warned about once each
+    u32 *foreign_mesh_ids;
+    u32 foreign_count;
+    u32 foreign_capacity;
+
+    // Statistics for the current frame
+    TF_RendererStats stats;
+
+    // Recorded state
+    b32 has_camera;
+    TF_CameraUniforms camera;
+    i32 viewport_x, viewport_y;
+    u32 viewport_width, viewport_height;
+    TF_Color clear_color;
+} TF_NullData;
+
+// Null backend creation
+TF_RendererBackend *tf_renderer_backend_create_null(void);
+
+#ifdef __cplusplus
+}
+#endif
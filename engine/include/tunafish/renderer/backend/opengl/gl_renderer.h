@@ -5,23 +5,117 @@
 
 #include "tunafish/renderer/backend/renderer_backend.h"
 #include "tunafish/renderer/shader.h"
+#include "tunafish/renderer/shader_variant.h"
 #include "tunafish/core/types.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Forward declarations
+typedef struct TF_GLStreamBuffer TF_GLStreamBuffer;
+typedef struct TF_GLStateCache TF_GLStateCache;
+typedef struct TF_GLPipeline TF_GLPipeline;
+typedef struct TF_GLMesh TF_GLMesh;
+typedef struct TF_GLVertexArrayCache TF_GLVertexArrayCache;
+typedef struct TF_GLGeometryArena TF_GLGeometryArena;
+typedef struct TF_GLReadback TF_GLReadback;
+typedef struct TF_GLTimer TF_GLTimer;
+typedef struct TF_GLFramePacer TF_GLFramePacer;
+typedef struct TF_Window TF_Window;
+
+// Streaming defaults
+#define TF_OPENGL_STREAM_REGION_SIZE TF_MEGABYTES(4) // Per-frame region of the streaming ring
+
+// Triangle batching defaults
+#define TF_OPENGL_TRIANGLE_VERTEX_FLOATS 7     // position (3) + color (4)
+#define TF_OPENGL_TRIANGLE_FLOATS (3 * TF_OPENGL_TRIANGLE_VERTEX_FLOATS)
+#define TF_OPENGL_DEFAULT_TRIANGLE_BATCH 16384 // Triangles per batch before an implicit flush
+#define TF_OPENGL_MAX_INSTANCES_PER_DRAW 16384 // Larger instanced draws are split (1 MB of instance data each)
+
+// Geometry arena defaults (one arena per vertex layout, grown on demand)
+#define TF_OPENGL_ARENA_VERTICES 65536
+#define TF_OPENGL_ARENA_INDICES (3 * TF_OPENGL_ARENA_VERTICES)
+#define TF_OPENGL_ARENA_DEFRAG_RANGES 64 // Free ranges tolerated before an end-of-frame defragment
+
 // OpenGL-specific data
 typedef struct {
-    // Triangle rendering
+    // Shadow copy of GL state, filters redundant binds and enables
+    TF_GLStateCache *state;
+
+    // Per-frame streaming ring shared by every upload path
+    TF_GLStreamBuffer *stream;
+    u32 uniform_buffer_alignment; // GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+
+    // Triangle rendering (vertices are sourced from the stream buffer)
     u32 triangle_vao;
-    u32 triangle_vbo;
     TF_Shader *triangle_shader;
+    TF_GLPipeline *triangle_pipeline;
+
+    // Drawn in place of shaders that are still compiling
+    TF_Shader *fallback_shader;
+
+    // Built-in shader template (triangle and fallback are variants of it)
+    TF_ShaderTemplate *unlit_template;
+
+    // Triangle batch (CPU staging, flushed in as few draws as possible)
+    f32 *triangle_vertices;
+    u32 triangle_count;
+    u32 triangle_capacity;
+
+    // Mesh rendering (meshes are uploaded on first draw)
+    TF_Shader *mesh_shader;              // Flat color, for layouts without vertex colors
+    TF_Shader *mesh_vertex_color_shader; // For layouts with a color attribute
+    TF_GLPipeline *mesh_pipeline;
+    TF_GLPipeline *mesh_vertex_color_pipeline;
+    TF_GLVertexArrayCache *vertex_arrays;
+    TF_GLMesh **meshes;
+    u32 mesh_count;
+    u32 mesh_capacity;
+
+    // Small meshes share per-layout buffers so they can be multi-drawn
+    TF_GLGeometryArena **arenas;
+    u32 arena_count;
+    u32 arena_capacity;
+
+    // glMultiDrawElementsBaseVertex parameters
+    i32 *multi_draw_counts;
+    const void **multi_draw_offsets;
+    i32 *multi_draw_base_vertices;
+    u32 multi_draw_capacity;
+
+    // Render target for headless windows, which have no default framebuffer
+    // to draw into (0 when rendering to a window)
+    u32 offscreen_framebuffer;
+    u32 offscreen_color;
+    u32 offscreen_depth;
+
+    // Asynchronous capture of the full framebuffer (size fixed at creation)
+    TF_GLReadback *readback;
+    u32 framebuffer_width, framebuffer_height;
+
+    // Timestamp queries around frames and labelled passes (NULL without a
+    // timestamp counter)
+    TF_GLTimer *timer;
+
+    // Presents to window (NULL or headless = nothing to swap) and keeps the
+    // CPU within max_frames_in_flight of the GPU
+    TF_Window *window;
+    TF_GLFramePacer *pacer;
+
+    // Every GL call is counted by the debug layer (debug builds only)
+    b32 api_debug;
+
+    // Statistics for the current frame
+    TF_RendererStats stats;
 
     // Viewport state
     i32 viewport_x, viewport_y;
     u32 viewport_width, viewport_height;
 
+    // TF_FrameData contents, uploaded at begin_frame and again on viewport changes
+    TF_FrameUniforms frame_uniforms;
+
     // Clear state
     TF_Color clear_color;
 } TF_OpenGLData;
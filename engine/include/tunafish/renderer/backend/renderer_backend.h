@@ -4,6 +4,8 @@
 #pragma once
 
 #include "tunafish/renderer/renderer_types.h"
+#include "tunafish/renderer/renderer.h"
+#include "tunafish/renderer/shader.h"
 #include "tunafish/core/math.h"
 
 #ifdef __cplusplus
@@ -16,10 +18,19 @@ typedef struct TF_Window TF_Window;
 typedef struct TF_Camera TF_Camera;
 typedef struct TF_Mesh TF_Mesh;
 
+// One mesh drawn instance_count times (instances and ranges stay valid for the call)
+typedef struct {
+    TF_Mesh *mesh;
+    const TF_InstanceData *instances;
+    u32 instance_count;
+    const TF_IndexRange *ranges; // Parts of the index buffer to draw, e.g. visible clusters
+    u32 range_count;             // 0 = the whole mesh
+} TF_MeshDraw;
+
 // Backend function pointers (vtable)
 typedef struct {
     // Lifecycle
-    b32 (*create)(TF_RendererBackend *backend, TF_Window *window);
+    b32 (*create)(TF_RendererBackend *backend, TF_Window *window, const TF_RendererConfig *config);
 
     void (*destroy)(TF_RendererBackend *backend);
 
@@ -28,6 +39,9 @@ typedef struct {
 
     void (*end_frame)(TF_RendererBackend *backend);
 
+    // Show the finished frame (optional); called after end_frame and any readback of it
+    void (*present)(TF_RendererBackend *backend);
+
     void (*clear)(TF_RendererBackend *backend, TF_ClearFlags flags);
 
     // State management
@@ -35,8 +49,43 @@ typedef struct {
 
     void (*set_viewport)(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height);
 
+    // Per-camera shader data, uploaded once and shared by every draw that follows
+    void (*set_camera)(TF_RendererBackend *backend, const TF_CameraUniforms *camera);
+
     // Drawing
     void (*draw_triangle)(TF_RendererBackend *backend, TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3, TF_Color color);
+
+    // A run of mesh draws in submission order; backends may merge compatible ones
+    void (*draw_meshes)(TF_RendererBackend *backend, const TF_MeshDraw *draws, u32 count);
+
+    // Resources (called when a mesh the backend uploaded is destroyed)
+    void (*release_mesh)(TF_RendererBackend *backend, TF_Mesh *mesh);
+
+    // Readback of the current framebuffer (RGBA8, bottom-up rows)
+    b32 (*read_pixels)(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height, void *pixels);
+
+    // Asynchronous readback of the whole framebuffer (optional). readback_begin
+    // queues a copy of what has been rendered so far and returns a nonzero
+    // ticket plus the frame size; readback_end copies the pixels out once they
+    // have landed, returning TF_FALSE while still in flight unless wait is set.
+    // pixels may be NULL to drop a readback, freeing its ticket without a copy.
+    u32 (*readback_begin)(TF_RendererBackend *backend, u32 *width, u32 *height);
+
+    b32 (*readback_end)(TF_RendererBackend *backend, u32 ticket, void *pixels, b32 wait);
+
+    // GPU timing of labelled passes (optional). Passes nest and may span
+    // several draw runs; results are reported through get_gpu_timings.
+    void (*begin_pass)(TF_RendererBackend *backend, const char *name);
+
+    void (*end_pass)(TF_RendererBackend *backend);
+
+    b32 (*get_gpu_timings)(TF_RendererBackend *backend, TF_GPUTimings *timings);
+
+    // Statistics
+    TF_RendererStats (*get_stats)(TF_RendererBackend *backend);
+
+    // Per-entry-point API call counts, most called first (optional)
+    u32 (*get_api_calls)(TF_RendererBackend *backend, TF_APICallCount *calls, u32 max_calls);
 } TF_RendererBackendVTable;
 
 // Backend base structure
@@ -48,6 +97,10 @@ struct TF_RendererBackend {
 // Backend creation functions
 TF_RendererBackend *tf_renderer_backend_create_opengl(void);
 
+TF_RendererBackend *tf_renderer_backend_create_software(void);
+
+TF_RendererBackend *tf_renderer_backend_create_null(void);
+
 #ifdef __cplusplus
 }
 #endif
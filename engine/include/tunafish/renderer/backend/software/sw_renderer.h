@@ -0,0 +1,85 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/renderer/backend/renderer_backend.h"
+#include "tunafish/core/math.h"
+#include "tunafish/core/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Forward declarations
+typedef struct TF_SWFramebuffer TF_SWFramebuffer;
+typedef struct TF_SWWorkers TF_SWWorkers;
+typedef struct TF_SWTriangle TF_SWTriangle;
+
+// Rasterizer defaults
+#define TF_SOFTWARE_MAX_WORKER_THREADS 15       // Cap for the automatic thread count
+#define TF_SOFTWARE_MAX_BINNED_TRIANGLES 65536  // Triangles binned before an implicit raster pass
+#define TF_SOFTWARE_READBACK_SLOTS 3            // Captured frames waiting to be collected
+
+// Per-tile list of binned triangle indices, in submission order
+typedef struct {
+    u32 *triangles;
+    u32 count;
+    u32 capacity;
+} TF_SWTileBin;
+
+// Post-transform vertex of the mesh being drawn
+typedef struct {
+    TF_Vec4 clip;
+    TF_Color color;
+} TF_SWVertex;
+
+// Software-specific data
+typedef struct {
+    // Render target in system memory (no window is needed)
+    TF_SWFramebuffer *framebuffer;
+
+    // Binned work for the next raster pass; each tile is rasterized by one
+    // worker, in order, so draws never race within a tile
+    TF_SWTriangle *triangles;
+    u32 triangle_count;
+    u32 triangle_capacity;
+    TF_SWTileBin *bins;
+    u32 tiles_x, tiles_y;
+    u32 *active_tiles;
+    TF_SWWorkers *workers;
+
+    // Clears are deferred into the next raster pass (TF_ClearFlags)
+    u32 pending_clear;
+    u32 pending_clear_color;
+
+    // Vertex processing scratch
+    TF_SWVertex *vertices;
+    u32 vertex_capacity;
+
+    // Pipeline state
+    TF_Mat4 view_projection;
+    b32 depth_test;
+
+    // Frames copied by readback_begin, handed out by readback_end
+    u32 *readback_pixels[TF_SOFTWARE_READBACK_SLOTS];
+    u32 readback_tickets[TF_SOFTWARE_READBACK_SLOTS]; // 0 when the slot is free
+    u32 readback_next_ticket;
+
+    // Statistics for the current frame
+    TF_RendererStats stats;
+
+    // Viewport state
+    i32 viewport_x, viewport_y;
+    u32 viewport_width, viewport_height;
+
+    // Clear state
+    TF_Color clear_color;
+} TF_SoftwareData;
+
+// Software backend creation
+TF_RendererBackend *tf_renderer_backend_create_software(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,87 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/renderer/backend/renderer_backend.h"
+#include "tunafish/core/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Forward declarations
+typedef struct TF_Thread TF_Thread;
+typedef struct TF_Mutex TF_Mutex;
+typedef struct TF_Condition TF_Condition;
+
+// Packets the recording thread may queue ahead of the render thread. Each
+// frame normally takes one, so this bounds how many frames it runs ahead.
+#define TF_THREADED_PACKETS 2
+
+// Backend calls encoded for the render thread, replayed in order
+typedef struct {
+    u8 *data;
+    u32 size;
+    u32 capacity;
+} TF_ThreadedPacket;
+
+// Threaded backend: wraps another backend and runs it on a dedicated render
+// thread, which owns the window's GL context and presents each frame. Calls
+// made by the renderer are encoded, with copies of their data, into packets
+// handed over through a single-producer/single-consumer ring: the recording
+// thread only writes the head and the render thread only writes the tail, so
+// neither takes a lock to pass work. They sleep on a condition only when the
+// ring is empty or full.
+//
+// Calls that return something from the GPU side (read_pixels, readbacks, API
+// call counts, mesh releases) wait for the render thread to catch up. Stats
+// and GPU timings are published by the render thread after every frame
+// instead, so reading them does not.
+typedef struct {
+    TF_RendererBackend backend; // Handed to the renderer, and to the wrapped backend's functions
+    TF_RendererBackendVTable vtable;
+    const TF_RendererBackendVTable *target; // Wrapped backend's functions
+    TF_Window *window;
+    b32 owns_context;
+
+    // Ring of packets; head and tail count packets published and completed
+    TF_ThreadedPacket packets[TF_THREADED_PACKETS];
+    volatile u32 head;
+    volatile u32 tail;
+    b32 recording; // Packet head is open for encoding
+
+    // Blocking calls issued (recording thread) and completed (render thread)
+    u32 calls_issued;
+    volatile u32 calls_completed;
+
+    // Frames handed over (recording thread) and presented (render thread);
+    // present waits while more than max_frames_in_flight are outstanding
+    u32 frames_submitted;
+    volatile u32 frames_presented;
+    u32 max_frames_in_flight;
+
+    TF_Thread *thread;
+    TF_Mutex *mutex;
+    TF_Condition *work;     // Signalled when a packet is published
+    TF_Condition *progress; // Signalled when a packet or call completes
+    b32 running;            // Render thread only
+    f32 queue_delay_ms;     // Render thread: how long the current frame was queued before it began
+
+    // Latest results, published after every frame (guarded by mutex)
+    TF_RendererStats stats;
+    TF_GPUTimings gpu_timings;
+    b32 has_gpu_timings;
+
+    // Meshes drawn through this backend (recording thread only)
+    TF_Mesh **meshes;
+    u32 mesh_count;
+    u32 mesh_capacity;
+} TF_ThreadedData;
+
+// Takes ownership of backend; NULL on failure (backend is then freed too)
+TF_RendererBackend *tf_renderer_backend_create_threaded(TF_RendererBackend *backend);
+
+#ifdef __cplusplus
+}
+#endif
@@ -6,6 +6,7 @@
 #include "tunafish/core/types.h"
 #include "tunafish/core/export.h"
 #include "tunafish/core/math.h"
+#include "tunafish/renderer/frustum.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,6 +30,11 @@ TF_API TF_Mat4 tf_camera_get_view_matrix(const TF_Camera *camera);
 
 TF_API TF_Mat4 tf_camera_get_projection_matrix(const TF_Camera *camera);
 
+TF_API TF_Vec3 tf_camera_get_position(const TF_Camera *camera);
+
+// World-space view volume, kept up to date as the camera moves
+TF_API TF_Frustum tf_camera_get_frustum(const TF_Camera *camera);
+
 #ifdef __cplusplus
 }
 #endif
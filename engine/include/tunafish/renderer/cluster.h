@@ -0,0 +1,50 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include "tunafish/core/export.h"
+#include "tunafish/core/math.h"
+#include "tunafish/renderer/renderer_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Forward declarations
+typedef struct TF_Camera TF_Camera;
+typedef struct TF_Mesh TF_Mesh;
+typedef struct TF_ClusterCuller TF_ClusterCuller;
+
+// =============================================================================
+// Cluster culler - per-cluster culling on worker threads
+// =============================================================================
+
+// Meshes split with tf_mesh_build_clusters are culled cluster by cluster as
+// they are drawn, on the recording thread. A culler spreads the clusters of
+// large meshes over worker threads instead; hand one to the renderer or a
+// command list. A culler serves one thread at a time, so each command list
+// recording in parallel needs its own.
+
+#define TF_CLUSTER_CULLER_MAX_WORKER_THREADS 7 // Cap for the automatic thread count
+
+typedef struct {
+    u32 worker_threads; // Threads besides the caller (0 = one per extra core, capped)
+} TF_ClusterCullerConfig;
+
+// config may be NULL for the defaults
+TF_API TF_ClusterCuller *tf_cluster_culler_create(const TF_ClusterCullerConfig *config);
+
+TF_API void tf_cluster_culler_destroy(TF_ClusterCuller *culler);
+
+// Cull the clusters of mesh, placed by transform, for camera. Writes the index
+// ranges left to draw, adjacent clusters merged, to ranges (room for one per
+// cluster) and returns how many. culler may be NULL to cull on the calling
+// thread. A mesh without clusters comes back as one range.
+TF_API u32 tf_cluster_culler_cull(TF_ClusterCuller *culler, const TF_Mesh *mesh, TF_Mat4 transform,
+                                  const TF_Camera *camera, TF_IndexRange *ranges);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,85 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include "tunafish/core/export.h"
+#include "tunafish/core/math.h"
+#include "tunafish/renderer/renderer_types.h"
+#include "tunafish/renderer/frustum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Forward declarations
+typedef struct TF_CommandList TF_CommandList;
+typedef struct TF_Renderer TF_Renderer;
+typedef struct TF_Camera TF_Camera;
+typedef struct TF_Mesh TF_Mesh;
+typedef struct TF_Material TF_Material;
+typedef struct TF_OcclusionBuffer TF_OcclusionBuffer;
+typedef struct TF_ClusterCuller TF_ClusterCuller;
+
+// Command lists record draws away from the renderer, so several threads can
+// record at once (e.g. one list per worker during culling or scene
+// traversal). A list is used by one thread at a time and owns its storage,
+// which is kept from frame to frame: recording never locks and, once the
+// lists have grown to their working size, never allocates.
+//
+// Submitting appends the lists to the renderer's commands in array order.
+// Recorded draws are sorted like any others, and ties keep submission order,
+// so the frame comes out the same however the recording was scheduled.
+
+TF_API TF_CommandList *tf_command_list_create(void);
+
+TF_API void tf_command_list_destroy(TF_CommandList *list);
+
+// Start recording, dropping what the list held. camera provides the view used
+// to sort draws by depth and cull them (NULL = unsorted, nothing culled); its
+// transform is read here, so it should be set up for the frame first. Layer
+// and material reset to defaults.
+TF_API void tf_command_list_begin(TF_CommandList *list, TF_Camera *camera);
+
+// Also cull mesh instances hidden in occlusion, which must be rasterized for
+// the begin camera before recording starts (NULL = off). Kept across begins.
+// Several lists may share one buffer, since tests only read it.
+TF_API void tf_command_list_set_occlusion(TF_CommandList *list, const TF_OcclusionBuffer *occlusion);
+
+// Cull the clusters of clustered meshes on culler's worker threads (NULL = on
+// the recording thread). Kept across begins. A culler serves one list at a
+// time, so lists recording in parallel need one each.
+TF_API void tf_command_list_set_cluster_culler(TF_CommandList *list, TF_ClusterCuller *culler);
+
+// Cull the draws that follow against frustum instead of the begin camera's
+// (NULL = the camera's again), e.g. per visible portal cell. Without a begin
+// camera nothing is culled regardless. Reset by begin.
+TF_API void tf_command_list_set_frustum(TF_CommandList *list, const TF_Frustum *frustum);
+
+TF_API void tf_command_list_set_layer(TF_CommandList *list, u8 layer);
+
+TF_API void tf_command_list_set_material(TF_CommandList *list, TF_Material *material);
+
+// Same as the tf_renderer_draw_* equivalents
+TF_API void tf_command_list_draw_triangle(TF_CommandList *list, TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3, TF_Color color);
+
+TF_API void tf_command_list_draw_mesh(TF_CommandList *list, TF_Mesh *mesh, TF_Mat4 transform);
+
+TF_API void tf_command_list_draw_mesh_instanced(TF_CommandList *list, TF_Mesh *mesh, const TF_Mat4 *transforms,
+                                                const TF_Color *colors, u32 count);
+
+TF_API void tf_command_list_draw_mesh_instances(TF_CommandList *list, TF_Mesh *mesh, const TF_InstanceData *instances,
+                                                u32 count);
+
+// Draws recorded since begin
+TF_API u32 tf_command_list_get_command_count(const TF_CommandList *list);
+
+// Append the lists' draws, in array order, after those recorded on the
+// renderer so far. Call from the renderer's thread once recording has
+// finished; the lists are left intact until their next begin.
+TF_API void tf_renderer_submit_command_lists(TF_Renderer *renderer, TF_CommandList *const *lists, u32 count);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,49 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include "tunafish/core/export.h"
+#include "tunafish/core/math.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    TF_FRUSTUM_LEFT = 0,
+    TF_FRUSTUM_RIGHT,
+    TF_FRUSTUM_BOTTOM,
+    TF_FRUSTUM_TOP,
+    TF_FRUSTUM_NEAR,
+    TF_FRUSTUM_FAR,
+    TF_FRUSTUM_PLANE_COUNT
+} TF_FrustumPlane;
+
+// View volume as six normalized planes facing inwards: a point p is inside
+// when dot(plane.xyz, p) + plane.w >= 0 for every plane, and the value is its
+// distance from the plane.
+typedef struct {
+    TF_Vec4 planes[TF_FRUSTUM_PLANE_COUNT];
+} TF_Frustum;
+
+// Planes of a view-projection matrix (OpenGL clip space), in the space the
+// matrix transforms from: world space for projection * view.
+TF_API TF_Frustum tf_frustum_from_matrix(TF_Mat4 view_projection);
+
+// Conservative tests: a box or sphere crossing a corner of the frustum from
+// outside can pass, one touching the view volume never fails.
+TF_API b32 tf_frustum_test_box(const TF_Frustum *frustum, TF_Vec3 center, TF_Vec3 extents);
+
+TF_API b32 tf_frustum_test_sphere(const TF_Frustum *frustum, TF_Vec3 center, f32 radius);
+
+// Batch box test, four boxes at a time with SSE where available. Boxes are
+// given by center and half extents; the indices of visible ones are written
+// to visible in ascending order (room for count) and their number returned.
+TF_API u32 tf_frustum_cull_boxes(const TF_Frustum *frustum, const TF_Vec3 *centers, const TF_Vec3 *extents,
+                                 u32 count, u32 *visible);
+
+#ifdef __cplusplus
+}
+#endif
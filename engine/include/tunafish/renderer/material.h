@@ -23,6 +23,11 @@ TF_API void tf_material_destroy(TF_Material *material);
 // Property management
 TF_API void tf_material_set_color(TF_Material *material, TF_Color color);
 
+TF_API TF_Color tf_material_get_color(const TF_Material *material);
+
+// Unique per material (0 for NULL)
+TF_API u32 tf_material_get_id(const TF_Material *material);
+
 #ifdef __cplusplus
 }
 #endif
@@ -15,13 +15,173 @@ extern "C" {
 // Forward declarations
 typedef struct TF_Mesh TF_Mesh;
 
+// =============================================================================
+// Vertex layout
+// =============================================================================
+
+// Attribute semantics; the value doubles as the shader input location
+typedef enum {
+    TF_VERTEX_ATTRIBUTE_POSITION = 0,
+    TF_VERTEX_ATTRIBUTE_COLOR = 1,
+    TF_VERTEX_ATTRIBUTE_NORMAL = 2,
+    TF_VERTEX_ATTRIBUTE_TEXCOORD = 3,
+    TF_VERTEX_ATTRIBUTE_COUNT
+} TF_VertexAttribute;
+
+typedef enum {
+    TF_VERTEX_FORMAT_FLOAT2 = 0,
+    TF_VERTEX_FORMAT_FLOAT3,
+    TF_VERTEX_FORMAT_FLOAT4,
+    TF_VERTEX_FORMAT_UBYTE4_NORM // 4 x u8 mapped to [0, 1]
+} TF_VertexFormat;
+
+#define TF_VERTEX_LAYOUT_MAX_ELEMENTS 8
+
+typedef struct {
+    TF_VertexAttribute attribute;
+    TF_VertexFormat format;
+    u32 offset; // Byte offset inside a vertex
+} TF_VertexElement;
+
+// Interleaved layout of one vertex buffer
+typedef struct {
+    TF_VertexElement elements[TF_VERTEX_LAYOUT_MAX_ELEMENTS];
+    u32 element_count;
+    u32 stride;
+} TF_VertexLayout;
+
+// Append an element at the end of the vertex and grow the stride
+TF_API b32 tf_vertex_layout_add(TF_VertexLayout *layout, TF_VertexAttribute attribute, TF_VertexFormat format);
+
+TF_API b32 tf_vertex_layout_has(const TF_VertexLayout *layout, TF_VertexAttribute attribute);
+
+// =============================================================================
+// Mesh lifecycle
+// =============================================================================
+
+// Indexed geometry; data is copied. GPU buffers are created by the renderer
+// the first time the mesh is drawn and stay resident until it is destroyed.
+typedef struct {
+    const TF_VertexLayout *layout;
+    const void *vertices;
+    u32 vertex_count;
+    const u32 *indices;
+    u32 index_count; // Multiple of 3 (triangle lists)
+    b32 optimize;    // Reorder the copy for the GPU caches, see tf_mesh_optimize
+} TF_MeshDesc;
+
+TF_API TF_Mesh *tf_mesh_create(const TF_MeshDesc *desc);
+
 // Simple mesh creation
 TF_API TF_Mesh *tf_mesh_create_triangle(TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3, TF_Color color);
 
+// Unit-normal cube centered on the origin
 TF_API TF_Mesh *tf_mesh_create_cube(f32 size);
 
+// Recorded draws keep a pointer to the mesh until they are replayed, so a mesh
+// must not be destroyed while a renderer frame (before tf_renderer_end_frame)
+// or a command list (before it is submitted or begun again) still holds draws
+// of it or of a mesh using it as a LOD. Draws already handed to a render
+// thread are safe: the mesh is released after them.
 TF_API void tf_mesh_destroy(TF_Mesh *mesh);
 
+// =============================================================================
+// Level of detail
+// =============================================================================
+
+#define TF_MESH_MAX_LODS 4
+
+// Coarser versions of a mesh, drawn in its place once its bounding sphere
+// covers less than screen_size of the viewport's height (0.25 = a quarter).
+// Add them finest first, with decreasing screen sizes. The renderer picks a
+// level per instance whenever a camera is set. lod must outlive mesh.
+TF_API b32 tf_mesh_add_lod(TF_Mesh *mesh, TF_Mesh *lod, f32 screen_size);
+
+// =============================================================================
+// Clusters
+// =============================================================================
+
+#define TF_MESH_CLUSTER_DEFAULT_TRIANGLES 64
+#define TF_MESH_CLUSTER_MAX_TRIANGLES 256
+
+// A run of neighbouring triangles, contiguous in the index buffer, with its
+// bounds in object space. The normal cone bounds which way the triangles
+// face: all of them face away from any camera position p for which
+// dot(normalize(cone_apex - p), cone_axis) >= cone_cutoff.
+typedef struct {
+    u32 first_index;
+    u32 index_count;
+    TF_Vec3 center;  // Box around the cluster's vertices
+    TF_Vec3 extents;
+    TF_Vec3 cone_apex;
+    TF_Vec3 cone_axis;
+    f32 cone_cutoff; // > 1 = no cone (the triangles face too many ways)
+} TF_MeshCluster;
+
+// Split a large mesh into clusters of up to max_triangles connected triangles
+// (0 = TF_MESH_CLUSTER_DEFAULT_TRIANGLES), reordering its triangles so each is
+// a contiguous range. From then on, whenever the renderer draws it with a
+// camera, clusters outside the frustum are left out of the draw, and with
+// cull_backfaces also clusters facing entirely away from the camera
+// (counter-clockwise triangles face forward). Meshes are drawn two-sided, so
+// that is only safe for closed meshes seen from outside, whose back faces
+// are always hidden.
+// Call it before the mesh is first drawn.
+TF_API b32 tf_mesh_build_clusters(TF_Mesh *mesh, u32 max_triangles, b32 cull_backfaces);
+
+// =============================================================================
+// Optimization
+// =============================================================================
+
+// Size of the FIFO post-transform vertex cache the optimizer orders for and
+// the statistics below simulate
+#define TF_MESH_VERTEX_CACHE_SIZE 16
+
+// How often the vertex shader runs for a mesh's index order
+typedef struct {
+    f32 acmr; // Average cache miss ratio: shaded vertices per triangle (3 at worst, about 0.5 on large grids)
+    f32 atvr; // Average transformed vertex ratio: shaded vertices per referenced vertex (1 at best)
+} TF_VertexCacheStats;
+
+typedef struct {
+    TF_VertexCacheStats before;
+    TF_VertexCacheStats after;
+} TF_MeshOptimizeStats;
+
+// Reorder a mesh's triangles and vertices for the GPU without changing what
+// it draws: triangles first for the post-transform vertex cache (Tipsify),
+// then runs of them for less overdraw (outward-facing runs on the outside of
+// the mesh first), then vertices in the order the triangles first use them,
+// for the pre-transform fetch cache. A clustered mesh keeps its clusters and
+// only has the triangles inside each reordered; clusters built later keep
+// the mesh optimized. Call it before the mesh is first drawn. stats may be
+// NULL.
+TF_API b32 tf_mesh_optimize(TF_Mesh *mesh, TF_MeshOptimizeStats *stats);
+
+// Simulate the current index order on a TF_MESH_VERTEX_CACHE_SIZE FIFO cache
+TF_API TF_VertexCacheStats tf_mesh_analyze_vertex_cache(const TF_Mesh *mesh);
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+// Object-space bounds of the vertex positions, computed at creation
+typedef struct {
+    TF_Vec3 center;  // Center of the box
+    TF_Vec3 extents; // Half size of the box
+    f32 radius;      // Sphere around center enclosing every vertex
+} TF_MeshBounds;
+
+TF_API const TF_VertexLayout *tf_mesh_get_layout(const TF_Mesh *mesh);
+TF_API u32 tf_mesh_get_vertex_count(const TF_Mesh *mesh);
+TF_API const void *tf_mesh_get_vertices(const TF_Mesh *mesh); // Interleaved as the layout describes
+TF_API u32 tf_mesh_get_index_count(const TF_Mesh *mesh);
+TF_API const u32 *tf_mesh_get_indices(const TF_Mesh *mesh);
+TF_API TF_MeshBounds tf_mesh_get_bounds(const TF_Mesh *mesh);
+TF_API u32 tf_mesh_get_lod_count(const TF_Mesh *mesh);
+TF_API u32 tf_mesh_get_cluster_count(const TF_Mesh *mesh);
+TF_API const TF_MeshCluster *tf_mesh_get_clusters(const TF_Mesh *mesh); // NULL without clusters
+
 #ifdef __cplusplus
 }
 #endif
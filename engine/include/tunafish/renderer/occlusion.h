@@ -0,0 +1,84 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include "tunafish/core/export.h"
+#include "tunafish/core/math.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Forward declarations
+typedef struct TF_Camera TF_Camera;
+typedef struct TF_Mesh TF_Mesh;
+typedef struct TF_OcclusionBuffer TF_OcclusionBuffer;
+
+// =============================================================================
+// Occlusion buffer - CPU occlusion culling
+// =============================================================================
+
+// A low-resolution depth buffer that a few large occluders (walls, buildings,
+// terrain, usually simplified meshes) are rasterized into on the CPU, and that
+// the bounding boxes of everything else are then tested against. It never
+// touches the graphics API, so it works the same on every backend, including
+// the null one.
+//
+// Each frame: begin with the camera, add the occluders, rasterize (spread over
+// worker threads, one tile per task), then test. Tests only read the buffer,
+// so any number of threads may run them at once until the next begin.
+//
+// The buffer stores the nearest 1/w per pixel plus the farthest value of every
+// 8x8 block, so most tests never look at single pixels. Rasterization is
+// conservative: a pixel only counts as covered when an occluder covers all of
+// it, at the occluder's farthest depth over the pixel, so nothing visible is
+// culled. In exchange, occluders thinner than a couple of buffer pixels hide
+// nothing, and neither do gaps that two occluders only close together.
+
+#define TF_OCCLUSION_DEFAULT_WIDTH 320
+#define TF_OCCLUSION_DEFAULT_HEIGHT 180
+#define TF_OCCLUSION_MAX_WORKER_THREADS 7 // Cap for the automatic thread count
+
+typedef struct {
+    u32 width;          // Buffer resolution, rounded up to whole 8x8 blocks (0 = default)
+    u32 height;
+    u32 worker_threads; // Rasterizer threads besides the caller (0 = one per extra core, capped)
+} TF_OcclusionConfig;
+
+typedef struct {
+    u32 occluders;           // Occluder instances added since begin
+    u32 occluder_triangles;  // Triangles that reached the buffer after clipping
+    f32 rasterize_ms;        // CPU time of the last rasterize
+} TF_OcclusionStats;
+
+// config may be NULL for the defaults
+TF_API TF_OcclusionBuffer *tf_occlusion_buffer_create(const TF_OcclusionConfig *config);
+
+TF_API void tf_occlusion_buffer_destroy(TF_OcclusionBuffer *buffer);
+
+// Start a new frame seen through camera; drops the previous occluders
+TF_API void tf_occlusion_buffer_begin(TF_OcclusionBuffer *buffer, const TF_Camera *camera);
+
+// Queue every triangle of mesh, placed by transform, as an occluder. Both sides
+// of a triangle occlude.
+TF_API void tf_occlusion_buffer_add_occluder(TF_OcclusionBuffer *buffer, const TF_Mesh *mesh, TF_Mat4 transform);
+
+// Clear the buffer and rasterize the queued occluders into it
+TF_API void tf_occlusion_buffer_rasterize(TF_OcclusionBuffer *buffer);
+
+// TF_FALSE when a world-space box (center and half extents) is certainly
+// hidden behind the occluders or entirely off screen. Boxes crossing the near
+// plane are always visible.
+TF_API b32 tf_occlusion_buffer_test_box(const TF_OcclusionBuffer *buffer, TF_Vec3 center, TF_Vec3 extents);
+
+TF_API TF_OcclusionStats tf_occlusion_buffer_get_stats(const TF_OcclusionBuffer *buffer);
+
+// The rasterized buffer, for inspection: width * height values of 1/w (0 where
+// no occluder was drawn), rows bottom-up
+TF_API const f32 *tf_occlusion_buffer_get_depth(const TF_OcclusionBuffer *buffer, u32 *width, u32 *height);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,91 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include "tunafish/core/export.h"
+#include "tunafish/core/math.h"
+#include "tunafish/renderer/frustum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Forward declarations
+typedef struct TF_Camera TF_Camera;
+typedef struct TF_PortalGraph TF_PortalGraph;
+
+// =============================================================================
+// Portal graph - cell and portal visibility
+// =============================================================================
+
+// Interiors split into cells (rooms, as boxes) joined by portals (doorways
+// and windows, as convex polygons). Only what lies in a cell the camera can
+// see through a chain of portals needs drawing, and each visible cell comes
+// with the camera frustum narrowed to the portals it is seen through, so the
+// objects in it can be culled against that instead.
+//
+// Baking precomputes, for every cell, the set of cells visible from anywhere
+// inside it (its potentially visible set) as a bitset. It is conservative:
+// a cell is left out only when no line of sight through the portals reaches
+// it. At runtime the traversal then never enters cells outside the camera
+// cell's set. Adding cells or portals drops the baked sets.
+
+#define TF_PORTAL_MAX_VERTICES 8
+#define TF_CELL_NONE 0xFFFFFFFFu
+
+// A cell reached by find_visible
+typedef struct {
+    u32 cell;
+    TF_Frustum frustum; // Camera frustum narrowed to the portals the cell is seen through
+    f32 min_x, min_y;   // The same bounds in normalized device coordinates
+    f32 max_x, max_y;
+} TF_VisibleCell;
+
+typedef struct {
+    u32 cells_visible;  // Cells returned by the last find_visible
+    u32 portals_tested; // Portals it projected
+    u32 portals_skipped; // Portals it skipped because the baked set excluded the cell behind them
+} TF_PortalStats;
+
+TF_API TF_PortalGraph *tf_portal_graph_create(void);
+
+TF_API void tf_portal_graph_destroy(TF_PortalGraph *graph);
+
+// Add a cell spanning the box from min to max; returns its index, or
+// TF_CELL_NONE on failure. Where cells overlap, a point belongs to the first.
+TF_API u32 tf_portal_graph_add_cell(TF_PortalGraph *graph, TF_Vec3 min, TF_Vec3 max);
+
+// Join two cells through a planar convex polygon (3 to TF_PORTAL_MAX_VERTICES
+// vertices, either winding). Portals can be seen through both ways.
+TF_API b32 tf_portal_graph_add_portal(TF_PortalGraph *graph, u32 cell_a, u32 cell_b, const TF_Vec3 *vertices,
+                                      u32 vertex_count);
+
+TF_API u32 tf_portal_graph_get_cell_count(const TF_PortalGraph *graph);
+
+// Cell containing point, or TF_CELL_NONE
+TF_API u32 tf_portal_graph_find_cell(const TF_PortalGraph *graph, TF_Vec3 point);
+
+// Compute every cell's potentially visible set. The cost grows with the
+// number of portal chains, so it is meant for load time or tools.
+TF_API b32 tf_portal_graph_bake(TF_PortalGraph *graph);
+
+TF_API b32 tf_portal_graph_is_baked(const TF_PortalGraph *graph);
+
+// TF_TRUE when to is in from's potentially visible set (always TF_TRUE before baking)
+TF_API b32 tf_portal_graph_can_see(const TF_PortalGraph *graph, u32 from, u32 to);
+
+// Cells visible from camera, the camera's own first. Writes up to max_cells
+// and returns how many were visible. With the camera outside every cell,
+// every cell is returned with the full frustum. The traversal keeps its
+// scratch and stats in the graph, so finding cells for two views at once, or
+// from two threads, needs a graph each.
+TF_API u32 tf_portal_graph_find_visible(TF_PortalGraph *graph, const TF_Camera *camera, TF_VisibleCell *cells,
+                                        u32 max_cells);
+
+TF_API TF_PortalStats tf_portal_graph_get_stats(const TF_PortalGraph *graph);
+
+#ifdef __cplusplus
+}
+#endif
@@ -7,6 +7,7 @@
 #include "tunafish/core/export.h"
 #include "tunafish/core/math.h"
 #include "tunafish/renderer/renderer_types.h"
+#include "tunafish/renderer/frustum.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -17,16 +18,45 @@ typedef struct TF_Renderer TF_Renderer;
 typedef struct TF_Window TF_Window;
 typedef struct TF_Camera TF_Camera;
 typedef struct TF_Mesh TF_Mesh;
+typedef struct TF_OcclusionBuffer TF_OcclusionBuffer;
+typedef struct TF_ClusterCuller TF_ClusterCuller;
+typedef struct TF_Material TF_Material;
 
 // Renderer configuration
 typedef struct {
     TF_RendererBackendType backend;
     b32 enable_depth_test;
-    b32 enable_vsync;
+    b32 enable_vsync;             // Used when present_mode is TF_PRESENT_MODE_DEFAULT
     TF_Color clear_color;
+    u32 triangle_batch_size; // Triangles buffered before an implicit flush (0 = backend default)
+    const char *shader_cache_dir; // Directory for linked program binaries (NULL = no cache)
+    u32 width, height;            // Framebuffer size for backends without a window (0 = window size)
+    u32 worker_threads;           // Software rasterizer threads besides the caller (0 = one per extra core)
+    b32 enable_api_debug;         // Debug builds: count every graphics API call and report driver messages
+    b32 render_thread;            // Run the backend on its own thread (see below)
+    TF_PresentMode present_mode;  // Swap interval (see TF_PresentMode)
+    u32 max_frames_in_flight;     // Frames the CPU may queue ahead of the GPU (0 = TF_DEFAULT_FRAMES_IN_FLIGHT)
 } TF_RendererConfig;
 
-// Core renderer lifecycle
+// end_frame presents the frame: it swaps the window's buffers, so do not call
+// tf_window_swap_buffers as well (while a renderer presents to the window,
+// that call warns once and does nothing). Fewer frames in flight mean less latency
+// between input and display, at the cost of CPU/GPU overlap; 1 lets the GPU
+// draw one frame while the CPU records the next.
+
+// With render_thread set, the backend, and the window's GL context, move to a
+// dedicated render thread. The calling thread records a frame and hands it
+// over at end_frame, then goes on with the next while the render thread
+// submits it and presents it. The renderer is still used from one thread
+// only. Stats and GPU timings describe the last frame the render thread
+// finished; its cpu_to_swap_ms counts from the calling thread's begin_frame,
+// and frames queued for the render thread count towards max_frames_in_flight.
+// read_pixels, frame capture and get_api_calls wait for the render thread to
+// catch up, as does destroying a mesh it has drawn. The calling thread is left
+// without a GL context, so the shader API (shader.h) refuses to run there.
+
+// Core renderer lifecycle. window may be NULL for the null backend, and for
+// the software backend when width and height are set.
 TF_API TF_Renderer *tf_renderer_create(TF_Window *window, const TF_RendererConfig *config);
 
 TF_API void tf_renderer_destroy(TF_Renderer *renderer);
@@ -38,14 +68,82 @@ TF_API void tf_renderer_end_frame(TF_Renderer *renderer);
 
 TF_API void tf_renderer_clear(TF_Renderer *renderer, TF_ClearFlags flags);
 
-// Camera management
+// Camera management. With a camera set, mesh instances whose bounds fall
+// outside its frustum are dropped as they are drawn, and meshes with levels of
+// detail draw the one matching their size on screen (see tf_mesh_add_lod).
 TF_API void tf_renderer_set_camera(TF_Renderer *renderer, TF_Camera *camera);
 
+// Also cull mesh instances hidden in occlusion (NULL = off). Only applies
+// with a camera set, which should be the one occlusion was rasterized for.
+TF_API void tf_renderer_set_occlusion(TF_Renderer *renderer, const TF_OcclusionBuffer *occlusion);
+
+// Cull the clusters of clustered meshes (see tf_mesh_build_clusters) on
+// culler's worker threads (NULL = on the calling thread)
+TF_API void tf_renderer_set_cluster_culler(TF_Renderer *renderer, TF_ClusterCuller *culler);
+
+// Cull mesh instances against frustum instead of the camera's (NULL = the
+// camera's again), such as a cell's from tf_portal_graph_find_visible. It is
+// copied; depth sorting and LODs still follow the camera.
+TF_API void tf_renderer_set_cull_frustum(TF_Renderer *renderer, const TF_Frustum *frustum);
+
+// Draw ordering: lower layers are submitted first (default 0)
+TF_API void tf_renderer_set_layer(TF_Renderer *renderer, u8 layer);
+
+// Material for subsequent mesh draws (NULL = default white)
+TF_API void tf_renderer_set_material(TF_Renderer *renderer, TF_Material *material);
+
 // Basic drawing
 TF_API void tf_renderer_draw_triangle(TF_Renderer *renderer, TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3, TF_Color color);
 
 TF_API void tf_renderer_draw_mesh(TF_Renderer *renderer, TF_Mesh *mesh, TF_Mat4 transform);
 
+// Instanced drawing: one command for count copies of the mesh. colors may be
+// NULL (white). Separate draw_mesh calls with the same mesh and material are
+// also merged into instanced draws automatically.
+TF_API void tf_renderer_draw_mesh_instanced(TF_Renderer *renderer, TF_Mesh *mesh, const TF_Mat4 *transforms,
+                                            const TF_Color *colors, u32 count);
+
+TF_API void tf_renderer_draw_mesh_instances(TF_Renderer *renderer, TF_Mesh *mesh, const TF_InstanceData *instances,
+                                            u32 count);
+
+// Pack a transform into the compact 3x4 instance layout
+TF_API TF_InstanceData tf_instance_data_create(TF_Mat4 transform, TF_Color color);
+
+// Copy RGBA8 pixels of the current framebuffer into pixels (width * height * 4
+// bytes). Rows are bottom-up, as with glReadPixels. Draws recorded so far are
+// executed first, so this is a synchronization point.
+TF_API b32 tf_renderer_read_pixels(TF_Renderer *renderer, i32 x, i32 y, u32 width, u32 height, void *pixels);
+
+// Asynchronous frame capture. From the next end_frame on, each frame is copied
+// into a readback ring and collected a few frames later, once the GPU is done,
+// then encoded and written by a background thread, so capturing costs the
+// render thread almost nothing. Stopping collects the frames still in flight
+// and waits for the writer.
+TF_API b32 tf_renderer_capture_start(TF_Renderer *renderer, const TF_CaptureConfig *config);
+
+TF_API void tf_renderer_capture_stop(TF_Renderer *renderer);
+
+// TF_TRUE until every requested frame has been handed to the writer
+TF_API b32 tf_renderer_is_capturing(const TF_Renderer *renderer);
+
+// Labelled GPU passes, timed by backends that support it. Draws recorded
+// before a pass boundary are submitted before it, so sorting never moves a
+// draw across one. Passes nest; one left open is closed at end_frame.
+TF_API void tf_renderer_begin_pass(TF_Renderer *renderer, const char *name);
+
+TF_API void tf_renderer_end_pass(TF_Renderer *renderer);
+
+// Per-pass GPU times of the latest frame whose results are available. Returns
+// TF_FALSE when the backend has no GPU timers or nothing has completed yet.
+TF_API b32 tf_renderer_get_gpu_timings(const TF_Renderer *renderer, TF_GPUTimings *timings);
+
+// Statistics for the current (or last completed) frame
+TF_API TF_RendererStats tf_renderer_get_stats(const TF_Renderer *renderer);
+
+// Graphics API entry points called in the current frame, most called first
+// (needs enable_api_debug). Returns the number written, at most max_calls.
+TF_API u32 tf_renderer_get_api_calls(const TF_Renderer *renderer, TF_APICallCount *calls, u32 max_calls);
+
 #ifdef __cplusplus
 }
 #endif
@@ -13,9 +13,26 @@ extern "C" {
 // Backend types
 typedef enum {
     TF_RENDERER_BACKEND_OPENGL,
-    TF_RENDERER_BACKEND_VULKAN
+    TF_RENDERER_BACKEND_VULKAN,
+    TF_RENDERER_BACKEND_SOFTWARE, // CPU rasterizer into system memory, no GPU or window needed
+    TF_RENDERER_BACKEND_NULL      // Records backend calls without rendering, for submission benchmarks
 } TF_RendererBackendType;
 
+// How frames are presented. With vsync the swap waits for the display's
+// refresh; adaptive vsync does too, but a frame that misses its refresh is
+// shown at once and tears instead of waiting a whole extra interval (falls
+// back to vsync where the driver lacks it); unlocked never waits for the
+// display. In every mode the CPU runs at most max_frames_in_flight frames
+// ahead of the GPU.
+typedef enum {
+    TF_PRESENT_MODE_DEFAULT = 0, // Vsync when enable_vsync is set, unlocked otherwise
+    TF_PRESENT_MODE_VSYNC,
+    TF_PRESENT_MODE_ADAPTIVE,
+    TF_PRESENT_MODE_UNLOCKED
+} TF_PresentMode;
+
+#define TF_DEFAULT_FRAMES_IN_FLIGHT 2
+
 // Clear flags
 typedef enum {
     TF_CLEAR_COLOR = 1 << 0,
@@ -34,6 +51,94 @@ typedef struct {
 #define TF_COLOR_GREEN ((TF_Color){0.0f, 1.0f, 0.0f, 1.0f})
 #define TF_COLOR_BLUE  ((TF_Color){0.0f, 0.0f, 1.0f, 1.0f})
 
+// Compact per-instance data for instanced mesh draws (64 bytes). The transform
+// is the top three rows of a 4x4 matrix, row-major; the bottom row is always
+// (0, 0, 0, 1).
+typedef struct {
+    f32 transform[12];
+    TF_Color color; // Multiplied with the vertex (or material) color
+} TF_InstanceData;
+
+// Part of a mesh's index buffer, in indices
+typedef struct {
+    u32 first_index;
+    u32 index_count;
+} TF_IndexRange;
+
+// Frame capture output formats
+typedef enum {
+    TF_CAPTURE_FORMAT_RAW = 0, // RGBA8 frames appended to one file, top-down rows, no header
+    TF_CAPTURE_FORMAT_Y4M,     // YUV4MPEG2 4:4:4 stream, playable by ffmpeg and mpv
+    TF_CAPTURE_FORMAT_PNG      // One file per frame; path is a pattern such as "shot_%05u.png"
+} TF_CaptureFormat;
+
+// Frame capture settings
+typedef struct {
+    const char *path;
+    TF_CaptureFormat format;
+    u32 frame_count; // Frames to capture before stopping (0 = until stopped, 1 = screenshot)
+    u32 frame_rate;  // Y4M playback rate (0 = 60)
+} TF_CaptureConfig;
+
+// GPU timing limits
+#define TF_GPU_MAX_PASSES 16       // Timed passes per frame
+#define TF_GPU_PASS_NAME_LENGTH 32 // Including the terminator; longer labels are truncated
+
+// GPU time spent in one labelled pass
+typedef struct {
+    char name[TF_GPU_PASS_NAME_LENGTH];
+    u32 depth;  // Nesting level (0 = top level)
+    f32 gpu_ms;
+} TF_GPUPassTiming;
+
+// GPU times of the most recent frame whose results have come back. They lag
+// the current frame by a few frames, since the GPU is never waited on.
+typedef struct {
+    u64 frame;          // Backend frame number the times belong to (0 = none yet)
+    f32 frame_ms;       // begin_frame to end_frame
+    u32 pass_count;
+    TF_GPUPassTiming passes[TF_GPU_MAX_PASSES]; // In begin order
+    u32 dropped_frames; // Frames left untimed because every query set was in flight
+} TF_GPUTimings;
+
+// Calls made through one graphics API entry point
+typedef struct {
+    const char *name;
+    u32 count;
+} TF_APICallCount;
+
+// Per-frame renderer statistics (reset at begin_frame)
+typedef struct {
+    u32 commands;        // Commands recorded, sorted and replayed by the renderer
+    u32 draw_calls;      // Draw calls issued to the graphics API
+    u32 triangles;       // Triangles submitted
+    u32 instances;       // Mesh instances drawn
+    u32 batch_flushes;   // Triangle batches flushed (end of frame, state change or full batch)
+    u64 bytes_uploaded;  // Bytes streamed to the GPU
+    u32 stream_waits;    // Times the CPU waited for the GPU to release streaming memory
+    u32 state_calls_issued;   // State/bind calls that reached the driver
+    u32 state_calls_filtered; // Redundant state/bind calls dropped by the state cache
+    u32 program_binds;        // Shader programs bound
+    u32 vertex_array_binds;   // Vertex arrays bound
+    u32 buffer_binds;         // Vertex buffers bound
+    u32 texture_binds;        // Textures bound (API debug layer only)
+    u32 api_calls;            // Graphics API calls of any kind (API debug layer only)
+    u32 api_redundant_binds;  // Binds that reached the driver without changing anything (API debug layer only)
+    u32 api_messages;         // Driver errors and performance warnings (API debug layer only)
+    u32 backend_calls;        // Backend entry points invoked (null backend only)
+    f32 gpu_frame_ms;         // GPU time of the latest timed frame (see TF_GPUTimings, 0 = unavailable)
+    f32 cpu_to_swap_ms;       // begin_frame until the swap returned (0 = the backend does not present)
+    f32 present_wait_ms;      // Time present waited to stay within max_frames_in_flight
+    u32 frames_in_flight;     // Presented frames the GPU had not finished, this one included
+    u32 instances_tested;     // Mesh instances tested against the camera frustum
+    u32 instances_culled;     // Of those, instances outside it and never drawn
+    u32 instances_occluded;   // Instances inside it but hidden in the occlusion buffer
+    u32 instances_lod;        // Instances drawn with a reduced level of detail
+    u32 clusters_tested;      // Clusters of drawn clustered mesh instances tested
+    u32 clusters_culled;      // Of those, clusters outside the frustum
+    u32 clusters_backfacing;  // Clusters inside it but facing away from the camera
+} TF_RendererStats;
+
 #ifdef __cplusplus
 }
 #endif
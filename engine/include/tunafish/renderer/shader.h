@@ -15,37 +15,151 @@ extern "C" {
 // Opaque shader handle
 typedef struct TF_Shader TF_Shader;
 
+// Uniform handle, resolved once with tf_shader_get_uniform and reused per draw
+typedef i32 TF_ShaderUniform;
+
+#define TF_SHADER_UNIFORM_INVALID (-1)
+
+// =============================================================================
+// Standard uniform blocks
+// =============================================================================
+
+// Shaders that declare these std140 blocks get them bound automatically at
+// link time; the renderer uploads their contents once per frame/camera.
+//
+//   layout (std140) uniform TF_FrameData {
+//       vec4 tf_time;       // x = elapsed seconds, y = delta seconds
+//       vec4 tf_viewport;   // x, y, width, height
+//   };
+//
+//   layout (std140) uniform TF_CameraData {
+//       mat4 tf_view;
+//       mat4 tf_projection;
+//       mat4 tf_view_projection;
+//       vec4 tf_camera_position;
+//   };
+
+#define TF_SHADER_FRAME_BLOCK      "TF_FrameData"
+#define TF_SHADER_CAMERA_BLOCK     "TF_CameraData"
+#define TF_SHADER_FRAME_BINDING    0
+#define TF_SHADER_CAMERA_BINDING   1
+#define TF_SHADER_USER_BINDING     2 // First binding point free for user blocks
+
+// CPU mirrors of the std140 layouts above (vec4-padded on purpose)
+typedef struct {
+    TF_Vec4 time;
+    TF_Vec4 viewport;
+} TF_FrameUniforms;
+
+typedef struct {
+    TF_Mat4 view;
+    TF_Mat4 projection;
+    TF_Mat4 view_projection;
+    TF_Vec4 position;
+} TF_CameraUniforms;
+
+// Compilation state of a shader created with tf_shader_create_async
+typedef enum {
+    TF_SHADER_STATUS_PENDING = 0,
+    TF_SHADER_STATUS_READY,
+    TF_SHADER_STATUS_FAILED
+} TF_ShaderStatus;
+
+// Program creation counters since the first of the running renderers started
+typedef struct {
+    u32 hits;               // Programs restored from the binary cache
+    u32 misses;             // Cache lookups that had to compile
+    u32 rejected;           // Cached binaries the driver refused (counted as misses too)
+    u32 stores;             // Binaries written to the cache
+    u32 compiled;           // Programs compiled and linked from source
+    f64 load_time_ms;       // Time spent restoring cached binaries
+    f64 compile_time_ms;    // Time spent compiling and linking from source
+} TF_ShaderCacheStats;
+
 // =============================================================================
 // Shader lifecycle
 // =============================================================================
 
-// Create shader from GLSL source strings
+// Shaders make GL calls on the calling thread. Calls that need the driver fail
+// with an error when no GL context is current there, as on the thread that
+// records for a renderer with render_thread set.
+
+// Create shader from GLSL source strings (blocks until compiled and linked)
 TF_API TF_Shader *tf_shader_create(const char *vertex_source, const char *fragment_source);
 
+// Submit shader for compilation and return immediately. The shader stays
+// PENDING until tf_shader_poll_pending (called by the renderer every frame) or
+// tf_shader_wait picks up the result; until then the fallback is drawn instead.
+TF_API TF_Shader *tf_shader_create_async(const char *vertex_source, const char *fragment_source);
+
 // Destroy shader and free resources
 TF_API void tf_shader_destroy(TF_Shader *shader);
 
 // Check if shader is valid (compiled successfully)
 TF_API b32 tf_shader_is_valid(const TF_Shader *shader);
 
+// =============================================================================
+// Asynchronous compilation
+// =============================================================================
+
+TF_API TF_ShaderStatus tf_shader_get_status(const TF_Shader *shader);
+
+// Block until the shader has finished compiling
+TF_API TF_ShaderStatus tf_shader_wait(TF_Shader *shader);
+
+// Finalize pending shaders the driver has finished; returns how many are still pending.
+// Without KHR_parallel_shader_compile at most one shader is finalized per call.
+TF_API u32 tf_shader_poll_pending(void);
+
+// Shader drawn in place of pending or failed shaders (the backend installs a default)
+TF_API void tf_shader_set_fallback(TF_Shader *fallback);
+TF_API TF_Shader *tf_shader_get_fallback(void);
+
+// The shader itself once ready, otherwise the fallback (may be NULL)
+TF_API TF_Shader *tf_shader_resolve(TF_Shader *shader);
+
 // =============================================================================
 // Shader binding
 // =============================================================================
 
+// Binds the fallback while the shader is still pending
 TF_API void tf_shader_bind(TF_Shader *shader);
 TF_API void tf_shader_unbind(void);
 
 // =============================================================================
-// Uniform setters
+// Reflection
+// =============================================================================
+
+// Look up a uniform reflected at link time (no driver call). Returns
+// TF_SHADER_UNIFORM_INVALID if the uniform is not active. Arrays can be
+// looked up both as "name" and "name[0]".
+TF_API TF_ShaderUniform tf_shader_get_uniform(const TF_Shader *shader, const char *name);
+
+// Number of active uniforms / uniform blocks found at link time
+TF_API u32 tf_shader_get_uniform_count(const TF_Shader *shader);
+TF_API u32 tf_shader_get_uniform_block_count(const TF_Shader *shader);
+
+// Route a reflected uniform block to a binding point. Other blocks start out on
+// consecutive points from TF_SHADER_USER_BINDING, in block index order.
+TF_API b32 tf_shader_set_uniform_block_binding(TF_Shader *shader, const char *block_name, u32 binding);
+
+// =============================================================================
+// Uniform setters (shader must be bound)
+// =============================================================================
+
+TF_API void tf_shader_set_int(TF_Shader *shader, TF_ShaderUniform uniform, i32 value);
+TF_API void tf_shader_set_float(TF_Shader *shader, TF_ShaderUniform uniform, f32 value);
+TF_API void tf_shader_set_vec2(TF_Shader *shader, TF_ShaderUniform uniform, TF_Vec2 value);
+TF_API void tf_shader_set_vec3(TF_Shader *shader, TF_ShaderUniform uniform, TF_Vec3 value);
+TF_API void tf_shader_set_vec4(TF_Shader *shader, TF_ShaderUniform uniform, TF_Vec4 value);
+TF_API void tf_shader_set_mat4(TF_Shader *shader, TF_ShaderUniform uniform, const TF_Mat4 *value);
+TF_API void tf_shader_set_color(TF_Shader *shader, TF_ShaderUniform uniform, TF_Color value);
+
+// =============================================================================
+// Program binary cache (enabled through TF_RendererConfig.shader_cache_dir)
 // =============================================================================
 
-TF_API void tf_shader_set_int(TF_Shader *shader, const char *name, i32 value);
-TF_API void tf_shader_set_float(TF_Shader *shader, const char *name, f32 value);
-TF_API void tf_shader_set_vec2(TF_Shader *shader, const char *name, TF_Vec2 value);
-TF_API void tf_shader_set_vec3(TF_Shader *shader, const char *name, TF_Vec3 value);
-TF_API void tf_shader_set_vec4(TF_Shader *shader, const char *name, TF_Vec4 value);
-TF_API void tf_shader_set_mat4(TF_Shader *shader, const char *name, const TF_Mat4 *value);
-TF_API void tf_shader_set_color(TF_Shader *shader, const char *name, TF_Color value);
+TF_API TF_ShaderCacheStats tf_shader_get_cache_stats(void);
 
 // =============================================================================
 // Shader program ID (for advanced usage)
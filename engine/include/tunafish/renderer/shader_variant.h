@@ -0,0 +1,76 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include "tunafish/core/export.h"
+#include "tunafish/renderer/shader.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Opaque shader template handle
+typedef struct TF_ShaderTemplate TF_ShaderTemplate;
+
+// Feature bitmask; bit i enables the template's i-th feature define
+typedef u64 TF_ShaderFeatures;
+
+#define TF_SHADER_MAX_FEATURES 64
+
+// =============================================================================
+// Include registry
+// =============================================================================
+
+// Template sources may pull in registered snippets with `#include "name"`.
+// Each snippet is expanded at most once per shader stage. The renderer
+// registers "tunafish/frame.glsl" and "tunafish/camera.glsl" with the
+// standard uniform blocks; the registry lives until the last renderer is
+// destroyed.
+TF_API b32 tf_shader_include_register(const char *name, const char *source);
+
+// =============================================================================
+// Templates
+// =============================================================================
+
+typedef struct {
+    const char *vertex_source;   // Must start with a #version line
+    const char *fragment_source; // Must start with a #version line
+    const char *const *features; // Define names, features[i] is enabled by bit i
+    u32 feature_count;
+} TF_ShaderTemplateDesc;
+
+// Sources and feature names are copied
+TF_API TF_ShaderTemplate *tf_shader_template_create(const TF_ShaderTemplateDesc *desc);
+
+// Variants acquired from the template stay valid until they are released
+TF_API void tf_shader_template_destroy(TF_ShaderTemplate *shader_template);
+
+// Bit for a feature name, 0 if the template has no such feature
+TF_API TF_ShaderFeatures tf_shader_template_feature(const TF_ShaderTemplate *shader_template, const char *name);
+
+// =============================================================================
+// Variants
+// =============================================================================
+
+// Get the variant for a feature set, compiling it asynchronously the first time
+// it is requested. Variants whose expanded sources are identical are shared,
+// even across templates. Every acquire must be paired with a release.
+TF_API TF_Shader *tf_shader_variant_acquire(TF_ShaderTemplate *shader_template, TF_ShaderFeatures features);
+
+// Drop a reference; the variant is destroyed once nothing uses it
+TF_API void tf_shader_variant_release(TF_Shader *shader);
+
+// Number of variants currently resident
+TF_API u32 tf_shader_variant_count(void);
+
+// Counted: each renderer inits on creation and shuts down when destroyed. The
+// last shutdown destroys the variants still resident (warning about those
+// still referenced) and the registered includes.
+TF_API void tf_shader_variants_init(void);
+TF_API void tf_shader_variants_shutdown(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -12,7 +12,13 @@
 #include "tunafish/core/time.h"
 #include "tunafish/core/types.h"
 #include "tunafish/platform/input.h"
+#include "tunafish/platform/thread.h"
 #include "tunafish/platform/window.h"
+#include "tunafish/renderer/cluster.h"
+#include "tunafish/renderer/command_list.h"
+#include "tunafish/renderer/frustum.h"
+#include "tunafish/renderer/occlusion.h"
+#include "tunafish/renderer/portal.h"
 #include "tunafish/renderer/renderer.h"
 
 #ifdef __cplusplus
@@ -0,0 +1,334 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "platform/egl_context.h"
+#include "tunafish/core/log.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef TF_PLATFORM_LINUX
+#include <dlfcn.h>
+
+// =============================================================================
+// EGL declarations (loaded at runtime, so no EGL headers or import library)
+// =============================================================================
+
+typedef void *EGLDisplay;
+typedef void *EGLConfig;
+typedef void *EGLContext;
+typedef void *EGLSurface;
+typedef i32 EGLint;
+typedef u32 EGLBoolean;
+typedef u32 EGLenum;
+
+#define EGL_NO_DISPLAY ((EGLDisplay)0)
+#define EGL_NO_CONTEXT ((EGLContext)0)
+#define EGL_NO_SURFACE ((EGLSurface)0)
+#define EGL_DEFAULT_DISPLAY ((void *)0)
+
+#define EGL_ALPHA_SIZE 0x3021
+#define EGL_BLUE_SIZE 0x3022
+#define EGL_GREEN_SIZE 0x3023
+#define EGL_RED_SIZE 0x3024
+#define EGL_DEPTH_SIZE 0x3025
+#define EGL_SURFACE_TYPE 0x3033
+#define EGL_NONE 0x3038
+#define EGL_RENDERABLE_TYPE 0x3040
+#define EGL_EXTENSIONS 0x3055
+#define EGL_HEIGHT 0x3056
+#define EGL_WIDTH 0x3057
+#define EGL_PBUFFER_BIT 0x0001
+#define EGL_OPENGL_BIT 0x0008
+#define EGL_OPENGL_API 0x30A2
+#define EGL_CONTEXT_MAJOR_VERSION 0x3098
+#define EGL_CONTEXT_MINOR_VERSION 0x30FB
+#define EGL_CONTEXT_OPENGL_PROFILE_MASK 0x30FD
+#define EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT 0x0001
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+
+typedef TF_ProcAddress (*PFN_eglGetProcAddress)(const char *name);
+typedef EGLint (*PFN_eglGetError)(void);
+typedef EGLDisplay (*PFN_eglGetDisplay)(void *native_display);
+typedef EGLDisplay (*PFN_eglGetPlatformDisplayEXT)(EGLenum platform, void *native_display, const EGLint *attributes);
+typedef EGLBoolean (*PFN_eglInitialize)(EGLDisplay display, EGLint *major, EGLint *minor);
+typedef EGLBoolean (*PFN_eglTerminate)(EGLDisplay display);
+typedef const char *(*PFN_eglQueryString)(EGLDisplay display, EGLint name);
+typedef EGLBoolean (*PFN_eglBindAPI)(EGLenum api);
+typedef EGLBoolean (*PFN_eglChooseConfig)(EGLDisplay display, const EGLint *attributes, EGLConfig *configs,
+                                          EGLint config_size, EGLint *config_count);
+typedef EGLContext (*PFN_eglCreateContext)(EGLDisplay display, EGLConfig config, EGLContext share,
+                                           const EGLint *attributes);
+typedef EGLBoolean (*PFN_eglDestroyContext)(EGLDisplay display, EGLContext context);
+typedef EGLSurface (*PFN_eglCreatePbufferSurface)(EGLDisplay display, EGLConfig config, const EGLint *attributes);
+typedef EGLBoolean (*PFN_eglDestroySurface)(EGLDisplay display, EGLSurface surface);
+typedef EGLBoolean (*PFN_eglMakeCurrent)(EGLDisplay display, EGLSurface draw, EGLSurface read, EGLContext context);
+typedef EGLContext (*PFN_eglGetCurrentContext)(void);
+
+// Library and display shared by every offscreen context
+static struct {
+    void *library;
+    EGLDisplay display;
+    u32 context_count;
+    b32 surfaceless;
+
+    PFN_eglGetProcAddress GetProcAddress;
+    PFN_eglGetError GetError;
+    PFN_eglGetDisplay GetDisplay;
+    PFN_eglInitialize Initialize;
+    PFN_eglTerminate Terminate;
+    PFN_eglQueryString QueryString;
+    PFN_eglBindAPI BindAPI;
+    PFN_eglChooseConfig ChooseConfig;
+    PFN_eglCreateContext CreateContext;
+    PFN_eglDestroyContext DestroyContext;
+    PFN_eglCreatePbufferSurface CreatePbufferSurface;
+    PFN_eglDestroySurface DestroySurface;
+    PFN_eglMakeCurrent MakeCurrent;
+    PFN_eglGetCurrentContext GetCurrentContext;
+} s_egl = {0};
+
+struct TF_EGLContext {
+    EGLContext context;
+    EGLSurface surface; // EGL_NO_SURFACE when surfaceless
+};
+
+// =============================================================================
+// Library and display
+// =============================================================================
+
+static b32 tf_egl_has_extension(const char *extensions, const char *name) {
+    if (!extensions) return TF_FALSE;
+
+    usize length = strlen(name);
+    for (const char *at = strstr(extensions, name); at; at = strstr(at + length, name)) {
+        if ((at == extensions || at[-1] == ' ') && (at[length] == ' ' || at[length] == '\0')) {
+            return TF_TRUE;
+        }
+    }
+    return TF_FALSE;
+}
+
+static b32 tf_egl_load_library(void) {
+    if (s_egl.library) return TF_TRUE;
+
+    void *library = dlopen("libEGL.so.1", RTLD_NOW | RTLD_LOCAL);
+    if (!library) {
+        library = dlopen("libEGL.so", RTLD_NOW | RTLD_LOCAL);
+    }
+    if (!library) {
+        TF_DEBUG("libEGL not found, offscreen EGL contexts are unavailable");
+        return TF_FALSE;
+    }
+
+    // dlsym returns void *, which ISO C can't cast to a function pointer directly
+#define TF_EGL_LOAD(name)                                        \
+    *(void **)&s_egl.name = dlsym(library, "egl" #name);         \
+    if (!s_egl.name) {                                           \
+        TF_ERROR("libEGL is missing egl%s", #name);              \
+        dlclose(library);                                        \
+        return TF_FALSE;                                         \
+    }
+
+    TF_EGL_LOAD(GetProcAddress)
+    TF_EGL_LOAD(GetError)
+    TF_EGL_LOAD(GetDisplay)
+    TF_EGL_LOAD(Initialize)
+    TF_EGL_LOAD(Terminate)
+    TF_EGL_LOAD(QueryString)
+    TF_EGL_LOAD(BindAPI)
+    TF_EGL_LOAD(ChooseConfig)
+    TF_EGL_LOAD(CreateContext)
+    TF_EGL_LOAD(DestroyContext)
+    TF_EGL_LOAD(CreatePbufferSurface)
+    TF_EGL_LOAD(DestroySurface)
+    TF_EGL_LOAD(MakeCurrent)
+    TF_EGL_LOAD(GetCurrentContext)
+#undef TF_EGL_LOAD
+
+    s_egl.library = library;
+    return TF_TRUE;
+}
+
+static void tf_egl_unload_library(void) {
+    if (!s_egl.library) return;
+
+    dlclose(s_egl.library);
+    memset(&s_egl, 0, sizeof(s_egl));
+}
+
+// The surfaceless platform needs no X11/Wayland server; the default display
+// is the fallback for drivers without it
+static b32 tf_egl_open_display(void) {
+    if (s_egl.display != EGL_NO_DISPLAY) return TF_TRUE;
+
+    const char *client_extensions = s_egl.QueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (tf_egl_has_extension(client_extensions, "EGL_MESA_platform_surfaceless") &&
+        tf_egl_has_extension(client_extensions, "EGL_EXT_platform_base")) {
+        PFN_eglGetPlatformDisplayEXT get_platform_display =
+            (PFN_eglGetPlatformDisplayEXT)s_egl.GetProcAddress("eglGetPlatformDisplayEXT");
+        if (get_platform_display) {
+            s_egl.display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+        }
+    }
+
+    EGLint major = 0, minor = 0;
+    if (s_egl.display != EGL_NO_DISPLAY && !s_egl.Initialize(s_egl.display, &major, &minor)) {
+        s_egl.display = EGL_NO_DISPLAY;
+    }
+    if (s_egl.display == EGL_NO_DISPLAY) {
+        s_egl.display = s_egl.GetDisplay(EGL_DEFAULT_DISPLAY);
+        if (s_egl.display == EGL_NO_DISPLAY || !s_egl.Initialize(s_egl.display, &major, &minor)) {
+            TF_ERROR("Failed to initialize an EGL display (error 0x%x)", s_egl.GetError());
+            s_egl.display = EGL_NO_DISPLAY;
+            return TF_FALSE;
+        }
+    }
+
+    const char *extensions = s_egl.QueryString(s_egl.display, EGL_EXTENSIONS);
+    s_egl.surfaceless = tf_egl_has_extension(extensions, "EGL_KHR_surfaceless_context");
+
+    TF_INFO("EGL %d.%d initialized (%s)", major, minor, s_egl.surfaceless ? "surfaceless" : "pbuffer");
+    return TF_TRUE;
+}
+
+// =============================================================================
+// Contexts
+// =============================================================================
+
+TF_EGLContext *tf_egl_context_create(void) {
+    if (!tf_egl_load_library()) {
+        return TF_NULL;
+    }
+    if (!tf_egl_open_display()) {
+        if (s_egl.context_count == 0) tf_egl_unload_library();
+        return TF_NULL;
+    }
+
+    TF_EGLContext *context = (TF_EGLContext *)calloc(1, sizeof(TF_EGLContext));
+    if (!context) {
+        TF_ERROR("Failed to allocate EGL context");
+        return TF_NULL;
+    }
+
+    // The same attributes the GLFW path asks for, minus the window
+    const EGLint config_attributes[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+        EGL_DEPTH_SIZE, 24,
+        EGL_NONE
+    };
+    const EGLint context_attributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+
+    EGLConfig config = TF_NULL;
+    EGLint config_count = 0;
+    if (!s_egl.BindAPI(EGL_OPENGL_API) ||
+        !s_egl.ChooseConfig(s_egl.display, config_attributes, &config, 1, &config_count) || config_count == 0) {
+        TF_ERROR("No EGL config supports offscreen OpenGL rendering (error 0x%x)", s_egl.GetError());
+        free(context);
+        return TF_NULL;
+    }
+
+    context->context = s_egl.CreateContext(s_egl.display, config, EGL_NO_CONTEXT, context_attributes);
+    if (context->context == EGL_NO_CONTEXT) {
+        TF_ERROR("Failed to create an OpenGL 3.3 core EGL context (error 0x%x)", s_egl.GetError());
+        free(context);
+        return TF_NULL;
+    }
+
+    if (!s_egl.surfaceless) {
+        const EGLint surface_attributes[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+        context->surface = s_egl.CreatePbufferSurface(s_egl.display, config, surface_attributes);
+        if (context->surface == EGL_NO_SURFACE) {
+            TF_ERROR("Failed to create an EGL pbuffer (error 0x%x)", s_egl.GetError());
+            s_egl.DestroyContext(s_egl.display, context->context);
+            free(context);
+            return TF_NULL;
+        }
+    }
+
+    s_egl.context_count++;
+    return context;
+}
+
+void tf_egl_context_destroy(TF_EGLContext *context) {
+    if (!context) return;
+
+    if (s_egl.GetCurrentContext() == context->context) {
+        s_egl.MakeCurrent(s_egl.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    }
+    if (context->surface != EGL_NO_SURFACE) {
+        s_egl.DestroySurface(s_egl.display, context->surface);
+    }
+    s_egl.DestroyContext(s_egl.display, context->context);
+    free(context);
+
+    // The display and library go away with the last context
+    if (--s_egl.context_count == 0) {
+        s_egl.Terminate(s_egl.display);
+        tf_egl_unload_library();
+    }
+}
+
+b32 tf_egl_context_make_current(TF_EGLContext *context) {
+    if (!context) return TF_FALSE;
+
+    if (!s_egl.MakeCurrent(s_egl.display, context->surface, context->surface, context->context)) {
+        TF_ERROR("Failed to make the EGL context current (error 0x%x)", s_egl.GetError());
+        return TF_FALSE;
+    }
+    return TF_TRUE;
+}
+
+void tf_egl_context_release(void) {
+    if (!s_egl.library) return;
+
+    s_egl.MakeCurrent(s_egl.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+b32 tf_egl_context_is_current(void) {
+    return s_egl.library && s_egl.GetCurrentContext() != EGL_NO_CONTEXT;
+}
+
+TF_ProcAddress tf_egl_get_proc_address(const char *name) {
+    if (!s_egl.library || s_egl.GetCurrentContext() == EGL_NO_CONTEXT) {
+        return TF_NULL;
+    }
+    return s_egl.GetProcAddress(name);
+}
+
+#else
+
+// EGL offscreen contexts are Linux-only; other platforms use hidden windows
+
+TF_EGLContext *tf_egl_context_create(void) {
+    return TF_NULL;
+}
+
+void tf_egl_context_destroy(TF_EGLContext *context) {
+    (void)context;
+}
+
+b32 tf_egl_context_make_current(TF_EGLContext *context) {
+    (void)context;
+    return TF_FALSE;
+}
+
+void tf_egl_context_release(void) {
+}
+
+b32 tf_egl_context_is_current(void) {
+    return TF_FALSE;
+}
+
+TF_ProcAddress tf_egl_get_proc_address(const char *name) {
+    (void)name;
+    return TF_NULL;
+}
+
+#endif
@@ -0,0 +1,37 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/platform/window.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Offscreen OpenGL 3.3 core context created through EGL without any display
+// server. libEGL is loaded at runtime, so builds and machines without it
+// simply report the path as unavailable (Linux only).
+typedef struct TF_EGLContext TF_EGLContext;
+
+// Surfaceless when the driver supports it, otherwise backed by a 1x1 pbuffer.
+// Either way rendering must go to a framebuffer object. Returns NULL if EGL
+// is missing or no suitable context can be created.
+TF_EGLContext *tf_egl_context_create(void);
+
+void tf_egl_context_destroy(TF_EGLContext *context);
+
+b32 tf_egl_context_make_current(TF_EGLContext *context);
+
+// Detach whatever EGL context is current on the calling thread
+void tf_egl_context_release(void);
+
+// Whether an EGL context is current on the calling thread
+b32 tf_egl_context_is_current(void);
+
+// Looks up a GL entry point for the current EGL context (NULL without one)
+TF_ProcAddress tf_egl_get_proc_address(const char *name);
+
+#ifdef __cplusplus
+}
+#endif
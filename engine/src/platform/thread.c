@@ -0,0 +1,253 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "tunafish/platform/thread.h"
+#include "tunafish/core/log.h"
+#include <stdlib.h>
+
+#ifdef TF_PLATFORM_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+// =============================================================================
+// Platform structures (implementation details)
+// =============================================================================
+
+struct TF_Thread {
+    TF_ThreadFunction function;
+    void *user_data;
+#ifdef TF_PLATFORM_WINDOWS
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+};
+
+struct TF_Mutex {
+#ifdef TF_PLATFORM_WINDOWS
+    SRWLOCK lock;
+#else
+    pthread_mutex_t lock;
+#endif
+};
+
+struct TF_Condition {
+#ifdef TF_PLATFORM_WINDOWS
+    CONDITION_VARIABLE variable;
+#else
+    pthread_cond_t variable;
+#endif
+};
+
+// =============================================================================
+// Threads
+// =============================================================================
+
+#ifdef TF_PLATFORM_WINDOWS
+static DWORD WINAPI tf_thread_entry(LPVOID parameter) {
+    TF_Thread *thread = (TF_Thread *)parameter;
+    thread->function(thread->user_data);
+    return 0;
+}
+#else
+static void *tf_thread_entry(void *parameter) {
+    TF_Thread *thread = (TF_Thread *)parameter;
+    thread->function(thread->user_data);
+    return NULL;
+}
+#endif
+
+TF_API TF_Thread *tf_thread_create(TF_ThreadFunction function, void *user_data) {
+    if (!function) {
+        TF_ERROR("Thread function cannot be null");
+        return TF_NULL;
+    }
+
+    TF_Thread *thread = (TF_Thread *)malloc(sizeof(TF_Thread));
+    if (!thread) {
+        TF_ERROR("Failed to allocate thread");
+        return TF_NULL;
+    }
+
+    thread->function = function;
+    thread->user_data = user_data;
+
+#ifdef TF_PLATFORM_WINDOWS
+    thread->handle = CreateThread(NULL, 0, tf_thread_entry, thread, 0, NULL);
+    if (!thread->handle) {
+#else
+    if (pthread_create(&thread->handle, NULL, tf_thread_entry, thread) != 0) {
+#endif
+        TF_ERROR("Failed to create thread");
+        free(thread);
+        return TF_NULL;
+    }
+
+    return thread;
+}
+
+TF_API void tf_thread_join(TF_Thread *thread) {
+    if (!thread) {
+        return;
+    }
+
+#ifdef TF_PLATFORM_WINDOWS
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+#else
+    pthread_join(thread->handle, NULL);
+#endif
+    free(thread);
+}
+
+TF_API u32 tf_thread_get_cpu_count(void) {
+#ifdef TF_PLATFORM_WINDOWS
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (u32)info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (u32)count : 1;
+#endif
+}
+
+TF_API void tf_thread_yield(void) {
+#ifdef TF_PLATFORM_WINDOWS
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+// =============================================================================
+// Mutexes
+// =============================================================================
+
+TF_API TF_Mutex *tf_mutex_create(void) {
+    TF_Mutex *mutex = (TF_Mutex *)malloc(sizeof(TF_Mutex));
+    if (!mutex) {
+        TF_ERROR("Failed to allocate mutex");
+        return TF_NULL;
+    }
+
+#ifdef TF_PLATFORM_WINDOWS
+    InitializeSRWLock(&mutex->lock);
+#else
+    pthread_mutex_init(&mutex->lock, NULL);
+#endif
+    return mutex;
+}
+
+TF_API void tf_mutex_destroy(TF_Mutex *mutex) {
+    if (!mutex) {
+        return;
+    }
+
+#ifndef TF_PLATFORM_WINDOWS
+    pthread_mutex_destroy(&mutex->lock);
+#endif
+    free(mutex);
+}
+
+TF_API void tf_mutex_lock(TF_Mutex *mutex) {
+#ifdef TF_PLATFORM_WINDOWS
+    AcquireSRWLockExclusive(&mutex->lock);
+#else
+    pthread_mutex_lock(&mutex->lock);
+#endif
+}
+
+TF_API void tf_mutex_unlock(TF_Mutex *mutex) {
+#ifdef TF_PLATFORM_WINDOWS
+    ReleaseSRWLockExclusive(&mutex->lock);
+#else
+    pthread_mutex_unlock(&mutex->lock);
+#endif
+}
+
+// =============================================================================
+// Condition variables
+// =============================================================================
+
+TF_API TF_Condition *tf_condition_create(void) {
+    TF_Condition *condition = (TF_Condition *)malloc(sizeof(TF_Condition));
+    if (!condition) {
+        TF_ERROR("Failed to allocate condition variable");
+        return TF_NULL;
+    }
+
+#ifdef TF_PLATFORM_WINDOWS
+    InitializeConditionVariable(&condition->variable);
+#else
+    pthread_cond_init(&condition->variable, NULL);
+#endif
+    return condition;
+}
+
+TF_API void tf_condition_destroy(TF_Condition *condition) {
+    if (!condition) {
+        return;
+    }
+
+#ifndef TF_PLATFORM_WINDOWS
+    pthread_cond_destroy(&condition->variable);
+#endif
+    free(condition);
+}
+
+TF_API void tf_condition_wait(TF_Condition *condition, TF_Mutex *mutex) {
+#ifdef TF_PLATFORM_WINDOWS
+    SleepConditionVariableSRW(&condition->variable, &mutex->lock, INFINITE, 0);
+#else
+    pthread_cond_wait(&condition->variable, &mutex->lock);
+#endif
+}
+
+TF_API void tf_condition_signal(TF_Condition *condition) {
+#ifdef TF_PLATFORM_WINDOWS
+    WakeConditionVariable(&condition->variable);
+#else
+    pthread_cond_signal(&condition->variable);
+#endif
+}
+
+TF_API void tf_condition_broadcast(TF_Condition *condition) {
+#ifdef TF_PLATFORM_WINDOWS
+    WakeAllConditionVariable(&condition->variable);
+#else
+    pthread_cond_broadcast(&condition->variable);
+#endif
+}
+
+// =============================================================================
+// Atomics
+// =============================================================================
+
+TF_API u32 tf_atomic_add_u32(volatile u32 *value, u32 amount) {
+#ifdef TF_COMPILER_MSVC
+    return (u32)InterlockedExchangeAdd((volatile LONG *)value, (LONG)amount);
+#else
+    return __atomic_fetch_add(value, amount, __ATOMIC_SEQ_CST);
+#endif
+}
+
+TF_API u32 tf_atomic_load_u32(const volatile u32 *value) {
+#ifdef TF_COMPILER_MSVC
+    return (u32)InterlockedCompareExchange((volatile LONG *)value, 0, 0);
+#else
+    return __atomic_load_n(value, __ATOMIC_SEQ_CST);
+#endif
+}
+
+TF_API void tf_atomic_store_u32(volatile u32 *value, u32 new_value) {
+#ifdef TF_COMPILER_MSVC
+    InterlockedExchange((volatile LONG *)value, (LONG)new_value);
+#else
+    __atomic_store_n(value, new_value, __ATOMIC_SEQ_CST);
+#endif
+}
@@ -2,6 +2,8 @@
 // Created by Preetiman Misra on 17/07/25.
 //
 #include "tunafish/platform/window.h"
+#include "platform/egl_context.h"
+#include "platform/window_internal.h"
 #include "tunafish/core/log.h"
 #include <GLFW/glfw3.h>
 #include <stdlib.h>
@@ -9,15 +11,48 @@
 // Window structure (implementation details)
 struct TF_Window {
     GLFWwindow *glfw_window;
+    TF_EGLContext *egl_context; // Set instead of glfw_window for EGL offscreen windows
+    b32 headless;
     u32 width;
     u32 height;
     char *title;
+    u32 presenters;        // Renderers that swap the buffers from end_frame
+    b32 warned_extra_swap;
 };
 
 // Global GLFW initialization state
 static b32 s_glfw_initialized = TF_FALSE;
 static u32 s_window_count = 0;
 
+// Offscreen window backed by an EGL context; never touches GLFW, so it works
+// without a display server
+static TF_Window *tf_window_create_egl(const TF_WindowConfig *config) {
+    TF_EGLContext *egl_context = tf_egl_context_create();
+    if (!egl_context) {
+        return TF_NULL;
+    }
+
+    if (!tf_egl_context_make_current(egl_context)) {
+        tf_egl_context_destroy(egl_context);
+        return TF_NULL;
+    }
+
+    TF_Window *window = (TF_Window *) calloc(1, sizeof(TF_Window));
+    if (!window) {
+        TF_ERROR("Failed to allocate memory for window");
+        tf_egl_context_destroy(egl_context);
+        return TF_NULL;
+    }
+
+    window->egl_context = egl_context;
+    window->headless = TF_TRUE;
+    window->width = config->width;
+    window->height = config->height;
+
+    TF_INFO("Offscreen window created: %s (%ux%u, EGL)", config->title, config->width, config->height);
+    return window;
+}
+
 // Initialize GLFW if not already done
 static b32 tf_window_init_glfw(void) {
     if (s_glfw_initialized) {
@@ -53,6 +88,15 @@ TF_API TF_Window *tf_window_create(const TF_WindowConfig *config) {
 
     TF_DEBUG("Creating window: %s (%ux%u)", config->title, config->width, config->height);
 
+    // Headless windows prefer EGL and fall back to a hidden GLFW window
+    if (config->headless) {
+        TF_Window *window = tf_window_create_egl(config);
+        if (window) {
+            return window;
+        }
+        TF_WARN("EGL offscreen context unavailable, using a hidden GLFW window");
+    }
+
     // Initialize GLFW
     if (!tf_window_init_glfw()) {
         return TF_NULL;
@@ -60,12 +104,13 @@ TF_API TF_Window *tf_window_create(const TF_WindowConfig *config) {
 
     // Set window hints
     glfwWindowHint(GLFW_RESIZABLE, config->resizable ? GLFW_TRUE : GLFW_FALSE);
+    glfwWindowHint(GLFW_VISIBLE, config->headless ? GLFW_FALSE : GLFW_TRUE);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
     // Create GLFW window
-    GLFWmonitor *monitor = config->fullscreen ? glfwGetPrimaryMonitor() : TF_NULL;
+    GLFWmonitor *monitor = config->fullscreen && !config->headless ? glfwGetPrimaryMonitor() : TF_NULL;
     GLFWwindow *glfw_window = glfwCreateWindow(
         (int) config->width,
         (int) config->height,
@@ -90,6 +135,8 @@ TF_API TF_Window *tf_window_create(const TF_WindowConfig *config) {
     }
 
     window->glfw_window = glfw_window;
+    window->egl_context = TF_NULL;
+    window->headless = config->headless;
     window->width = config->width;
     window->height = config->height;
     window->title = TF_NULL; // We'll set this if needed
@@ -110,6 +157,13 @@ TF_API void tf_window_destroy(TF_Window *window) {
 
     TF_DEBUG("Destroying window...");
 
+    if (window->egl_context) {
+        tf_egl_context_destroy(window->egl_context);
+        free(window->title);
+        free(window);
+        return;
+    }
+
     if (window->glfw_window) {
         glfwDestroyWindow(window->glfw_window);
     }
@@ -125,28 +179,77 @@ TF_API void tf_window_destroy(TF_Window *window) {
 }
 
 TF_API b32 tf_window_should_close(TF_Window *window) {
-    if (!window || !window->glfw_window) {
+    if (!window) {
         return TF_TRUE;
     }
 
+    // Offscreen windows have nothing the user could close
+    if (window->egl_context) {
+        return TF_FALSE;
+    }
+
     return glfwWindowShouldClose(window->glfw_window) ? TF_TRUE : TF_FALSE;
 }
 
 TF_API void tf_window_poll_events(TF_Window *window) {
     (void) window; // Unused parameter
-    glfwPollEvents();
+    if (s_glfw_initialized) {
+        glfwPollEvents();
+    }
 }
 
 TF_API void tf_window_swap_buffers(TF_Window *window) {
-    if (!window || !window->glfw_window) {
+    if (window && window->presenters > 0) {
+        if (!window->warned_extra_swap) {
+            TF_WARN("tf_window_swap_buffers ignored: the renderer already presents at end_frame");
+            window->warned_extra_swap = TF_TRUE;
+        }
+        return;
+    }
+
+    tf_window_present(window);
+}
+
+void tf_window_present(TF_Window *window) {
+    if (!window || !window->glfw_window || window->headless) {
         return;
     }
 
     glfwSwapBuffers(window->glfw_window);
 }
 
+void tf_window_add_presenter(TF_Window *window) {
+    if (window) {
+        window->presenters++;
+    }
+}
+
+void tf_window_remove_presenter(TF_Window *window) {
+    if (window && window->presenters > 0) {
+        window->presenters--;
+    }
+}
+
+TF_API b32 tf_window_set_swap_interval(TF_Window *window, i32 interval) {
+    if (!window) {
+        return TF_FALSE;
+    }
+    if (!window->glfw_window || window->headless) {
+        return TF_TRUE;
+    }
+
+    // Negative intervals rely on EXT_swap_control_tear
+    if (interval < 0 && !glfwExtensionSupported("WGL_EXT_swap_control_tear") &&
+        !glfwExtensionSupported("GLX_EXT_swap_control_tear")) {
+        return TF_FALSE;
+    }
+
+    glfwSwapInterval(interval);
+    return TF_TRUE;
+}
+
 TF_API void tf_window_get_size(TF_Window *window, u32 *width, u32 *height) {
-    if (!window || !window->glfw_window) {
+    if (!window) {
         if (width) *width = 0;
         if (height) *height = 0;
         return;
@@ -164,6 +267,47 @@ TF_API void tf_window_set_title(TF_Window *window, const char *title) {
     glfwSetWindowTitle(window->glfw_window, title);
 }
 
+TF_API b32 tf_window_is_headless(TF_Window *window) {
+    return window ? window->headless : TF_FALSE;
+}
+
+TF_API b32 tf_window_make_context_current(TF_Window *window) {
+    if (!window) {
+        return TF_FALSE;
+    }
+
+    if (window->egl_context) {
+        return tf_egl_context_make_current(window->egl_context);
+    }
+
+    glfwMakeContextCurrent(window->glfw_window);
+    return TF_TRUE;
+}
+
+TF_API void tf_window_release_context(TF_Window *window) {
+    if (!window) {
+        return;
+    }
+
+    if (window->egl_context) {
+        tf_egl_context_release();
+        return;
+    }
+
+    glfwMakeContextCurrent(TF_NULL);
+}
+
+TF_API TF_ProcAddress tf_window_get_proc_address(const char *name) {
+    if (s_glfw_initialized && glfwGetCurrentContext()) {
+        return (TF_ProcAddress) glfwGetProcAddress(name);
+    }
+    return tf_egl_get_proc_address(name);
+}
+
+TF_API b32 tf_window_has_current_context(void) {
+    return (s_glfw_initialized && glfwGetCurrentContext()) || tf_egl_context_is_current();
+}
+
 TF_API GLFWwindow *tf_window_get_glfw_window(TF_Window *window) {
     if (!window) {
         TF_WARN("Attempted to get GLFW handle from null window");
@@ -0,0 +1,23 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/platform/window.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Renderers that present from end_frame register with the window. While any
+// is registered, tf_window_swap_buffers warns once and does nothing, so an
+// older caller that still swaps after end_frame cannot present twice.
+void tf_window_add_presenter(TF_Window *window);
+void tf_window_remove_presenter(TF_Window *window);
+
+// Swap the window's buffers for a presenting renderer
+void tf_window_present(TF_Window *window);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,333 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "tunafish/renderer/backend/null/null_renderer.h"
+#include "renderer/mesh_internal.h"
+#include "tunafish/core/log.h"
+#include <stdlib.h>
+#include <string.h>
+
+// =============================================================================
+// Forward declarations
+// =============================================================================
+
+static b32 tf_null_create(TF_RendererBackend *backend, TF_Window *window, const TF_RendererConfig *config);
+static void tf_null_destroy(TF_RendererBackend *backend);
+static void tf_null_begin_frame(TF_RendererBackend *backend);
+static void tf_null_end_frame(TF_RendererBackend *backend);
+static void tf_null_clear(TF_RendererBackend *backend, TF_ClearFlags flags);
+static void tf_null_set_clear_color(TF_RendererBackend *backend, TF_Color color);
+static void tf_null_set_viewport(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height);
+static void tf_null_set_camera(TF_RendererBackend *backend, const TF_CameraUniforms *camera);
+static void tf_null_draw_triangle(TF_RendererBackend *backend, TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3, TF_Color color);
+static void tf_null_draw_meshes(TF_RendererBackend *backend, const TF_MeshDraw *draws, u32 count);
+static void tf_null_release_mesh(TF_RendererBackend *backend, TF_Mesh *mesh);
+static b32 tf_null_read_pixels(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height, void *pixels);
+static u32 tf_null_readback_begin(TF_RendererBackend *backend, u32 *width, u32 *height);
+static b32 tf_null_readback_end(TF_RendererBackend *backend, u32 ticket, void *pixels, b32 wait);
+static TF_RendererStats tf_null_get_stats(TF_RendererBackend *backend);
+
+// =============================================================================
+// VTable
+// =============================================================================
+
+static TF_RendererBackendVTable s_null_vtable = {
+    .create = tf_null_create,
+    .destroy = tf_null_destroy,
+    .begin_frame = tf_null_begin_frame,
+    .end_frame = tf_null_end_frame,
+    .clear = tf_null_clear,
+    .set_clear_color = tf_null_set_clear_color,
+    .set_viewport = tf_null_set_viewport,
+    .set_camera = tf_null_set_camera,
+    .draw_triangle = tf_null_draw_triangle,
+    .draw_meshes = tf_null_draw_meshes,
+    .release_mesh = tf_null_release_mesh,
+    .read_pixels = tf_null_read_pixels,
+    .readback_begin = tf_null_readback_begin,
+    .readback_end = tf_null_readback_end,
+    .get_stats = tf_null_get_stats
+};
+
+// =============================================================================
+// Backend creation
+// =============================================================================
+
+TF_RendererBackend *tf_renderer_backend_create_null(void) {
+    TF_DEBUG("Creating null renderer backend...");
+
+    TF_RendererBackend *backend = malloc(sizeof(TF_RendererBackend));
+    if (!backend) {
+        TF_ERROR("Failed to allocate null backend");
+        return NULL;
+    }
+
+    backend->vtable = &s_null_vtable;
+    backend->data = NULL;
+
+    return backend;
+}
+
+// =============================================================================
+// Implementation
+// =============================================================================
+
+// Close the current immediate-triangle batch, as the OpenGL backend would
+static void tf_null_flush_triangles(TF_NullData *null_data) {
+    if (null_data->pending_triangles == 0) return;
+
+    null_data->stats.draw_calls++;
+    null_data->stats.batch_flushes++;
+    null_data->stats.bytes_uploaded += (u64)null_data->pending_triangles * TF_NULL_TRIANGLE_BYTES;
+    null_data->pending_triangles = 0;
+}
+
+// Count a state call as issued when it changes the value, filtered otherwise
+static void tf_null_record_state(TF_NullData *null_data, b32 changed) {
+    if (changed) {
+        null_data->stats.state_calls_issued++;
+    } else {
+        null_data->stats.state_calls_filtered++;
+    }
+}
+
+static b32 tf_null_create(TF_RendererBackend *backend, TF_Window *window, const TF_RendererConfig *config) {
+    TF_DEBUG("Initializing null backend...");
+
+    TF_NullData *null_data = calloc(1, sizeof(TF_NullData));
+    if (!null_data) {
+        TF_ERROR("Failed to allocate null data");
+        return TF_FALSE;
+    }
+
+    null_data->viewport_width = config->width;
+    null_data->viewport_height = config->height;
+    backend->data = null_data;
+
+    (void)window;
+    TF_INFO("Null backend initialized (no graphics API calls will be made)");
+    return TF_TRUE;
+}
+
+static void tf_null_destroy(TF_RendererBackend *backend) {
+    if (!backend || !backend->data) return;
+
+    TF_DEBUG("Destroying null backend...");
+
+    // Meshes outlive the backend, detach the ones marked resident
+    TF_NullData *null_data = (TF_NullData *)backend->data;
+    for (u32 i = 0; i < null_data->mesh_count; i++) {
+        null_data->meshes[i]->gpu_owner = NULL;
+        null_data->meshes[i]->gpu_data = NULL;
+    }
+    free(null_data->meshes);
+    free(null_data->foreign_mesh_ids);
+
+    free(null_data);
+    backend->data = NULL;
+
+    TF_INFO("Null backend destroyed");
+}
+
+static void tf_null_begin_frame(TF_RendererBackend *backend) {
+    if (!backend || !backend->data) return;
+
+    TF_NullData *null_data = (TF_NullData *)backend->data;
+    null_data->stats = (TF_RendererStats){0};
+    null_data->stats.backend_calls++;
+}
+
+static void tf_null_end_frame(TF_RendererBackend *backend) {
+    if (!backend || !backend->data) return;
+
+    TF_NullData *null_data = (TF_NullData *)backend->data;
+    null_data->stats.backend_calls++;
+    tf_null_flush_triangles(null_data);
+}
+
+static void tf_null_clear(TF_RendererBackend *backend, TF_ClearFlags flags) {
+    if (!backend || !backend->data) return;
+
+    TF_NullData *null_data = (TF_NullData *)backend->data;
+    null_data->stats.backend_calls++;
+    tf_null_flush_triangles(null_data);
+    (void)flags;
+}
+
+static void tf_null_set_clear_color(TF_RendererBackend *backend, TF_Color color) {
+    if (!backend || !backend->data) return;
+
+    TF_NullData *null_data = (TF_NullData *)backend->data;
+    null_data->stats.backend_calls++;
+    tf_null_record_state(null_data, memcmp(&null_data->clear_color, &color, sizeof(TF_Color)) != 0);
+    null_data->clear_color = color;
+}
+
+static void tf_null_set_viewport(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height) {
+    if (!backend || !backend->data) return;
+
+    TF_NullData *null_data = (TF_NullData *)backend->data;
+    null_data->stats.backend_calls++;
+    tf_null_record_state(null_data, x != null_data->viewport_x || y != null_data->viewport_y ||
+                                    width != null_data->viewport_width || height != null_data->viewport_height);
+    null_data->viewport_x = x;
+    null_data->viewport_y = y;
+    null_data->viewport_width = width;
+    null_data->viewport_height = height;
+}
+
+static void tf_null_set_camera(TF_RendererBackend *backend, const TF_CameraUniforms *camera) {
+    if (!backend || !backend->data || !camera) return;
+
+    // A camera change closes the triangle batch and re-uploads the camera block
+    TF_NullData *null_data = (TF_NullData *)backend->data;
+    null_data->stats.backend_calls++;
+    b32 changed = !null_data->has_camera || memcmp(&null_data->camera, camera, sizeof(TF_CameraUniforms)) != 0;
+    tf_null_record_state(null_data, changed);
+    if (changed) {
+        tf_null_flush_triangles(null_data);
+        null_data->stats.bytes_uploaded += sizeof(TF_CameraUniforms);
+        null_data->camera = *camera;
+        null_data->has_camera = TF_TRUE;
+    }
+}
+
+static void tf_null_draw_triangle(TF_RendererBackend *backend, TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3, TF_Color color) {
+    if (!backend || !backend->data) return;
+
+    TF_NullData *null_data = (TF_NullData *)backend->data;
+    null_data->stats.backend_calls++;
+    null_data->stats.triangles++;
+    null_data->pending_triangles++;
+    (void)p1;
+    (void)p2;
+    (void)p3;
+    (void)color;
+}
+
+// Warn the first time a mesh owned by another renderer is drawn, not on every draw
+static void tf_null_warn_foreign(TF_NullData *null_data, TF_Mesh *mesh) {
+    for (u32 i = 0; i < null_data->foreign_count; i++) {
+        if (null_data->foreign_mesh_ids[i] == mesh->id) return;
+    }
+
+    TF_WARN("Mesh %u is already resident in another renderer", mesh->id);
+    if (null_data->foreign_count == null_data->foreign_capacity) {
+        u32 capacity = null_data->foreign_capacity ? null_data->foreign_capacity * 2 : 8;
+        u32 *ids = realloc(null_data->foreign_mesh_ids, sizeof(u32) * capacity);
+        if (!ids) return;
+        null_data->foreign_mesh_ids = ids;
+        null_data->foreign_capacity = capacity;
+    }
+    null_data->foreign_mesh_ids[null_data->foreign_count++] = mesh->id;
+}
+
+// First use counts the geometry upload; the mesh then stays resident
+static void tf_null_make_resident(TF_RendererBackend *backend, TF_NullData *null_data, TF_Mesh *mesh) {
+    if (mesh->gpu_owner) {
+        if (mesh->gpu_owner != backend) {
+            tf_null_warn_foreign(null_data, mesh);
+        }
+        return;
+    }
+
+    if (null_data->mesh_count == null_data->mesh_capacity) {
+        u32 capacity = null_data->mesh_capacity ? null_data->mesh_capacity * 2 : 64;
+        TF_Mesh **meshes = realloc(null_data->meshes, sizeof(TF_Mesh *) * capacity);
+        if (!meshes) {
+            TF_ERROR("Failed to grow mesh list");
+            return;
+        }
+        null_data->meshes = meshes;
+        null_data->mesh_capacity = capacity;
+    }
+
+    null_data->meshes[null_data->mesh_count++] = mesh;
+    mesh->gpu_owner = backend;
+    null_data->stats.bytes_uploaded += (u64)mesh->vertex_count * mesh->layout.stride +
+                                       (u64)mesh->index_count * sizeof(u32);
+}
+
+static void tf_null_draw_meshes(TF_RendererBackend *backend, const TF_MeshDraw *draws, u32 count) {
+    if (!backend || !backend->data || !draws) return;
+
+    // Recorded as one draw per entry, the upper bound a real backend would merge from
+    TF_NullData *null_data = (TF_NullData *)backend->data;
+    null_data->stats.backend_calls++;
+    tf_null_flush_triangles(null_data);
+
+    for (u32 i = 0; i < count; i++) {
+        const TF_MeshDraw *draw = &draws[i];
+        if (!draw->mesh || !draw->instances) continue;
+
+        u32 index_count = draw->range_count ? 0 : draw->mesh->index_count;
+        for (u32 r = 0; r < draw->range_count; r++) {
+            index_count += draw->ranges[r].index_count;
+        }
+
+        tf_null_make_resident(backend, null_data, draw->mesh);
+        null_data->stats.draw_calls++;
+        null_data->stats.instances += draw->instance_count;
+        null_data->stats.triangles += index_count / 3 * draw->instance_count;
+        null_data->stats.bytes_uploaded += (u64)draw->instance_count * sizeof(TF_InstanceData);
+    }
+}
+
+static void tf_null_release_mesh(TF_RendererBackend *backend, TF_Mesh *mesh) {
+    if (!backend || !backend->data || !mesh || mesh->gpu_owner != backend) return;
+
+    TF_NullData *null_data = (TF_NullData *)backend->data;
+    null_data->stats.backend_calls++;
+    for (u32 i = 0; i < null_data->mesh_count; i++) {
+        if (null_data->meshes[i] == mesh) {
+            null_data->meshes[i] = null_data->meshes[--null_data->mesh_count];
+            break;
+        }
+    }
+
+    mesh->gpu_owner = NULL;
+    mesh->gpu_data = NULL;
+}
+
+static b32 tf_null_read_pixels(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height, void *pixels) {
+    if (!backend || !backend->data) return TF_FALSE;
+
+    // Nothing is rendered, so there is nothing to read back
+    TF_NullData *null_data = (TF_NullData *)backend->data;
+    null_data->stats.backend_calls++;
+    (void)x;
+    (void)y;
+    (void)width;
+    (void)height;
+    (void)pixels;
+    return TF_FALSE;
+}
+
+static u32 tf_null_readback_begin(TF_RendererBackend *backend, u32 *width, u32 *height) {
+    if (!backend || !backend->data) return 0;
+
+    TF_NullData *null_data = (TF_NullData *)backend->data;
+    null_data->stats.backend_calls++;
+    *width = 0;
+    *height = 0;
+    return 0;
+}
+
+static b32 tf_null_readback_end(TF_RendererBackend *backend, u32 ticket, void *pixels, b32 wait) {
+    if (!backend || !backend->data) return TF_FALSE;
+
+    TF_NullData *null_data = (TF_NullData *)backend->data;
+    null_data->stats.backend_calls++;
+    (void)ticket;
+    (void)pixels;
+    (void)wait;
+    return TF_FALSE;
+}
+
+static TF_RendererStats tf_null_get_stats(TF_RendererBackend *backend) {
+    if (!backend || !backend->data) return (TF_RendererStats){0};
+
+    // Not counted itself, so reading the stats doesn't change them
+    TF_NullData *null_data = (TF_NullData *)backend->data;
+    return null_data->stats;
+}
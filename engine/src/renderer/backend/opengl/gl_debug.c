@@ -0,0 +1,482 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "renderer/backend/opengl/gl_debug.h"
+#include "renderer/backend/opengl/gl_extensions.h"
+#include "tunafish/core/export.h"
+#include "tunafish/core/log.h"
+#include <glad/gl.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if TF_IS_DEBUG
+
+#define TF_GL_DEBUG_TEXTURE_UNITS 32
+#define TF_GL_DEBUG_TEXTURE_TARGETS 4  // 2D, 3D, cube map, 2D array
+#define TF_GL_DEBUG_BUFFER_TARGETS 5   // Bindings that are not vertex array state
+#define TF_GL_DEBUG_LOGGED_MESSAGES 128 // Distinct driver messages logged before going quiet
+#define TF_GL_DEBUG_UNKNOWN 0xFFFFFFFFu
+
+// Entry points resolved by gl_extensions rather than glad (all return void)
+#define TF_GL_EXTENSION_ENTRY_POINTS                                                                           \
+    TF_GL_ENTRY_VOID(BufferStorage, TF_PFNGLBUFFERSTORAGEPROC,                                                 \
+        (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags), (target, size, data, flags))     \
+    TF_GL_ENTRY_VOID(GetProgramBinary, TF_PFNGLGETPROGRAMBINARYPROC,                                           \
+        (GLuint program, GLsizei buf_size, GLsizei *length, GLenum *binary_format, void *binary),              \
+        (program, buf_size, length, binary_format, binary))                                                    \
+    TF_GL_ENTRY_VOID(ProgramBinary, TF_PFNGLPROGRAMBINARYPROC,                                                 \
+        (GLuint program, GLenum binary_format, const void *binary, GLsizei length),                            \
+        (program, binary_format, binary, length))                                                              \
+    TF_GL_ENTRY_VOID(ProgramParameteri, TF_PFNGLPROGRAMPARAMETERIPROC,                                         \
+        (GLuint program, GLenum pname, GLint value), (program, pname, value))                                  \
+    TF_GL_ENTRY_VOID(MaxShaderCompilerThreads, TF_PFNGLMAXSHADERCOMPILERTHREADSKHRPROC,                        \
+        (GLuint count), (count))                                                                               \
+    TF_GL_ENTRY_VOID(DrawElementsInstancedBaseVertexBaseInstance,                                              \
+        TF_PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC,                                               \
+        (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instance_count,                 \
+         GLint base_vertex, GLuint base_instance),                                                             \
+        (mode, count, type, indices, instance_count, base_vertex, base_instance))
+
+// =============================================================================
+// Entry point table
+// =============================================================================
+
+#define TF_GL_ENTRY(ret, name, type, params, args) TF_GL_CALL_##name,
+#define TF_GL_ENTRY_VOID(name, type, params, args) TF_GL_CALL_##name,
+typedef enum {
+#include "renderer/backend/opengl/gl_entry_points.h"
+    TF_GL_EXTENSION_ENTRY_POINTS
+    TF_GL_CALL_COUNT
+} TF_GLCall;
+#undef TF_GL_ENTRY
+#undef TF_GL_ENTRY_VOID
+
+#define TF_GL_ENTRY(ret, name, type, params, args) "gl" #name,
+#define TF_GL_ENTRY_VOID(name, type, params, args) "gl" #name,
+static const char *s_call_names[TF_GL_CALL_COUNT] = {
+#include "renderer/backend/opengl/gl_entry_points.h"
+    TF_GL_EXTENSION_ENTRY_POINTS
+};
+#undef TF_GL_ENTRY
+#undef TF_GL_ENTRY_VOID
+
+static struct {
+    u32 users;
+
+    // Counters since the last reset
+    u32 counts[TF_GL_CALL_COUNT];
+    u32 redundant_binds;
+    u32 texture_binds;
+    u32 messages;
+    u32 performance_messages;
+
+    // Last value of each tracked binding (TF_GL_DEBUG_UNKNOWN = not known)
+    u32 program;
+    u32 vertex_array;
+    u32 draw_framebuffer;
+    u32 read_framebuffer;
+    u32 buffers[TF_GL_DEBUG_BUFFER_TARGETS];
+    u32 active_texture;
+    u32 textures[TF_GL_DEBUG_TEXTURE_UNITS][TF_GL_DEBUG_TEXTURE_TARGETS];
+
+    // Driver messages already logged
+    u64 logged_messages[TF_GL_DEBUG_LOGGED_MESSAGES];
+    u32 logged_count;
+} s_debug;
+
+// =============================================================================
+// Counting wrappers
+// =============================================================================
+
+#define TF_GL_ENTRY(ret, name, type, params, args)      \
+    static type s_real_##name;                          \
+    static ret GLAD_API_PTR tf_gl_debug_##name params { \
+        s_debug.counts[TF_GL_CALL_##name]++;            \
+        return s_real_##name args;                      \
+    }
+#define TF_GL_ENTRY_VOID(name, type, params, args)       \
+    static type s_real_##name;                           \
+    static void GLAD_API_PTR tf_gl_debug_##name params { \
+        s_debug.counts[TF_GL_CALL_##name]++;             \
+        s_real_##name args;                              \
+    }
+#include "renderer/backend/opengl/gl_entry_points.h"
+TF_GL_EXTENSION_ENTRY_POINTS
+#undef TF_GL_ENTRY
+#undef TF_GL_ENTRY_VOID
+
+// =============================================================================
+// Binding tracking
+// =============================================================================
+
+// Binds go through these instead of the plain wrappers: a bind that leaves the
+// binding as it was still costs a driver call, which is what gets reported.
+// Deleting objects can change bindings implicitly, so deletes forget them.
+
+static void tf_gl_debug_track(u32 *binding, u32 value) {
+    if (*binding == value) {
+        s_debug.redundant_binds++;
+    }
+    *binding = value;
+}
+
+static u32 *tf_gl_debug_buffer_binding(GLenum target) {
+    switch (target) {
+        case GL_ARRAY_BUFFER: return &s_debug.buffers[0];
+        case GL_COPY_READ_BUFFER: return &s_debug.buffers[1];
+        case GL_COPY_WRITE_BUFFER: return &s_debug.buffers[2];
+        case GL_PIXEL_PACK_BUFFER: return &s_debug.buffers[3];
+        case GL_PIXEL_UNPACK_BUFFER: return &s_debug.buffers[4];
+        default: return NULL;
+    }
+}
+
+static u32 *tf_gl_debug_texture_binding(GLenum target) {
+    u32 unit = s_debug.active_texture - GL_TEXTURE0;
+    if (s_debug.active_texture == TF_GL_DEBUG_UNKNOWN || unit >= TF_GL_DEBUG_TEXTURE_UNITS) {
+        return NULL;
+    }
+
+    switch (target) {
+        case GL_TEXTURE_2D: return &s_debug.textures[unit][0];
+        case GL_TEXTURE_3D: return &s_debug.textures[unit][1];
+        case GL_TEXTURE_CUBE_MAP: return &s_debug.textures[unit][2];
+        case GL_TEXTURE_2D_ARRAY: return &s_debug.textures[unit][3];
+        default: return NULL;
+    }
+}
+
+static void tf_gl_debug_forget_bindings(void) {
+    s_debug.program = TF_GL_DEBUG_UNKNOWN;
+    s_debug.vertex_array = TF_GL_DEBUG_UNKNOWN;
+    s_debug.draw_framebuffer = TF_GL_DEBUG_UNKNOWN;
+    s_debug.read_framebuffer = TF_GL_DEBUG_UNKNOWN;
+    memset(s_debug.buffers, 0xFF, sizeof(s_debug.buffers));
+    s_debug.active_texture = TF_GL_DEBUG_UNKNOWN;
+    memset(s_debug.textures, 0xFF, sizeof(s_debug.textures));
+}
+
+static void GLAD_API_PTR tf_gl_debug_track_UseProgram(GLuint program) {
+    s_debug.counts[TF_GL_CALL_UseProgram]++;
+    tf_gl_debug_track(&s_debug.program, program);
+    s_real_UseProgram(program);
+}
+
+static void GLAD_API_PTR tf_gl_debug_track_BindVertexArray(GLuint array) {
+    s_debug.counts[TF_GL_CALL_BindVertexArray]++;
+    tf_gl_debug_track(&s_debug.vertex_array, array);
+    s_real_BindVertexArray(array);
+}
+
+static void GLAD_API_PTR tf_gl_debug_track_BindFramebuffer(GLenum target, GLuint framebuffer) {
+    s_debug.counts[TF_GL_CALL_BindFramebuffer]++;
+    b32 draw = target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER;
+    b32 read = target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER;
+    if ((!draw || s_debug.draw_framebuffer == framebuffer) && (!read || s_debug.read_framebuffer == framebuffer)) {
+        s_debug.redundant_binds++;
+    }
+    if (draw) s_debug.draw_framebuffer = framebuffer;
+    if (read) s_debug.read_framebuffer = framebuffer;
+    s_real_BindFramebuffer(target, framebuffer);
+}
+
+static void GLAD_API_PTR tf_gl_debug_track_BindBuffer(GLenum target, GLuint buffer) {
+    s_debug.counts[TF_GL_CALL_BindBuffer]++;
+    u32 *binding = tf_gl_debug_buffer_binding(target);
+    if (binding) {
+        tf_gl_debug_track(binding, buffer);
+    }
+    s_real_BindBuffer(target, buffer);
+}
+
+static void GLAD_API_PTR tf_gl_debug_track_ActiveTexture(GLenum texture) {
+    s_debug.counts[TF_GL_CALL_ActiveTexture]++;
+    tf_gl_debug_track(&s_debug.active_texture, texture);
+    s_real_ActiveTexture(texture);
+}
+
+static void GLAD_API_PTR tf_gl_debug_track_BindTexture(GLenum target, GLuint texture) {
+    s_debug.counts[TF_GL_CALL_BindTexture]++;
+    s_debug.texture_binds++;
+    u32 *binding = tf_gl_debug_texture_binding(target);
+    if (binding) {
+        tf_gl_debug_track(binding, texture);
+    }
+    s_real_BindTexture(target, texture);
+}
+
+static void GLAD_API_PTR tf_gl_debug_track_DeleteProgram(GLuint program) {
+    s_debug.counts[TF_GL_CALL_DeleteProgram]++;
+    s_debug.program = TF_GL_DEBUG_UNKNOWN;
+    s_real_DeleteProgram(program);
+}
+
+static void GLAD_API_PTR tf_gl_debug_track_DeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    s_debug.counts[TF_GL_CALL_DeleteVertexArrays]++;
+    s_debug.vertex_array = TF_GL_DEBUG_UNKNOWN;
+    s_real_DeleteVertexArrays(n, arrays);
+}
+
+static void GLAD_API_PTR tf_gl_debug_track_DeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+    s_debug.counts[TF_GL_CALL_DeleteFramebuffers]++;
+    s_debug.draw_framebuffer = TF_GL_DEBUG_UNKNOWN;
+    s_debug.read_framebuffer = TF_GL_DEBUG_UNKNOWN;
+    s_real_DeleteFramebuffers(n, framebuffers);
+}
+
+static void GLAD_API_PTR tf_gl_debug_track_DeleteBuffers(GLsizei n, const GLuint *buffers) {
+    s_debug.counts[TF_GL_CALL_DeleteBuffers]++;
+    memset(s_debug.buffers, 0xFF, sizeof(s_debug.buffers));
+    s_real_DeleteBuffers(n, buffers);
+}
+
+static void GLAD_API_PTR tf_gl_debug_track_DeleteTextures(GLsizei n, const GLuint *textures) {
+    s_debug.counts[TF_GL_CALL_DeleteTextures]++;
+    memset(s_debug.textures, 0xFF, sizeof(s_debug.textures));
+    s_real_DeleteTextures(n, textures);
+}
+
+// =============================================================================
+// Driver messages
+// =============================================================================
+
+static const char *tf_gl_debug_type_name(GLenum type) {
+    switch (type) {
+        case GL_DEBUG_TYPE_ERROR: return "error";
+        case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "deprecated behavior";
+        case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "undefined behavior";
+        case GL_DEBUG_TYPE_PORTABILITY: return "portability";
+        case GL_DEBUG_TYPE_PERFORMANCE: return "performance";
+        default: return "message";
+    }
+}
+
+// Drivers repeat the same warning every frame, so each one is logged once
+static b32 tf_gl_debug_first_sighting(GLenum source, GLenum type, GLuint id) {
+    u64 key = ((u64)(source & 0xFFFF) << 48) | ((u64)(type & 0xFFFF) << 32) | id;
+    for (u32 i = 0; i < s_debug.logged_count; i++) {
+        if (s_debug.logged_messages[i] == key) {
+            return TF_FALSE;
+        }
+    }
+
+    if (s_debug.logged_count == TF_GL_DEBUG_LOGGED_MESSAGES) {
+        return TF_FALSE;
+    }
+    s_debug.logged_messages[s_debug.logged_count++] = key;
+    if (s_debug.logged_count == TF_GL_DEBUG_LOGGED_MESSAGES) {
+        TF_WARN("%u distinct GL debug messages seen, only counting from now on", TF_GL_DEBUG_LOGGED_MESSAGES);
+    }
+    return TF_TRUE;
+}
+
+static void GLAD_API_PTR tf_gl_debug_message(GLenum source, GLenum type, GLuint id, GLenum severity,
+                                             GLsizei length, const GLchar *message, const void *user_param) {
+    (void)user_param;
+    if (severity == GL_DEBUG_SEVERITY_NOTIFICATION) return;
+
+    s_debug.messages++;
+    if (type == GL_DEBUG_TYPE_PERFORMANCE) {
+        s_debug.performance_messages++;
+    }
+    if (!tf_gl_debug_first_sighting(source, type, id)) return;
+
+    int message_length = length < 0 ? (int)strlen(message) : (int)length;
+    if (type == GL_DEBUG_TYPE_ERROR || severity == GL_DEBUG_SEVERITY_HIGH) {
+        TF_ERROR("GL %s (id %u): %.*s", tf_gl_debug_type_name(type), id, message_length, message);
+    } else {
+        TF_WARN("GL %s (id %u): %.*s", tf_gl_debug_type_name(type), id, message_length, message);
+    }
+}
+
+// =============================================================================
+// Installation
+// =============================================================================
+
+// Synchronous delivery keeps the callback on the calling thread, so the
+// counters need no locking and a breakpoint lands on the offending call.
+// Debug output is context state, so every installing context sets it up.
+static void tf_gl_debug_enable_output(TF_GLExtensions *extensions) {
+    if (extensions->debug_output) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+        extensions->glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, NULL,
+                                          GL_FALSE);
+        extensions->glDebugMessageCallback(tf_gl_debug_message, NULL);
+    } else {
+        TF_WARN("KHR_debug unavailable, GL driver messages will not be reported");
+    }
+}
+
+// Swap in the wrappers wherever the loaders left a driver pointer: all of
+// them on first install, again after glad or the extensions were reloaded
+static void tf_gl_debug_wrap(TF_GLExtensions *extensions) {
+    if (glad_glUseProgram != tf_gl_debug_track_UseProgram) {
+#define TF_GL_ENTRY(ret, name, type, params, args) \
+    if (glad_gl##name) {                           \
+        s_real_##name = glad_gl##name;             \
+        glad_gl##name = tf_gl_debug_##name;        \
+    }
+#define TF_GL_ENTRY_VOID(name, type, params, args) TF_GL_ENTRY(void, name, type, params, args)
+#include "renderer/backend/opengl/gl_entry_points.h"
+#undef TF_GL_ENTRY
+#undef TF_GL_ENTRY_VOID
+
+        // Binds and deletes also track bindings
+        glad_glUseProgram = tf_gl_debug_track_UseProgram;
+        glad_glBindVertexArray = tf_gl_debug_track_BindVertexArray;
+        glad_glBindFramebuffer = tf_gl_debug_track_BindFramebuffer;
+        glad_glBindBuffer = tf_gl_debug_track_BindBuffer;
+        glad_glActiveTexture = tf_gl_debug_track_ActiveTexture;
+        glad_glBindTexture = tf_gl_debug_track_BindTexture;
+        glad_glDeleteProgram = tf_gl_debug_track_DeleteProgram;
+        glad_glDeleteVertexArrays = tf_gl_debug_track_DeleteVertexArrays;
+        glad_glDeleteFramebuffers = tf_gl_debug_track_DeleteFramebuffers;
+        glad_glDeleteBuffers = tf_gl_debug_track_DeleteBuffers;
+        glad_glDeleteTextures = tf_gl_debug_track_DeleteTextures;
+
+        // A reload means another context, whose bindings are unknown
+        tf_gl_debug_forget_bindings();
+    }
+
+#define TF_GL_ENTRY_VOID(name, type, params, args)                              \
+    if (extensions->gl##name && extensions->gl##name != tf_gl_debug_##name) { \
+        s_real_##name = extensions->gl##name;                                   \
+        extensions->gl##name = tf_gl_debug_##name;                              \
+    }
+    TF_GL_EXTENSION_ENTRY_POINTS
+#undef TF_GL_ENTRY_VOID
+}
+
+b32 tf_gl_debug_install(void) {
+    TF_GLExtensions *extensions = tf_gl_extensions_get_entry_points();
+    tf_gl_debug_wrap(extensions);
+    tf_gl_debug_enable_output(extensions);
+    if (s_debug.users++ > 0) {
+        return TF_TRUE;
+    }
+
+    tf_gl_debug_reset_stats();
+    TF_INFO("GL debug layer installed (%u entry points wrapped)", TF_GL_CALL_COUNT);
+    return TF_TRUE;
+}
+
+void tf_gl_debug_refresh(void) {
+    if (s_debug.users > 0) {
+        tf_gl_debug_wrap(tf_gl_extensions_get_entry_points());
+    }
+}
+
+void tf_gl_debug_uninstall(void) {
+    if (s_debug.users == 0) {
+        return;
+    }
+
+    // Output was enabled on the context of every install, this one included
+    TF_GLExtensions *extensions = tf_gl_extensions_get_entry_points();
+    if (extensions->debug_output) {
+        extensions->glDebugMessageCallback(NULL, NULL);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+        glDisable(GL_DEBUG_OUTPUT);
+    }
+    if (--s_debug.users > 0) {
+        return;
+    }
+
+#define TF_GL_ENTRY(ret, name, type, params, args) \
+    if (s_real_##name) {                           \
+        glad_gl##name = s_real_##name;             \
+        s_real_##name = NULL;                      \
+    }
+#define TF_GL_ENTRY_VOID(name, type, params, args) TF_GL_ENTRY(void, name, type, params, args)
+#include "renderer/backend/opengl/gl_entry_points.h"
+#undef TF_GL_ENTRY
+#undef TF_GL_ENTRY_VOID
+
+#define TF_GL_ENTRY_VOID(name, type, params, args) \
+    if (s_real_##name) {                           \
+        extensions->gl##name = s_real_##name;      \
+        s_real_##name = NULL;                      \
+    }
+    TF_GL_EXTENSION_ENTRY_POINTS
+#undef TF_GL_ENTRY_VOID
+
+    TF_INFO("GL debug layer removed");
+}
+
+// =============================================================================
+// Statistics
+// =============================================================================
+
+void tf_gl_debug_reset_stats(void) {
+    memset(s_debug.counts, 0, sizeof(s_debug.counts));
+    s_debug.redundant_binds = 0;
+    s_debug.texture_binds = 0;
+    s_debug.messages = 0;
+    s_debug.performance_messages = 0;
+}
+
+TF_GLDebugStats tf_gl_debug_get_stats(void) {
+    TF_GLDebugStats stats = {0};
+    for (u32 i = 0; i < TF_GL_CALL_COUNT; i++) {
+        stats.calls += s_debug.counts[i];
+    }
+    stats.redundant_binds = s_debug.redundant_binds;
+    stats.texture_binds = s_debug.texture_binds;
+    stats.messages = s_debug.messages;
+    stats.performance_messages = s_debug.performance_messages;
+    return stats;
+}
+
+static int tf_gl_debug_compare_calls(const void *a, const void *b) {
+    u32 count_a = ((const TF_APICallCount *)a)->count;
+    u32 count_b = ((const TF_APICallCount *)b)->count;
+    return count_a < count_b ? 1 : count_a > count_b ? -1 : 0;
+}
+
+u32 tf_gl_debug_get_calls(TF_APICallCount *calls, u32 max_calls) {
+    if (!calls || max_calls == 0) return 0;
+
+    TF_APICallCount called[TF_GL_CALL_COUNT];
+    u32 count = 0;
+    for (u32 i = 0; i < TF_GL_CALL_COUNT; i++) {
+        if (s_debug.counts[i] > 0) {
+            called[count++] = (TF_APICallCount){s_call_names[i], s_debug.counts[i]};
+        }
+    }
+
+    qsort(called, count, sizeof(TF_APICallCount), tf_gl_debug_compare_calls);
+    if (count > max_calls) {
+        count = max_calls;
+    }
+    memcpy(calls, called, sizeof(TF_APICallCount) * count);
+    return count;
+}
+
+#else
+
+b32 tf_gl_debug_install(void) {
+    TF_WARN("GL debug layer is only available in debug builds");
+    return TF_FALSE;
+}
+
+void tf_gl_debug_refresh(void) {
+}
+
+void tf_gl_debug_uninstall(void) {
+}
+
+void tf_gl_debug_reset_stats(void) {
+}
+
+TF_GLDebugStats tf_gl_debug_get_stats(void) {
+    return (TF_GLDebugStats){0};
+}
+
+u32 tf_gl_debug_get_calls(TF_APICallCount *calls, u32 max_calls) {
+    (void)calls;
+    (void)max_calls;
+    return 0;
+}
+
+#endif
@@ -0,0 +1,59 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include "tunafish/renderer/renderer_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// Debug layer - GL call counting and driver messages
+// =============================================================================
+
+// Debug builds only (TF_IS_DEBUG). Installing swaps every glad entry point,
+// and the extension entry points, for a wrapper that counts the call and
+// forwards it, so the counts cover everything the engine and user code send
+// to the driver. Binds are also checked against the previous binding to find
+// the ones the driver receives for nothing. With KHR_debug, driver errors and
+// performance warnings are logged (once per message id) and counted.
+//
+// glad's function pointers are process-wide, so the layer is too: it is
+// installed once and shared by every OpenGL renderer that asks for it. Each
+// renderer loads glad again for its context, which drops the wrappers, so
+// installing again (or refreshing) wraps the new pointers; driver messages
+// are enabled per installing context.
+
+typedef struct {
+    u32 calls;               // GL calls since the last reset
+    u32 redundant_binds;     // Binds that left the binding unchanged
+    u32 texture_binds;
+    u32 messages;            // KHR_debug messages (notifications excluded)
+    u32 performance_messages;
+} TF_GLDebugStats;
+
+// TF_FALSE in release builds. Call with the context current, after
+// tf_gl_extensions_load.
+b32 tf_gl_debug_install(void);
+
+// Wrap entry points reloaded since the layer was installed (no-op when it is not)
+void tf_gl_debug_refresh(void);
+
+// Stop driver messages on the current context, and restore the original entry
+// points once the last user is gone
+void tf_gl_debug_uninstall(void);
+
+void tf_gl_debug_reset_stats(void);
+
+TF_GLDebugStats tf_gl_debug_get_stats(void);
+
+// Entry points called since the last reset, most called first. Returns the
+// number written, at most max_calls.
+u32 tf_gl_debug_get_calls(TF_APICallCount *calls, u32 max_calls);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,597 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+// Every entry point of the GL 3.3 core loader (vendor/glad) as an X-macro
+// list, for the debug layer. No include guard: define TF_GL_ENTRY and
+// TF_GL_ENTRY_VOID before each inclusion. Regenerate alongside glad.
+//
+//   TF_GL_ENTRY(return type, name without "gl", glad function type, parameters, arguments)
+//   TF_GL_ENTRY_VOID(name without "gl", glad function type, parameters, arguments)
+//
+
+TF_GL_ENTRY_VOID(ActiveTexture, PFNGLACTIVETEXTUREPROC, (GLenum texture), (texture))
+TF_GL_ENTRY_VOID(AttachShader, PFNGLATTACHSHADERPROC, (GLuint program, GLuint shader), (program, shader))
+TF_GL_ENTRY_VOID(BeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC, (GLuint id, GLenum mode), (id, mode))
+TF_GL_ENTRY_VOID(BeginQuery, PFNGLBEGINQUERYPROC, (GLenum target, GLuint id), (target, id))
+TF_GL_ENTRY_VOID(BeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC, (GLenum primitiveMode), (primitiveMode))
+TF_GL_ENTRY_VOID(BindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC,
+    (GLuint program, GLuint index, const GLchar *name), (program, index, name))
+TF_GL_ENTRY_VOID(BindBuffer, PFNGLBINDBUFFERPROC, (GLenum target, GLuint buffer), (target, buffer))
+TF_GL_ENTRY_VOID(BindBufferBase, PFNGLBINDBUFFERBASEPROC,
+    (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+TF_GL_ENTRY_VOID(BindBufferRange, PFNGLBINDBUFFERRANGEPROC,
+    (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size),
+    (target, index, buffer, offset, size))
+TF_GL_ENTRY_VOID(BindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC,
+    (GLuint program, GLuint color, const GLchar *name), (program, color, name))
+TF_GL_ENTRY_VOID(BindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC,
+    (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name), (program, colorNumber, index, name))
+TF_GL_ENTRY_VOID(BindFramebuffer, PFNGLBINDFRAMEBUFFERPROC, (GLenum target, GLuint framebuffer), (target, framebuffer))
+TF_GL_ENTRY_VOID(BindRenderbuffer, PFNGLBINDRENDERBUFFERPROC,
+    (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+TF_GL_ENTRY_VOID(BindSampler, PFNGLBINDSAMPLERPROC, (GLuint unit, GLuint sampler), (unit, sampler))
+TF_GL_ENTRY_VOID(BindTexture, PFNGLBINDTEXTUREPROC, (GLenum target, GLuint texture), (target, texture))
+TF_GL_ENTRY_VOID(BindVertexArray, PFNGLBINDVERTEXARRAYPROC, (GLuint array), (array))
+TF_GL_ENTRY_VOID(BlendColor, PFNGLBLENDCOLORPROC,
+    (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+TF_GL_ENTRY_VOID(BlendEquation, PFNGLBLENDEQUATIONPROC, (GLenum mode), (mode))
+TF_GL_ENTRY_VOID(BlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC,
+    (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha))
+TF_GL_ENTRY_VOID(BlendFunc, PFNGLBLENDFUNCPROC, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor))
+TF_GL_ENTRY_VOID(BlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC,
+    (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha),
+    (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+TF_GL_ENTRY_VOID(BlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC,
+    (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1,
+        GLbitfield mask, GLenum filter),
+    (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+TF_GL_ENTRY_VOID(BufferData, PFNGLBUFFERDATAPROC,
+    (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage))
+TF_GL_ENTRY_VOID(BufferSubData, PFNGLBUFFERSUBDATAPROC,
+    (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data))
+TF_GL_ENTRY(GLenum, CheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC, (GLenum target), (target))
+TF_GL_ENTRY_VOID(ClampColor, PFNGLCLAMPCOLORPROC, (GLenum target, GLenum clamp), (target, clamp))
+TF_GL_ENTRY_VOID(Clear, PFNGLCLEARPROC, (GLbitfield mask), (mask))
+TF_GL_ENTRY_VOID(ClearBufferfi, PFNGLCLEARBUFFERFIPROC,
+    (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil))
+TF_GL_ENTRY_VOID(ClearBufferfv, PFNGLCLEARBUFFERFVPROC,
+    (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value))
+TF_GL_ENTRY_VOID(ClearBufferiv, PFNGLCLEARBUFFERIVPROC,
+    (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value))
+TF_GL_ENTRY_VOID(ClearBufferuiv, PFNGLCLEARBUFFERUIVPROC,
+    (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value))
+TF_GL_ENTRY_VOID(ClearColor, PFNGLCLEARCOLORPROC,
+    (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+TF_GL_ENTRY_VOID(ClearDepth, PFNGLCLEARDEPTHPROC, (GLdouble depth), (depth))
+TF_GL_ENTRY_VOID(ClearStencil, PFNGLCLEARSTENCILPROC, (GLint s), (s))
+TF_GL_ENTRY(GLenum, ClientWaitSync, PFNGLCLIENTWAITSYNCPROC,
+    (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+TF_GL_ENTRY_VOID(ColorMask, PFNGLCOLORMASKPROC,
+    (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+TF_GL_ENTRY_VOID(ColorMaski, PFNGLCOLORMASKIPROC,
+    (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a))
+TF_GL_ENTRY_VOID(CompileShader, PFNGLCOMPILESHADERPROC, (GLuint shader), (shader))
+TF_GL_ENTRY_VOID(CompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC,
+    (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize,
+        const void *data),
+    (target, level, internalformat, width, border, imageSize, data))
+TF_GL_ENTRY_VOID(CompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC,
+    (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize,
+        const void *data),
+    (target, level, internalformat, width, height, border, imageSize, data))
+TF_GL_ENTRY_VOID(CompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC,
+    (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border,
+        GLsizei imageSize, const void *data),
+    (target, level, internalformat, width, height, depth, border, imageSize, data))
+TF_GL_ENTRY_VOID(CompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC,
+    (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data),
+    (target, level, xoffset, width, format, imageSize, data))
+TF_GL_ENTRY_VOID(CompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC,
+    (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format,
+        GLsizei imageSize, const void *data),
+    (target, level, xoffset, yoffset, width, height, format, imageSize, data))
+TF_GL_ENTRY_VOID(CompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC,
+    (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height,
+        GLsizei depth, GLenum format, GLsizei imageSize, const void *data),
+    (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+TF_GL_ENTRY_VOID(CopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC,
+    (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size),
+    (readTarget, writeTarget, readOffset, writeOffset, size))
+TF_GL_ENTRY_VOID(CopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC,
+    (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border),
+    (target, level, internalformat, x, y, width, border))
+TF_GL_ENTRY_VOID(CopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC,
+    (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border),
+    (target, level, internalformat, x, y, width, height, border))
+TF_GL_ENTRY_VOID(CopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC,
+    (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width))
+TF_GL_ENTRY_VOID(CopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC,
+    (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height),
+    (target, level, xoffset, yoffset, x, y, width, height))
+TF_GL_ENTRY_VOID(CopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC,
+    (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width,
+        GLsizei height),
+    (target, level, xoffset, yoffset, zoffset, x, y, width, height))
+TF_GL_ENTRY(GLuint, CreateProgram, PFNGLCREATEPROGRAMPROC, (void), ())
+TF_GL_ENTRY(GLuint, CreateShader, PFNGLCREATESHADERPROC, (GLenum type), (type))
+TF_GL_ENTRY_VOID(CullFace, PFNGLCULLFACEPROC, (GLenum mode), (mode))
+TF_GL_ENTRY_VOID(DeleteBuffers, PFNGLDELETEBUFFERSPROC, (GLsizei n, const GLuint *buffers), (n, buffers))
+TF_GL_ENTRY_VOID(DeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC,
+    (GLsizei n, const GLuint *framebuffers), (n, framebuffers))
+TF_GL_ENTRY_VOID(DeleteProgram, PFNGLDELETEPROGRAMPROC, (GLuint program), (program))
+TF_GL_ENTRY_VOID(DeleteQueries, PFNGLDELETEQUERIESPROC, (GLsizei n, const GLuint *ids), (n, ids))
+TF_GL_ENTRY_VOID(DeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC,
+    (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers))
+TF_GL_ENTRY_VOID(DeleteSamplers, PFNGLDELETESAMPLERSPROC, (GLsizei count, const GLuint *samplers), (count, samplers))
+TF_GL_ENTRY_VOID(DeleteShader, PFNGLDELETESHADERPROC, (GLuint shader), (shader))
+TF_GL_ENTRY_VOID(DeleteSync, PFNGLDELETESYNCPROC, (GLsync sync), (sync))
+TF_GL_ENTRY_VOID(DeleteTextures, PFNGLDELETETEXTURESPROC, (GLsizei n, const GLuint *textures), (n, textures))
+TF_GL_ENTRY_VOID(DeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC, (GLsizei n, const GLuint *arrays), (n, arrays))
+TF_GL_ENTRY_VOID(DepthFunc, PFNGLDEPTHFUNCPROC, (GLenum func), (func))
+TF_GL_ENTRY_VOID(DepthMask, PFNGLDEPTHMASKPROC, (GLboolean flag), (flag))
+TF_GL_ENTRY_VOID(DepthRange, PFNGLDEPTHRANGEPROC, (GLdouble n, GLdouble f), (n, f))
+TF_GL_ENTRY_VOID(DetachShader, PFNGLDETACHSHADERPROC, (GLuint program, GLuint shader), (program, shader))
+TF_GL_ENTRY_VOID(Disable, PFNGLDISABLEPROC, (GLenum cap), (cap))
+TF_GL_ENTRY_VOID(DisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index))
+TF_GL_ENTRY_VOID(Disablei, PFNGLDISABLEIPROC, (GLenum target, GLuint index), (target, index))
+TF_GL_ENTRY_VOID(DrawArrays, PFNGLDRAWARRAYSPROC, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+TF_GL_ENTRY_VOID(DrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC,
+    (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount))
+TF_GL_ENTRY_VOID(DrawBuffer, PFNGLDRAWBUFFERPROC, (GLenum buf), (buf))
+TF_GL_ENTRY_VOID(DrawBuffers, PFNGLDRAWBUFFERSPROC, (GLsizei n, const GLenum *bufs), (n, bufs))
+TF_GL_ENTRY_VOID(DrawElements, PFNGLDRAWELEMENTSPROC,
+    (GLenum mode, GLsizei count, GLenum type, const void *indices), (mode, count, type, indices))
+TF_GL_ENTRY_VOID(DrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC,
+    (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex),
+    (mode, count, type, indices, basevertex))
+TF_GL_ENTRY_VOID(DrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC,
+    (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount),
+    (mode, count, type, indices, instancecount))
+TF_GL_ENTRY_VOID(DrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC,
+    (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex),
+    (mode, count, type, indices, instancecount, basevertex))
+TF_GL_ENTRY_VOID(DrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC,
+    (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices),
+    (mode, start, end, count, type, indices))
+TF_GL_ENTRY_VOID(DrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC,
+    (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex),
+    (mode, start, end, count, type, indices, basevertex))
+TF_GL_ENTRY_VOID(Enable, PFNGLENABLEPROC, (GLenum cap), (cap))
+TF_GL_ENTRY_VOID(EnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index))
+TF_GL_ENTRY_VOID(Enablei, PFNGLENABLEIPROC, (GLenum target, GLuint index), (target, index))
+TF_GL_ENTRY_VOID(EndConditionalRender, PFNGLENDCONDITIONALRENDERPROC, (void), ())
+TF_GL_ENTRY_VOID(EndQuery, PFNGLENDQUERYPROC, (GLenum target), (target))
+TF_GL_ENTRY_VOID(EndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC, (void), ())
+TF_GL_ENTRY(GLsync, FenceSync, PFNGLFENCESYNCPROC, (GLenum condition, GLbitfield flags), (condition, flags))
+TF_GL_ENTRY_VOID(Finish, PFNGLFINISHPROC, (void), ())
+TF_GL_ENTRY_VOID(Flush, PFNGLFLUSHPROC, (void), ())
+TF_GL_ENTRY_VOID(FlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC,
+    (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length))
+TF_GL_ENTRY_VOID(FramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC,
+    (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer),
+    (target, attachment, renderbuffertarget, renderbuffer))
+TF_GL_ENTRY_VOID(FramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC,
+    (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+TF_GL_ENTRY_VOID(FramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC,
+    (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level),
+    (target, attachment, textarget, texture, level))
+TF_GL_ENTRY_VOID(FramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC,
+    (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level),
+    (target, attachment, textarget, texture, level))
+TF_GL_ENTRY_VOID(FramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC,
+    (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset),
+    (target, attachment, textarget, texture, level, zoffset))
+TF_GL_ENTRY_VOID(FramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC,
+    (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer),
+    (target, attachment, texture, level, layer))
+TF_GL_ENTRY_VOID(FrontFace, PFNGLFRONTFACEPROC, (GLenum mode), (mode))
+TF_GL_ENTRY_VOID(GenBuffers, PFNGLGENBUFFERSPROC, (GLsizei n, GLuint *buffers), (n, buffers))
+TF_GL_ENTRY_VOID(GenFramebuffers, PFNGLGENFRAMEBUFFERSPROC, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+TF_GL_ENTRY_VOID(GenQueries, PFNGLGENQUERIESPROC, (GLsizei n, GLuint *ids), (n, ids))
+TF_GL_ENTRY_VOID(GenRenderbuffers, PFNGLGENRENDERBUFFERSPROC, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+TF_GL_ENTRY_VOID(GenSamplers, PFNGLGENSAMPLERSPROC, (GLsizei count, GLuint *samplers), (count, samplers))
+TF_GL_ENTRY_VOID(GenTextures, PFNGLGENTEXTURESPROC, (GLsizei n, GLuint *textures), (n, textures))
+TF_GL_ENTRY_VOID(GenVertexArrays, PFNGLGENVERTEXARRAYSPROC, (GLsizei n, GLuint *arrays), (n, arrays))
+TF_GL_ENTRY_VOID(GenerateMipmap, PFNGLGENERATEMIPMAPPROC, (GLenum target), (target))
+TF_GL_ENTRY_VOID(GetActiveAttrib, PFNGLGETACTIVEATTRIBPROC,
+    (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name),
+    (program, index, bufSize, length, size, type, name))
+TF_GL_ENTRY_VOID(GetActiveUniform, PFNGLGETACTIVEUNIFORMPROC,
+    (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name),
+    (program, index, bufSize, length, size, type, name))
+TF_GL_ENTRY_VOID(GetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC,
+    (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName),
+    (program, uniformBlockIndex, bufSize, length, uniformBlockName))
+TF_GL_ENTRY_VOID(GetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC,
+    (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params),
+    (program, uniformBlockIndex, pname, params))
+TF_GL_ENTRY_VOID(GetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC,
+    (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName),
+    (program, uniformIndex, bufSize, length, uniformName))
+TF_GL_ENTRY_VOID(GetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC,
+    (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params),
+    (program, uniformCount, uniformIndices, pname, params))
+TF_GL_ENTRY_VOID(GetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC,
+    (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders))
+TF_GL_ENTRY(GLint, GetAttribLocation, PFNGLGETATTRIBLOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+TF_GL_ENTRY_VOID(GetBooleani_v, PFNGLGETBOOLEANI_VPROC,
+    (GLenum target, GLuint index, GLboolean *data), (target, index, data))
+TF_GL_ENTRY_VOID(GetBooleanv, PFNGLGETBOOLEANVPROC, (GLenum pname, GLboolean *data), (pname, data))
+TF_GL_ENTRY_VOID(GetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC,
+    (GLenum target, GLenum pname, GLint64 *params), (target, pname, params))
+TF_GL_ENTRY_VOID(GetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC,
+    (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+TF_GL_ENTRY_VOID(GetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC,
+    (GLenum target, GLenum pname, void **params), (target, pname, params))
+TF_GL_ENTRY_VOID(GetBufferSubData, PFNGLGETBUFFERSUBDATAPROC,
+    (GLenum target, GLintptr offset, GLsizeiptr size, void *data), (target, offset, size, data))
+TF_GL_ENTRY_VOID(GetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC,
+    (GLenum target, GLint level, void *img), (target, level, img))
+TF_GL_ENTRY_VOID(GetDoublev, PFNGLGETDOUBLEVPROC, (GLenum pname, GLdouble *data), (pname, data))
+TF_GL_ENTRY(GLenum, GetError, PFNGLGETERRORPROC, (void), ())
+TF_GL_ENTRY_VOID(GetFloatv, PFNGLGETFLOATVPROC, (GLenum pname, GLfloat *data), (pname, data))
+TF_GL_ENTRY(GLint, GetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC, (GLuint program, const GLchar *name), (program, name))
+TF_GL_ENTRY(GLint, GetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC,
+    (GLuint program, const GLchar *name), (program, name))
+TF_GL_ENTRY_VOID(GetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC,
+    (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params))
+TF_GL_ENTRY_VOID(GetInteger64i_v, PFNGLGETINTEGER64I_VPROC,
+    (GLenum target, GLuint index, GLint64 *data), (target, index, data))
+TF_GL_ENTRY_VOID(GetInteger64v, PFNGLGETINTEGER64VPROC, (GLenum pname, GLint64 *data), (pname, data))
+TF_GL_ENTRY_VOID(GetIntegeri_v, PFNGLGETINTEGERI_VPROC,
+    (GLenum target, GLuint index, GLint *data), (target, index, data))
+TF_GL_ENTRY_VOID(GetIntegerv, PFNGLGETINTEGERVPROC, (GLenum pname, GLint *data), (pname, data))
+TF_GL_ENTRY_VOID(GetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC,
+    (GLenum pname, GLuint index, GLfloat *val), (pname, index, val))
+TF_GL_ENTRY_VOID(GetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC,
+    (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog))
+TF_GL_ENTRY_VOID(GetProgramiv, PFNGLGETPROGRAMIVPROC,
+    (GLuint program, GLenum pname, GLint *params), (program, pname, params))
+TF_GL_ENTRY_VOID(GetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC,
+    (GLuint id, GLenum pname, GLint64 *params), (id, pname, params))
+TF_GL_ENTRY_VOID(GetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC,
+    (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+TF_GL_ENTRY_VOID(GetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC,
+    (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params))
+TF_GL_ENTRY_VOID(GetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC,
+    (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+TF_GL_ENTRY_VOID(GetQueryiv, PFNGLGETQUERYIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+TF_GL_ENTRY_VOID(GetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC,
+    (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+TF_GL_ENTRY_VOID(GetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC,
+    (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+TF_GL_ENTRY_VOID(GetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC,
+    (GLuint sampler, GLenum pname, GLuint *params), (sampler, pname, params))
+TF_GL_ENTRY_VOID(GetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC,
+    (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params))
+TF_GL_ENTRY_VOID(GetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC,
+    (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+TF_GL_ENTRY_VOID(GetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC,
+    (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog))
+TF_GL_ENTRY_VOID(GetShaderSource, PFNGLGETSHADERSOURCEPROC,
+    (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source))
+TF_GL_ENTRY_VOID(GetShaderiv, PFNGLGETSHADERIVPROC,
+    (GLuint shader, GLenum pname, GLint *params), (shader, pname, params))
+TF_GL_ENTRY(const GLubyte *, GetString, PFNGLGETSTRINGPROC, (GLenum name), (name))
+TF_GL_ENTRY(const GLubyte *, GetStringi, PFNGLGETSTRINGIPROC, (GLenum name, GLuint index), (name, index))
+TF_GL_ENTRY_VOID(GetSynciv, PFNGLGETSYNCIVPROC,
+    (GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values), (sync, pname, count, length, values))
+TF_GL_ENTRY_VOID(GetTexImage, PFNGLGETTEXIMAGEPROC,
+    (GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (target, level, format, type, pixels))
+TF_GL_ENTRY_VOID(GetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC,
+    (GLenum target, GLint level, GLenum pname, GLfloat *params), (target, level, pname, params))
+TF_GL_ENTRY_VOID(GetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC,
+    (GLenum target, GLint level, GLenum pname, GLint *params), (target, level, pname, params))
+TF_GL_ENTRY_VOID(GetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC,
+    (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+TF_GL_ENTRY_VOID(GetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC,
+    (GLenum target, GLenum pname, GLuint *params), (target, pname, params))
+TF_GL_ENTRY_VOID(GetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC,
+    (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+TF_GL_ENTRY_VOID(GetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC,
+    (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+TF_GL_ENTRY_VOID(GetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC,
+    (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name),
+    (program, index, bufSize, length, size, type, name))
+TF_GL_ENTRY(GLuint, GetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC,
+    (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName))
+TF_GL_ENTRY_VOID(GetUniformIndices, PFNGLGETUNIFORMINDICESPROC,
+    (GLuint program, GLsizei uniformCount, const GLchar *const *uniformNames, GLuint *uniformIndices),
+    (program, uniformCount, uniformNames, uniformIndices))
+TF_GL_ENTRY(GLint, GetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC,
+    (GLuint program, const GLchar *name), (program, name))
+TF_GL_ENTRY_VOID(GetUniformfv, PFNGLGETUNIFORMFVPROC,
+    (GLuint program, GLint location, GLfloat *params), (program, location, params))
+TF_GL_ENTRY_VOID(GetUniformiv, PFNGLGETUNIFORMIVPROC,
+    (GLuint program, GLint location, GLint *params), (program, location, params))
+TF_GL_ENTRY_VOID(GetUniformuiv, PFNGLGETUNIFORMUIVPROC,
+    (GLuint program, GLint location, GLuint *params), (program, location, params))
+TF_GL_ENTRY_VOID(GetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC,
+    (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+TF_GL_ENTRY_VOID(GetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC,
+    (GLuint index, GLenum pname, GLuint *params), (index, pname, params))
+TF_GL_ENTRY_VOID(GetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC,
+    (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+TF_GL_ENTRY_VOID(GetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC,
+    (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+TF_GL_ENTRY_VOID(GetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC,
+    (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+TF_GL_ENTRY_VOID(GetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC,
+    (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+TF_GL_ENTRY_VOID(Hint, PFNGLHINTPROC, (GLenum target, GLenum mode), (target, mode))
+TF_GL_ENTRY(GLboolean, IsBuffer, PFNGLISBUFFERPROC, (GLuint buffer), (buffer))
+TF_GL_ENTRY(GLboolean, IsEnabled, PFNGLISENABLEDPROC, (GLenum cap), (cap))
+TF_GL_ENTRY(GLboolean, IsEnabledi, PFNGLISENABLEDIPROC, (GLenum target, GLuint index), (target, index))
+TF_GL_ENTRY(GLboolean, IsFramebuffer, PFNGLISFRAMEBUFFERPROC, (GLuint framebuffer), (framebuffer))
+TF_GL_ENTRY(GLboolean, IsProgram, PFNGLISPROGRAMPROC, (GLuint program), (program))
+TF_GL_ENTRY(GLboolean, IsQuery, PFNGLISQUERYPROC, (GLuint id), (id))
+TF_GL_ENTRY(GLboolean, IsRenderbuffer, PFNGLISRENDERBUFFERPROC, (GLuint renderbuffer), (renderbuffer))
+TF_GL_ENTRY(GLboolean, IsSampler, PFNGLISSAMPLERPROC, (GLuint sampler), (sampler))
+TF_GL_ENTRY(GLboolean, IsShader, PFNGLISSHADERPROC, (GLuint shader), (shader))
+TF_GL_ENTRY(GLboolean, IsSync, PFNGLISSYNCPROC, (GLsync sync), (sync))
+TF_GL_ENTRY(GLboolean, IsTexture, PFNGLISTEXTUREPROC, (GLuint texture), (texture))
+TF_GL_ENTRY(GLboolean, IsVertexArray, PFNGLISVERTEXARRAYPROC, (GLuint array), (array))
+TF_GL_ENTRY_VOID(LineWidth, PFNGLLINEWIDTHPROC, (GLfloat width), (width))
+TF_GL_ENTRY_VOID(LinkProgram, PFNGLLINKPROGRAMPROC, (GLuint program), (program))
+TF_GL_ENTRY_VOID(LogicOp, PFNGLLOGICOPPROC, (GLenum opcode), (opcode))
+TF_GL_ENTRY(void *, MapBuffer, PFNGLMAPBUFFERPROC, (GLenum target, GLenum access), (target, access))
+TF_GL_ENTRY(void *, MapBufferRange, PFNGLMAPBUFFERRANGEPROC,
+    (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access))
+TF_GL_ENTRY_VOID(MultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC,
+    (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount))
+TF_GL_ENTRY_VOID(MultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC,
+    (GLenum mode, const GLsizei *count, GLenum type, const void *const *indices, GLsizei drawcount),
+    (mode, count, type, indices, drawcount))
+TF_GL_ENTRY_VOID(MultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC,
+    (GLenum mode, const GLsizei *count, GLenum type, const void *const *indices, GLsizei drawcount,
+        const GLint *basevertex),
+    (mode, count, type, indices, drawcount, basevertex))
+TF_GL_ENTRY_VOID(PixelStoref, PFNGLPIXELSTOREFPROC, (GLenum pname, GLfloat param), (pname, param))
+TF_GL_ENTRY_VOID(PixelStorei, PFNGLPIXELSTOREIPROC, (GLenum pname, GLint param), (pname, param))
+TF_GL_ENTRY_VOID(PointParameterf, PFNGLPOINTPARAMETERFPROC, (GLenum pname, GLfloat param), (pname, param))
+TF_GL_ENTRY_VOID(PointParameterfv, PFNGLPOINTPARAMETERFVPROC, (GLenum pname, const GLfloat *params), (pname, params))
+TF_GL_ENTRY_VOID(PointParameteri, PFNGLPOINTPARAMETERIPROC, (GLenum pname, GLint param), (pname, param))
+TF_GL_ENTRY_VOID(PointParameteriv, PFNGLPOINTPARAMETERIVPROC, (GLenum pname, const GLint *params), (pname, params))
+TF_GL_ENTRY_VOID(PointSize, PFNGLPOINTSIZEPROC, (GLfloat size), (size))
+TF_GL_ENTRY_VOID(PolygonMode, PFNGLPOLYGONMODEPROC, (GLenum face, GLenum mode), (face, mode))
+TF_GL_ENTRY_VOID(PolygonOffset, PFNGLPOLYGONOFFSETPROC, (GLfloat factor, GLfloat units), (factor, units))
+TF_GL_ENTRY_VOID(PrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC, (GLuint index), (index))
+TF_GL_ENTRY_VOID(ProvokingVertex, PFNGLPROVOKINGVERTEXPROC, (GLenum mode), (mode))
+TF_GL_ENTRY_VOID(QueryCounter, PFNGLQUERYCOUNTERPROC, (GLuint id, GLenum target), (id, target))
+TF_GL_ENTRY_VOID(ReadBuffer, PFNGLREADBUFFERPROC, (GLenum src), (src))
+TF_GL_ENTRY_VOID(ReadPixels, PFNGLREADPIXELSPROC,
+    (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels),
+    (x, y, width, height, format, type, pixels))
+TF_GL_ENTRY_VOID(RenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC,
+    (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height))
+TF_GL_ENTRY_VOID(RenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC,
+    (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height),
+    (target, samples, internalformat, width, height))
+TF_GL_ENTRY_VOID(SampleCoverage, PFNGLSAMPLECOVERAGEPROC, (GLfloat value, GLboolean invert), (value, invert))
+TF_GL_ENTRY_VOID(SampleMaski, PFNGLSAMPLEMASKIPROC, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask))
+TF_GL_ENTRY_VOID(SamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC,
+    (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+TF_GL_ENTRY_VOID(SamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC,
+    (GLuint sampler, GLenum pname, const GLuint *param), (sampler, pname, param))
+TF_GL_ENTRY_VOID(SamplerParameterf, PFNGLSAMPLERPARAMETERFPROC,
+    (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param))
+TF_GL_ENTRY_VOID(SamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC,
+    (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param))
+TF_GL_ENTRY_VOID(SamplerParameteri, PFNGLSAMPLERPARAMETERIPROC,
+    (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param))
+TF_GL_ENTRY_VOID(SamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC,
+    (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+TF_GL_ENTRY_VOID(Scissor, PFNGLSCISSORPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+TF_GL_ENTRY_VOID(ShaderSource, PFNGLSHADERSOURCEPROC,
+    (GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length), (shader, count, string, length))
+TF_GL_ENTRY_VOID(StencilFunc, PFNGLSTENCILFUNCPROC, (GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+TF_GL_ENTRY_VOID(StencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC,
+    (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask))
+TF_GL_ENTRY_VOID(StencilMask, PFNGLSTENCILMASKPROC, (GLuint mask), (mask))
+TF_GL_ENTRY_VOID(StencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC, (GLenum face, GLuint mask), (face, mask))
+TF_GL_ENTRY_VOID(StencilOp, PFNGLSTENCILOPPROC, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass))
+TF_GL_ENTRY_VOID(StencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC,
+    (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass))
+TF_GL_ENTRY_VOID(TexBuffer, PFNGLTEXBUFFERPROC,
+    (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+TF_GL_ENTRY_VOID(TexImage1D, PFNGLTEXIMAGE1DPROC,
+    (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type,
+        const void *pixels),
+    (target, level, internalformat, width, border, format, type, pixels))
+TF_GL_ENTRY_VOID(TexImage2D, PFNGLTEXIMAGE2DPROC,
+    (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format,
+        GLenum type, const void *pixels),
+    (target, level, internalformat, width, height, border, format, type, pixels))
+TF_GL_ENTRY_VOID(TexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC,
+    (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height,
+        GLboolean fixedsamplelocations),
+    (target, samples, internalformat, width, height, fixedsamplelocations))
+TF_GL_ENTRY_VOID(TexImage3D, PFNGLTEXIMAGE3DPROC,
+    (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border,
+        GLenum format, GLenum type, const void *pixels),
+    (target, level, internalformat, width, height, depth, border, format, type, pixels))
+TF_GL_ENTRY_VOID(TexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC,
+    (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth,
+        GLboolean fixedsamplelocations),
+    (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+TF_GL_ENTRY_VOID(TexParameterIiv, PFNGLTEXPARAMETERIIVPROC,
+    (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+TF_GL_ENTRY_VOID(TexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC,
+    (GLenum target, GLenum pname, const GLuint *params), (target, pname, params))
+TF_GL_ENTRY_VOID(TexParameterf, PFNGLTEXPARAMETERFPROC,
+    (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+TF_GL_ENTRY_VOID(TexParameterfv, PFNGLTEXPARAMETERFVPROC,
+    (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+TF_GL_ENTRY_VOID(TexParameteri, PFNGLTEXPARAMETERIPROC,
+    (GLenum target, GLenum pname, GLint param), (target, pname, param))
+TF_GL_ENTRY_VOID(TexParameteriv, PFNGLTEXPARAMETERIVPROC,
+    (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+TF_GL_ENTRY_VOID(TexSubImage1D, PFNGLTEXSUBIMAGE1DPROC,
+    (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels),
+    (target, level, xoffset, width, format, type, pixels))
+TF_GL_ENTRY_VOID(TexSubImage2D, PFNGLTEXSUBIMAGE2DPROC,
+    (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format,
+        GLenum type, const void *pixels),
+    (target, level, xoffset, yoffset, width, height, format, type, pixels))
+TF_GL_ENTRY_VOID(TexSubImage3D, PFNGLTEXSUBIMAGE3DPROC,
+    (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height,
+        GLsizei depth, GLenum format, GLenum type, const void *pixels),
+    (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+TF_GL_ENTRY_VOID(TransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC,
+    (GLuint program, GLsizei count, const GLchar *const *varyings, GLenum bufferMode),
+    (program, count, varyings, bufferMode))
+TF_GL_ENTRY_VOID(Uniform1f, PFNGLUNIFORM1FPROC, (GLint location, GLfloat v0), (location, v0))
+TF_GL_ENTRY_VOID(Uniform1fv, PFNGLUNIFORM1FVPROC,
+    (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+TF_GL_ENTRY_VOID(Uniform1i, PFNGLUNIFORM1IPROC, (GLint location, GLint v0), (location, v0))
+TF_GL_ENTRY_VOID(Uniform1iv, PFNGLUNIFORM1IVPROC,
+    (GLint location, GLsizei count, const GLint *value), (location, count, value))
+TF_GL_ENTRY_VOID(Uniform1ui, PFNGLUNIFORM1UIPROC, (GLint location, GLuint v0), (location, v0))
+TF_GL_ENTRY_VOID(Uniform1uiv, PFNGLUNIFORM1UIVPROC,
+    (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+TF_GL_ENTRY_VOID(Uniform2f, PFNGLUNIFORM2FPROC, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+TF_GL_ENTRY_VOID(Uniform2fv, PFNGLUNIFORM2FVPROC,
+    (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+TF_GL_ENTRY_VOID(Uniform2i, PFNGLUNIFORM2IPROC, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+TF_GL_ENTRY_VOID(Uniform2iv, PFNGLUNIFORM2IVPROC,
+    (GLint location, GLsizei count, const GLint *value), (location, count, value))
+TF_GL_ENTRY_VOID(Uniform2ui, PFNGLUNIFORM2UIPROC, (GLint location, GLuint v0, GLuint v1), (location, v0, v1))
+TF_GL_ENTRY_VOID(Uniform2uiv, PFNGLUNIFORM2UIVPROC,
+    (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+TF_GL_ENTRY_VOID(Uniform3f, PFNGLUNIFORM3FPROC,
+    (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+TF_GL_ENTRY_VOID(Uniform3fv, PFNGLUNIFORM3FVPROC,
+    (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+TF_GL_ENTRY_VOID(Uniform3i, PFNGLUNIFORM3IPROC, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+TF_GL_ENTRY_VOID(Uniform3iv, PFNGLUNIFORM3IVPROC,
+    (GLint location, GLsizei count, const GLint *value), (location, count, value))
+TF_GL_ENTRY_VOID(Uniform3ui, PFNGLUNIFORM3UIPROC,
+    (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2))
+TF_GL_ENTRY_VOID(Uniform3uiv, PFNGLUNIFORM3UIVPROC,
+    (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+TF_GL_ENTRY_VOID(Uniform4f, PFNGLUNIFORM4FPROC,
+    (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+TF_GL_ENTRY_VOID(Uniform4fv, PFNGLUNIFORM4FVPROC,
+    (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+TF_GL_ENTRY_VOID(Uniform4i, PFNGLUNIFORM4IPROC,
+    (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+TF_GL_ENTRY_VOID(Uniform4iv, PFNGLUNIFORM4IVPROC,
+    (GLint location, GLsizei count, const GLint *value), (location, count, value))
+TF_GL_ENTRY_VOID(Uniform4ui, PFNGLUNIFORM4UIPROC,
+    (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3))
+TF_GL_ENTRY_VOID(Uniform4uiv, PFNGLUNIFORM4UIVPROC,
+    (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+TF_GL_ENTRY_VOID(UniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC,
+    (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding),
+    (program, uniformBlockIndex, uniformBlockBinding))
+TF_GL_ENTRY_VOID(UniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC,
+    (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+TF_GL_ENTRY_VOID(UniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC,
+    (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+TF_GL_ENTRY_VOID(UniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC,
+    (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+TF_GL_ENTRY_VOID(UniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC,
+    (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+TF_GL_ENTRY_VOID(UniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC,
+    (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+TF_GL_ENTRY_VOID(UniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC,
+    (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+TF_GL_ENTRY_VOID(UniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC,
+    (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+TF_GL_ENTRY_VOID(UniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC,
+    (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+TF_GL_ENTRY_VOID(UniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC,
+    (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+TF_GL_ENTRY(GLboolean, UnmapBuffer, PFNGLUNMAPBUFFERPROC, (GLenum target), (target))
+TF_GL_ENTRY_VOID(UseProgram, PFNGLUSEPROGRAMPROC, (GLuint program), (program))
+TF_GL_ENTRY_VOID(ValidateProgram, PFNGLVALIDATEPROGRAMPROC, (GLuint program), (program))
+TF_GL_ENTRY_VOID(VertexAttrib1d, PFNGLVERTEXATTRIB1DPROC, (GLuint index, GLdouble x), (index, x))
+TF_GL_ENTRY_VOID(VertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC, (GLuint index, const GLdouble *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib1f, PFNGLVERTEXATTRIB1FPROC, (GLuint index, GLfloat x), (index, x))
+TF_GL_ENTRY_VOID(VertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC, (GLuint index, const GLfloat *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib1s, PFNGLVERTEXATTRIB1SPROC, (GLuint index, GLshort x), (index, x))
+TF_GL_ENTRY_VOID(VertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC, (GLuint index, const GLshort *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib2d, PFNGLVERTEXATTRIB2DPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+TF_GL_ENTRY_VOID(VertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC, (GLuint index, const GLdouble *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib2f, PFNGLVERTEXATTRIB2FPROC, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+TF_GL_ENTRY_VOID(VertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC, (GLuint index, const GLfloat *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib2s, PFNGLVERTEXATTRIB2SPROC, (GLuint index, GLshort x, GLshort y), (index, x, y))
+TF_GL_ENTRY_VOID(VertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC, (GLuint index, const GLshort *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib3d, PFNGLVERTEXATTRIB3DPROC,
+    (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+TF_GL_ENTRY_VOID(VertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC, (GLuint index, const GLdouble *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib3f, PFNGLVERTEXATTRIB3FPROC,
+    (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+TF_GL_ENTRY_VOID(VertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC, (GLuint index, const GLfloat *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib3s, PFNGLVERTEXATTRIB3SPROC,
+    (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+TF_GL_ENTRY_VOID(VertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC, (GLuint index, const GLshort *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC, (GLuint index, const GLbyte *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC, (GLuint index, const GLint *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC, (GLuint index, const GLshort *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC,
+    (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+TF_GL_ENTRY_VOID(VertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC, (GLuint index, const GLubyte *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC, (GLuint index, const GLuint *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC, (GLuint index, const GLushort *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC, (GLuint index, const GLbyte *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib4d, PFNGLVERTEXATTRIB4DPROC,
+    (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+TF_GL_ENTRY_VOID(VertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC, (GLuint index, const GLdouble *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib4f, PFNGLVERTEXATTRIB4FPROC,
+    (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+TF_GL_ENTRY_VOID(VertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC, (GLuint index, const GLfloat *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC, (GLuint index, const GLint *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib4s, PFNGLVERTEXATTRIB4SPROC,
+    (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+TF_GL_ENTRY_VOID(VertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC, (GLuint index, const GLshort *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC, (GLuint index, const GLubyte *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC, (GLuint index, const GLuint *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC, (GLuint index, const GLushort *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC, (GLuint index, GLuint divisor), (index, divisor))
+TF_GL_ENTRY_VOID(VertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC, (GLuint index, GLint x), (index, x))
+TF_GL_ENTRY_VOID(VertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC, (GLuint index, const GLint *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC, (GLuint index, GLuint x), (index, x))
+TF_GL_ENTRY_VOID(VertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC, (GLuint index, const GLuint *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC, (GLuint index, GLint x, GLint y), (index, x, y))
+TF_GL_ENTRY_VOID(VertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC, (GLuint index, const GLint *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC, (GLuint index, GLuint x, GLuint y), (index, x, y))
+TF_GL_ENTRY_VOID(VertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC, (GLuint index, const GLuint *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z))
+TF_GL_ENTRY_VOID(VertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC, (GLuint index, const GLint *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC,
+    (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z))
+TF_GL_ENTRY_VOID(VertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC, (GLuint index, const GLuint *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC, (GLuint index, const GLbyte *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC,
+    (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w))
+TF_GL_ENTRY_VOID(VertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC, (GLuint index, const GLint *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC, (GLuint index, const GLshort *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC, (GLuint index, const GLubyte *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC,
+    (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w))
+TF_GL_ENTRY_VOID(VertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC, (GLuint index, const GLuint *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC, (GLuint index, const GLushort *v), (index, v))
+TF_GL_ENTRY_VOID(VertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC,
+    (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+TF_GL_ENTRY_VOID(VertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC,
+    (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+TF_GL_ENTRY_VOID(VertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC,
+    (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+TF_GL_ENTRY_VOID(VertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC,
+    (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+TF_GL_ENTRY_VOID(VertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC,
+    (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+TF_GL_ENTRY_VOID(VertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC,
+    (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+TF_GL_ENTRY_VOID(VertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC,
+    (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+TF_GL_ENTRY_VOID(VertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC,
+    (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+TF_GL_ENTRY_VOID(VertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC,
+    (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+TF_GL_ENTRY_VOID(VertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC,
+    (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer),
+    (index, size, type, normalized, stride, pointer))
+TF_GL_ENTRY_VOID(Viewport, PFNGLVIEWPORTPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+TF_GL_ENTRY_VOID(WaitSync, PFNGLWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
@@ -0,0 +1,94 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "renderer/backend/opengl/gl_extensions.h"
+#include "tunafish/core/log.h"
+#include <string.h>
+
+static TF_GLExtensions s_extensions = {0};
+
+static b32 tf_gl_version_at_least(i32 major, i32 minor) {
+    return s_extensions.version_major > major ||
+           (s_extensions.version_major == major && s_extensions.version_minor >= minor);
+}
+
+b32 tf_gl_has_extension(const char *name) {
+    if (!name) return TF_FALSE;
+
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; i++) {
+        const char *extension = (const char *)glGetStringi(GL_EXTENSIONS, (GLuint)i);
+        if (extension && strcmp(extension, name) == 0) {
+            return TF_TRUE;
+        }
+    }
+    return TF_FALSE;
+}
+
+void tf_gl_extensions_load(GLADloadfunc load) {
+    memset(&s_extensions, 0, sizeof(s_extensions));
+
+    glGetIntegerv(GL_MAJOR_VERSION, &s_extensions.version_major);
+    glGetIntegerv(GL_MINOR_VERSION, &s_extensions.version_minor);
+
+    // Buffer storage (persistent mapping)
+    if (tf_gl_version_at_least(4, 4) || tf_gl_has_extension("GL_ARB_buffer_storage")) {
+        s_extensions.glBufferStorage = (TF_PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+        s_extensions.buffer_storage = s_extensions.glBufferStorage != NULL;
+    }
+
+    // Program binaries (on-disk shader cache)
+    if (tf_gl_version_at_least(4, 1) || tf_gl_has_extension("GL_ARB_get_program_binary")) {
+        s_extensions.glGetProgramBinary = (TF_PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+        s_extensions.glProgramBinary = (TF_PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+        s_extensions.glProgramParameteri = (TF_PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+
+        // Drivers may expose the entry points without supporting any format
+        GLint format_count = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &format_count);
+        s_extensions.program_binary = s_extensions.glGetProgramBinary && s_extensions.glProgramBinary &&
+                                      s_extensions.glProgramParameteri && format_count > 0;
+    }
+
+    // Base instance (instance data streamed at any offset without re-pointing attributes)
+    if (tf_gl_version_at_least(4, 2) || tf_gl_has_extension("GL_ARB_base_instance")) {
+        s_extensions.glDrawElementsInstancedBaseVertexBaseInstance =
+            (TF_PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)load(
+                "glDrawElementsInstancedBaseVertexBaseInstance");
+        s_extensions.base_instance = s_extensions.glDrawElementsInstancedBaseVertexBaseInstance != NULL;
+    }
+
+    // Parallel shader compilation (completion can be polled without blocking)
+    if (tf_gl_has_extension("GL_KHR_parallel_shader_compile")) {
+        s_extensions.glMaxShaderCompilerThreads =
+            (TF_PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+    } else if (tf_gl_has_extension("GL_ARB_parallel_shader_compile")) {
+        s_extensions.glMaxShaderCompilerThreads =
+            (TF_PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsARB");
+    }
+    s_extensions.parallel_shader_compile = s_extensions.glMaxShaderCompilerThreads != NULL;
+    if (s_extensions.parallel_shader_compile) {
+        // Let the driver pick how many compiler threads to use
+        s_extensions.glMaxShaderCompilerThreads(0xFFFFFFFFu);
+    }
+
+    // Debug output (driver errors and performance warnings, used by the debug layer)
+    if (tf_gl_version_at_least(4, 3) || tf_gl_has_extension("GL_KHR_debug")) {
+        s_extensions.glDebugMessageCallback = (TF_PFNGLDEBUGMESSAGECALLBACKPROC)load("glDebugMessageCallback");
+        s_extensions.glDebugMessageControl = (TF_PFNGLDEBUGMESSAGECONTROLPROC)load("glDebugMessageControl");
+        s_extensions.debug_output = s_extensions.glDebugMessageCallback && s_extensions.glDebugMessageControl;
+    }
+
+    TF_DEBUG("OpenGL extensions: buffer_storage=%d program_binary=%d parallel_shader_compile=%d base_instance=%d "
+             "debug_output=%d", s_extensions.buffer_storage, s_extensions.program_binary,
+             s_extensions.parallel_shader_compile, s_extensions.base_instance, s_extensions.debug_output);
+}
+
+const TF_GLExtensions *tf_gl_extensions_get(void) {
+    return &s_extensions;
+}
+
+TF_GLExtensions *tf_gl_extensions_get_entry_points(void) {
+    return &s_extensions;
+}
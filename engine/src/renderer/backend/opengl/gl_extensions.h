@@ -0,0 +1,112 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include <glad/gl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// Extension support beyond the GL 3.3 core loader
+// =============================================================================
+
+// glad is generated for plain 3.3 core, so newer entry points are resolved here
+// through the same loader and only used when the driver advertises them.
+
+// ARB_buffer_storage (core in 4.4)
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+#define GL_DYNAMIC_STORAGE_BIT 0x0100
+#define GL_CLIENT_STORAGE_BIT 0x0200
+#endif
+
+typedef void (GLAD_API_PTR *TF_PFNGLBUFFERSTORAGEPROC)(GLenum target, GLsizeiptr size, const void *data,
+                                                       GLbitfield flags);
+
+// ARB_get_program_binary (core in 4.1)
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#endif
+
+typedef void (GLAD_API_PTR *TF_PFNGLGETPROGRAMBINARYPROC)(GLuint program, GLsizei buf_size, GLsizei *length,
+                                                          GLenum *binary_format, void *binary);
+typedef void (GLAD_API_PTR *TF_PFNGLPROGRAMBINARYPROC)(GLuint program, GLenum binary_format, const void *binary,
+                                                       GLsizei length);
+typedef void (GLAD_API_PTR *TF_PFNGLPROGRAMPARAMETERIPROC)(GLuint program, GLenum pname, GLint value);
+
+// ARB_base_instance (core in 4.2)
+typedef void (GLAD_API_PTR *TF_PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)(
+    GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instance_count, GLint base_vertex,
+    GLuint base_instance);
+
+// KHR_parallel_shader_compile (ARB variant core in 4.6, same enums)
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+typedef void (GLAD_API_PTR *TF_PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+
+// KHR_debug (core in 4.3, unsuffixed in core profiles)
+#ifndef GL_DEBUG_OUTPUT
+#define GL_DEBUG_OUTPUT_SYNCHRONOUS 0x8242
+#define GL_DEBUG_TYPE_ERROR 0x824C
+#define GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR 0x824D
+#define GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR 0x824E
+#define GL_DEBUG_TYPE_PORTABILITY 0x824F
+#define GL_DEBUG_TYPE_PERFORMANCE 0x8250
+#define GL_DEBUG_TYPE_OTHER 0x8251
+#define GL_DEBUG_SEVERITY_NOTIFICATION 0x826B
+#define GL_DEBUG_SEVERITY_HIGH 0x9146
+#define GL_DEBUG_SEVERITY_MEDIUM 0x9147
+#define GL_DEBUG_SEVERITY_LOW 0x9148
+#define GL_DEBUG_OUTPUT 0x92E0
+#endif
+
+typedef void (GLAD_API_PTR *TF_PFNGLDEBUGMESSAGECALLBACKPROC)(GLDEBUGPROC callback, const void *user_param);
+typedef void (GLAD_API_PTR *TF_PFNGLDEBUGMESSAGECONTROLPROC)(GLenum source, GLenum type, GLenum severity,
+                                                             GLsizei count, const GLuint *ids, GLboolean enabled);
+
+typedef struct {
+    i32 version_major;
+    i32 version_minor;
+
+    // Supported extensions
+    b32 buffer_storage;
+    b32 program_binary; // Also requires at least one binary format
+    b32 parallel_shader_compile; // GL_COMPLETION_STATUS_KHR can be polled
+    b32 base_instance; // Instanced attributes can start at an arbitrary instance
+    b32 debug_output; // Driver messages can be received through a callback
+
+    // Entry points (NULL when unsupported)
+    TF_PFNGLBUFFERSTORAGEPROC glBufferStorage;
+    TF_PFNGLGETPROGRAMBINARYPROC glGetProgramBinary;
+    TF_PFNGLPROGRAMBINARYPROC glProgramBinary;
+    TF_PFNGLPROGRAMPARAMETERIPROC glProgramParameteri;
+    TF_PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glMaxShaderCompilerThreads;
+    TF_PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glDrawElementsInstancedBaseVertexBaseInstance;
+    TF_PFNGLDEBUGMESSAGECALLBACKPROC glDebugMessageCallback;
+    TF_PFNGLDEBUGMESSAGECONTROLPROC glDebugMessageControl;
+} TF_GLExtensions;
+
+// Query the current context; must be called after gladLoadGL
+void tf_gl_extensions_load(GLADloadfunc load);
+
+const TF_GLExtensions *tf_gl_extensions_get(void);
+
+// Writable entry points, for the debug layer to wrap in place
+TF_GLExtensions *tf_gl_extensions_get_entry_points(void);
+
+// Check the extension string list of the current context
+b32 tf_gl_has_extension(const char *name);
+
+#ifdef __cplusplus
+}
+#endif
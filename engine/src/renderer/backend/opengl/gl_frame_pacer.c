@@ -0,0 +1,93 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "renderer/backend/opengl/gl_frame_pacer.h"
+#include "platform/window_internal.h"
+#include "tunafish/core/time.h"
+#include "tunafish/core/log.h"
+#include <stdlib.h>
+
+// Fence wait granularity while the frame limit is reached (1 ms)
+#define TF_GL_FRAME_PACER_WAIT_TIMEOUT_NS 1000000ull
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+TF_GLFramePacer *tf_gl_frame_pacer_create(u32 max_frames_in_flight) {
+    TF_GLFramePacer *pacer = calloc(1, sizeof(TF_GLFramePacer));
+    if (!pacer) {
+        TF_ERROR("Failed to allocate frame pacer");
+        return NULL;
+    }
+
+    if (max_frames_in_flight < 1) max_frames_in_flight = 1;
+    if (max_frames_in_flight > TF_GL_FRAME_PACER_MAX_FRAMES) max_frames_in_flight = TF_GL_FRAME_PACER_MAX_FRAMES;
+    pacer->max_frames_in_flight = max_frames_in_flight;
+    pacer->frame_start = tf_time_get_current();
+    return pacer;
+}
+
+void tf_gl_frame_pacer_destroy(TF_GLFramePacer *pacer) {
+    if (!pacer) return;
+
+    for (u32 i = 0; i < pacer->count; i++) {
+        glDeleteSync(pacer->fences[(pacer->first + i) % TF_GL_FRAME_PACER_MAX_FRAMES]);
+    }
+    free(pacer);
+}
+
+// =============================================================================
+// Pacing
+// =============================================================================
+
+// Drop the oldest frame once the GPU has finished it; with wait set, block until it has
+static b32 tf_gl_frame_pacer_retire(TF_GLFramePacer *pacer, b32 wait) {
+    GLsync fence = pacer->fences[pacer->first];
+
+    GLenum result = glClientWaitSync(fence, 0, 0);
+    if (result == GL_TIMEOUT_EXPIRED) {
+        if (!wait) {
+            return TF_FALSE;
+        }
+        do {
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, TF_GL_FRAME_PACER_WAIT_TIMEOUT_NS);
+        } while (result == GL_TIMEOUT_EXPIRED);
+    }
+    if (result == GL_WAIT_FAILED) {
+        TF_ERROR("Frame fence wait failed");
+    }
+
+    glDeleteSync(fence);
+    pacer->fences[pacer->first] = NULL;
+    pacer->first = (pacer->first + 1) % TF_GL_FRAME_PACER_MAX_FRAMES;
+    pacer->count--;
+    return TF_TRUE;
+}
+
+void tf_gl_frame_pacer_begin_frame(TF_GLFramePacer *pacer) {
+    if (!pacer) return;
+
+    pacer->frame_start = tf_time_get_current();
+}
+
+void tf_gl_frame_pacer_present(TF_GLFramePacer *pacer, TF_Window *window) {
+    if (!pacer) return;
+
+    tf_window_present(window);
+    f64 swapped = tf_time_get_current();
+    pacer->cpu_to_swap_ms = (f32)((swapped - pacer->frame_start) * 1000.0);
+
+    // Frames the GPU has already finished never cost a wait
+    while (pacer->count > 0 && tf_gl_frame_pacer_retire(pacer, TF_FALSE)) {
+    }
+    while (pacer->count >= pacer->max_frames_in_flight) {
+        tf_gl_frame_pacer_retire(pacer, TF_TRUE);
+    }
+    pacer->wait_ms = (f32)((tf_time_get_current() - swapped) * 1000.0);
+
+    u32 slot = (pacer->first + pacer->count) % TF_GL_FRAME_PACER_MAX_FRAMES;
+    pacer->fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    pacer->count++;
+    pacer->frames_in_flight = pacer->count;
+}
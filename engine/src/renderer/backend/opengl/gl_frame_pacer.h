@@ -0,0 +1,55 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include <glad/gl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Forward declarations
+typedef struct TF_Window TF_Window;
+
+// =============================================================================
+// Frame pacer - presentation and frames-in-flight limit
+// =============================================================================
+
+// Drivers let the CPU queue several frames ahead of the GPU, and each queued
+// frame is a frame of input latency. The pacer fences every presented frame
+// and, before fencing a new one, waits for the oldest while max_frames_in_flight
+// are still unfinished. It also measures how long each frame took from
+// begin_frame until the swap returned.
+
+// More would only stall on the streaming ring instead
+#define TF_GL_FRAME_PACER_MAX_FRAMES 3
+
+typedef struct TF_GLFramePacer {
+    GLsync fences[TF_GL_FRAME_PACER_MAX_FRAMES]; // Presented frames, oldest at first
+    u32 first;
+    u32 count;
+    u32 max_frames_in_flight;
+    f64 frame_start; // Time of begin_frame, in seconds
+
+    // Results of the latest present
+    f32 cpu_to_swap_ms;
+    f32 wait_ms;
+    u32 frames_in_flight;
+} TF_GLFramePacer;
+
+// max_frames_in_flight is clamped to [1, TF_GL_FRAME_PACER_MAX_FRAMES]
+TF_GLFramePacer *tf_gl_frame_pacer_create(u32 max_frames_in_flight);
+
+void tf_gl_frame_pacer_destroy(TF_GLFramePacer *pacer);
+
+void tf_gl_frame_pacer_begin_frame(TF_GLFramePacer *pacer);
+
+// Swap window's buffers (NULL or headless = nothing to swap), then fence the
+// frame, waiting first if too many are in flight
+void tf_gl_frame_pacer_present(TF_GLFramePacer *pacer, TF_Window *window);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,344 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "renderer/backend/opengl/gl_geometry_arena.h"
+#include "renderer/mesh_internal.h"
+#include "tunafish/core/log.h"
+#include <stdlib.h>
+#include <string.h>
+
+// =============================================================================
+// Range allocator
+// =============================================================================
+
+b32 tf_gl_arena_heap_init(TF_GLArenaHeap *heap, u32 capacity) {
+    memset(heap, 0, sizeof(TF_GLArenaHeap));
+    heap->free_capacity = 16;
+    heap->free_ranges = malloc(sizeof(TF_GLArenaRange) * heap->free_capacity);
+    if (!heap->free_ranges) {
+        TF_ERROR("Failed to allocate arena free list");
+        return TF_FALSE;
+    }
+
+    tf_gl_arena_heap_reset(heap, 0, capacity);
+    return TF_TRUE;
+}
+
+void tf_gl_arena_heap_shutdown(TF_GLArenaHeap *heap) {
+    free(heap->free_ranges);
+    memset(heap, 0, sizeof(TF_GLArenaHeap));
+}
+
+b32 tf_gl_arena_heap_alloc(TF_GLArenaHeap *heap, u32 size, u32 *out_offset) {
+    for (u32 i = 0; i < heap->free_count; i++) {
+        TF_GLArenaRange *range = &heap->free_ranges[i];
+        if (range->size < size) {
+            continue;
+        }
+
+        *out_offset = range->offset;
+        range->offset += size;
+        range->size -= size;
+        if (range->size == 0) {
+            memmove(range, range + 1, sizeof(TF_GLArenaRange) * (heap->free_count - i - 1));
+            heap->free_count--;
+        }
+        heap->used += size;
+        return TF_TRUE;
+    }
+    return TF_FALSE;
+}
+
+void tf_gl_arena_heap_free(TF_GLArenaHeap *heap, u32 offset, u32 size) {
+    if (size == 0) return;
+
+    heap->used -= size;
+
+    // First free range after the released one
+    u32 index = 0;
+    while (index < heap->free_count && heap->free_ranges[index].offset < offset) {
+        index++;
+    }
+
+    b32 merge_previous = index > 0 &&
+                         heap->free_ranges[index - 1].offset + heap->free_ranges[index - 1].size == offset;
+    b32 merge_next = index < heap->free_count && offset + size == heap->free_ranges[index].offset;
+
+    if (merge_previous && merge_next) {
+        heap->free_ranges[index - 1].size += size + heap->free_ranges[index].size;
+        memmove(&heap->free_ranges[index], &heap->free_ranges[index + 1],
+                sizeof(TF_GLArenaRange) * (heap->free_count - index - 1));
+        heap->free_count--;
+        return;
+    }
+    if (merge_previous) {
+        heap->free_ranges[index - 1].size += size;
+        return;
+    }
+    if (merge_next) {
+        heap->free_ranges[index].offset = offset;
+        heap->free_ranges[index].size += size;
+        return;
+    }
+
+    if (heap->free_count == heap->free_capacity) {
+        u32 capacity = heap->free_capacity * 2;
+        TF_GLArenaRange *ranges = realloc(heap->free_ranges, sizeof(TF_GLArenaRange) * capacity);
+        if (!ranges) {
+            // The range is leaked until the next repack rebuilds the free list
+            TF_ERROR("Failed to grow arena free list");
+            return;
+        }
+        heap->free_ranges = ranges;
+        heap->free_capacity = capacity;
+    }
+
+    memmove(&heap->free_ranges[index + 1], &heap->free_ranges[index],
+            sizeof(TF_GLArenaRange) * (heap->free_count - index));
+    heap->free_ranges[index] = (TF_GLArenaRange){offset, size};
+    heap->free_count++;
+}
+
+void tf_gl_arena_heap_reset(TF_GLArenaHeap *heap, u32 used, u32 new_capacity) {
+    heap->capacity = new_capacity;
+    heap->used = used;
+    heap->free_count = 0;
+    if (new_capacity > used) {
+        heap->free_ranges[heap->free_count++] = (TF_GLArenaRange){used, new_capacity - used};
+    }
+}
+
+// =============================================================================
+// Geometry arena
+// =============================================================================
+
+static u32 tf_gl_geometry_arena_create_buffer(usize size) {
+    u32 buffer = 0;
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)size, NULL, GL_STATIC_DRAW);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    return buffer;
+}
+
+// Move every resident mesh to the front of new buffers of the given size
+static void tf_gl_geometry_arena_repack(TF_GLGeometryArena *arena, u32 vertex_capacity, u32 index_capacity) {
+    u32 stride = arena->layout.stride;
+    u32 vertex_buffer = tf_gl_geometry_arena_create_buffer((usize)vertex_capacity * stride);
+    u32 index_buffer = tf_gl_geometry_arena_create_buffer((usize)index_capacity * sizeof(u16));
+
+    // Copies stay on the GPU; draws already issued keep reading the old buffers
+    u32 vertex_offset = 0;
+    glBindBuffer(GL_COPY_READ_BUFFER, arena->vertex_buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, vertex_buffer);
+    for (u32 i = 0; i < arena->mesh_count; i++) {
+        TF_GLMesh *gl_mesh = arena->meshes[i];
+        u32 vertex_count = gl_mesh->mesh->vertex_count;
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, (GLintptr)gl_mesh->base_vertex * stride,
+                            (GLintptr)vertex_offset * stride, (GLsizeiptr)vertex_count * stride);
+        gl_mesh->base_vertex = vertex_offset;
+        vertex_offset += vertex_count;
+    }
+
+    u32 index_offset = 0;
+    glBindBuffer(GL_COPY_READ_BUFFER, arena->index_buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, index_buffer);
+    for (u32 i = 0; i < arena->mesh_count; i++) {
+        TF_GLMesh *gl_mesh = arena->meshes[i];
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+                            (GLintptr)(gl_mesh->first_index * sizeof(u16)),
+                            (GLintptr)(index_offset * sizeof(u16)), (GLsizeiptr)(gl_mesh->index_count * sizeof(u16)));
+        gl_mesh->first_index = index_offset;
+        index_offset += gl_mesh->index_count;
+    }
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    tf_gl_vertex_array_cache_evict(arena->vertex_arrays, arena->state, arena->vertex_buffer);
+    glDeleteBuffers(1, &arena->vertex_buffer);
+    glDeleteBuffers(1, &arena->index_buffer);
+
+    arena->vertex_buffer = vertex_buffer;
+    arena->index_buffer = index_buffer;
+    arena->vertex_array = 0;
+    tf_gl_arena_heap_reset(&arena->vertices, vertex_offset, vertex_capacity);
+    tf_gl_arena_heap_reset(&arena->indices, index_offset, index_capacity);
+    arena->repacks++;
+
+    TF_DEBUG("Geometry arena repacked: %u/%u vertices, %u/%u indices, %u meshes",
+             vertex_offset, vertex_capacity, index_offset, index_capacity, arena->mesh_count);
+}
+
+TF_GLGeometryArena *tf_gl_geometry_arena_create(const TF_VertexLayout *layout, u32 vertex_capacity,
+                                                u32 index_capacity, TF_GLVertexArrayCache *vertex_arrays,
+                                                TF_GLStateCache *state, u32 instance_buffer) {
+    if (!layout || !vertex_arrays || vertex_capacity == 0 || index_capacity == 0) return NULL;
+
+    TF_GLGeometryArena *arena = calloc(1, sizeof(TF_GLGeometryArena));
+    if (!arena) {
+        TF_ERROR("Failed to allocate geometry arena");
+        return NULL;
+    }
+
+    arena->layout = *layout;
+    arena->layout_hash = tf_gl_vertex_layout_hash(layout);
+    arena->vertex_arrays = vertex_arrays;
+    arena->state = state;
+    arena->instance_buffer = instance_buffer;
+
+    if (!tf_gl_arena_heap_init(&arena->vertices, vertex_capacity) ||
+        !tf_gl_arena_heap_init(&arena->indices, index_capacity)) {
+        tf_gl_geometry_arena_destroy(arena);
+        return NULL;
+    }
+
+    arena->vertex_buffer = tf_gl_geometry_arena_create_buffer((usize)vertex_capacity * layout->stride);
+    arena->index_buffer = tf_gl_geometry_arena_create_buffer((usize)index_capacity * sizeof(u16));
+
+    TF_DEBUG("Created geometry arena (stride %u): %u vertices, %u indices",
+             layout->stride, vertex_capacity, index_capacity);
+    return arena;
+}
+
+void tf_gl_geometry_arena_destroy(TF_GLGeometryArena *arena) {
+    if (!arena) return;
+
+    if (arena->vertex_buffer) {
+        tf_gl_vertex_array_cache_evict(arena->vertex_arrays, arena->state, arena->vertex_buffer);
+        glDeleteBuffers(1, &arena->vertex_buffer);
+    }
+    if (arena->index_buffer) {
+        glDeleteBuffers(1, &arena->index_buffer);
+    }
+
+    for (u32 i = 0; i < arena->mesh_count; i++) {
+        free(arena->meshes[i]);
+    }
+    free(arena->meshes);
+
+    tf_gl_arena_heap_shutdown(&arena->vertices);
+    tf_gl_arena_heap_shutdown(&arena->indices);
+    free(arena);
+}
+
+// Allocate both ranges, repacking (and growing if needed) when they do not fit
+static b32 tf_gl_geometry_arena_allocate(TF_GLGeometryArena *arena, u32 vertex_count, u32 index_count,
+                                         u32 *out_base_vertex, u32 *out_first_index) {
+    if (tf_gl_arena_heap_alloc(&arena->vertices, vertex_count, out_base_vertex)) {
+        if (tf_gl_arena_heap_alloc(&arena->indices, index_count, out_first_index)) {
+            return TF_TRUE;
+        }
+        tf_gl_arena_heap_free(&arena->vertices, *out_base_vertex, vertex_count);
+    }
+
+    // Enough space overall means the free list is only fragmented
+    u32 vertex_capacity = arena->vertices.capacity;
+    while (vertex_capacity - arena->vertices.used < vertex_count) {
+        vertex_capacity *= 2;
+    }
+    u32 index_capacity = arena->indices.capacity;
+    while (index_capacity - arena->indices.used < index_count) {
+        index_capacity *= 2;
+    }
+    tf_gl_geometry_arena_repack(arena, vertex_capacity, index_capacity);
+
+    return tf_gl_arena_heap_alloc(&arena->vertices, vertex_count, out_base_vertex) &&
+           tf_gl_arena_heap_alloc(&arena->indices, index_count, out_first_index);
+}
+
+TF_GLMesh *tf_gl_geometry_arena_add(TF_GLGeometryArena *arena, TF_Mesh *mesh) {
+    if (!arena || !mesh || mesh->vertex_count > TF_GL_GEOMETRY_ARENA_MAX_MESH_VERTICES) return NULL;
+
+    if (arena->mesh_count == arena->mesh_capacity) {
+        u32 capacity = arena->mesh_capacity ? arena->mesh_capacity * 2 : 64;
+        TF_GLMesh **meshes = realloc(arena->meshes, sizeof(TF_GLMesh *) * capacity);
+        if (!meshes) {
+            TF_ERROR("Failed to grow geometry arena mesh list");
+            return NULL;
+        }
+        arena->meshes = meshes;
+        arena->mesh_capacity = capacity;
+    }
+
+    u16 *indices = malloc(sizeof(u16) * mesh->index_count);
+    TF_GLMesh *gl_mesh = calloc(1, sizeof(TF_GLMesh));
+    if (!indices || !gl_mesh) {
+        TF_ERROR("Failed to allocate arena mesh");
+        free(indices);
+        free(gl_mesh);
+        return NULL;
+    }
+
+    u32 base_vertex = 0;
+    u32 first_index = 0;
+    if (!tf_gl_geometry_arena_allocate(arena, mesh->vertex_count, mesh->index_count, &base_vertex, &first_index)) {
+        TF_ERROR("Failed to allocate mesh %u in geometry arena", mesh->id);
+        free(indices);
+        free(gl_mesh);
+        return NULL;
+    }
+
+    for (u32 i = 0; i < mesh->index_count; i++) {
+        indices[i] = (u16)mesh->indices[i];
+    }
+
+    u32 stride = arena->layout.stride;
+    glBindBuffer(GL_COPY_WRITE_BUFFER, arena->vertex_buffer);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)base_vertex * stride, (GLsizeiptr)mesh->vertex_count * stride,
+                    mesh->vertices);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, arena->index_buffer);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)(first_index * sizeof(u16)),
+                    (GLsizeiptr)(mesh->index_count * sizeof(u16)), indices);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    free(indices);
+
+    gl_mesh->mesh = mesh;
+    gl_mesh->index_type = GL_UNSIGNED_SHORT;
+    gl_mesh->index_count = mesh->index_count;
+    gl_mesh->arena = arena;
+    gl_mesh->base_vertex = base_vertex;
+    gl_mesh->first_index = first_index;
+
+    arena->meshes[arena->mesh_count++] = gl_mesh;
+    return gl_mesh;
+}
+
+void tf_gl_geometry_arena_remove(TF_GLGeometryArena *arena, TF_GLMesh *gl_mesh) {
+    if (!arena || !gl_mesh || gl_mesh->arena != arena) return;
+
+    for (u32 i = 0; i < arena->mesh_count; i++) {
+        if (arena->meshes[i] == gl_mesh) {
+            arena->meshes[i] = arena->meshes[--arena->mesh_count];
+            break;
+        }
+    }
+
+    tf_gl_arena_heap_free(&arena->vertices, gl_mesh->base_vertex, gl_mesh->mesh->vertex_count);
+    tf_gl_arena_heap_free(&arena->indices, gl_mesh->first_index, gl_mesh->index_count);
+    free(gl_mesh);
+}
+
+b32 tf_gl_geometry_arena_defragment(TF_GLGeometryArena *arena) {
+    if (!arena) return TF_FALSE;
+
+    // Nothing to gain when the free space is already one range at the end
+    if (arena->vertices.free_count <= 1 && arena->indices.free_count <= 1 &&
+        (arena->vertices.free_count == 0 ||
+         arena->vertices.free_ranges[0].offset == arena->vertices.used) &&
+        (arena->indices.free_count == 0 ||
+         arena->indices.free_ranges[0].offset == arena->indices.used)) {
+        return TF_FALSE;
+    }
+
+    tf_gl_geometry_arena_repack(arena, arena->vertices.capacity, arena->indices.capacity);
+    return TF_TRUE;
+}
+
+u32 tf_gl_geometry_arena_get_vertex_array(TF_GLGeometryArena *arena) {
+    if (!arena->vertex_array) {
+        arena->vertex_array = tf_gl_vertex_array_cache_get(arena->vertex_arrays, arena->state, &arena->layout,
+                                                           arena->vertex_buffer, arena->index_buffer,
+                                                           arena->instance_buffer);
+    }
+    return arena->vertex_array;
+}
@@ -0,0 +1,108 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include "tunafish/renderer/mesh.h"
+#include "renderer/backend/opengl/gl_mesh.h"
+#include <glad/gl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// Range allocator
+// =============================================================================
+
+// First-fit free list over [0, capacity) in abstract units (vertices or
+// indices). Free ranges are kept sorted by offset and merged with their
+// neighbours when released.
+typedef struct {
+    u32 offset;
+    u32 size;
+} TF_GLArenaRange;
+
+typedef struct {
+    TF_GLArenaRange *free_ranges;
+    u32 free_count;
+    u32 free_capacity;
+    u32 capacity;
+    u32 used;
+} TF_GLArenaHeap;
+
+b32 tf_gl_arena_heap_init(TF_GLArenaHeap *heap, u32 capacity);
+
+void tf_gl_arena_heap_shutdown(TF_GLArenaHeap *heap);
+
+// TF_FALSE when no single free range is large enough
+b32 tf_gl_arena_heap_alloc(TF_GLArenaHeap *heap, u32 size, u32 *out_offset);
+
+void tf_gl_arena_heap_free(TF_GLArenaHeap *heap, u32 offset, u32 size);
+
+// Forget every allocation and mark [used, new_capacity) as the only free range
+void tf_gl_arena_heap_reset(TF_GLArenaHeap *heap, u32 used, u32 new_capacity);
+
+// =============================================================================
+// Geometry arena
+// =============================================================================
+
+// One large vertex buffer and one large u16 index buffer shared by every mesh
+// with the same vertex layout. Meshes become (base vertex, first index)
+// ranges, so draws of different meshes need no VAO or buffer rebinds and can
+// be merged into glMultiDrawElementsBaseVertex calls. Indices stay local to
+// their mesh, so only meshes with at most 65535 vertices can live here.
+//
+// When an allocation does not fit, live meshes are repacked into new buffers
+// with glCopyBufferSubData: at the same size if the free space is only
+// fragmented, otherwise at double the size.
+typedef struct TF_GLGeometryArena {
+    u64 layout_hash;
+    TF_VertexLayout layout;
+
+    u32 vertex_buffer;
+    u32 index_buffer;
+    TF_GLArenaHeap vertices;
+    TF_GLArenaHeap indices;
+
+    // Resident meshes (owned by the arena)
+    TF_GLMesh **meshes;
+    u32 mesh_count;
+    u32 mesh_capacity;
+
+    // VAO over the current buffers, rebuilt after a repack
+    TF_GLVertexArrayCache *vertex_arrays;
+    TF_GLStateCache *state;
+    u32 instance_buffer;
+    u32 vertex_array;
+
+    u32 repacks; // Times the buffers were rebuilt (defragmented or grown)
+} TF_GLGeometryArena;
+
+// Meshes this arena can hold
+#define TF_GL_GEOMETRY_ARENA_MAX_MESH_VERTICES 0xFFFFu
+
+// instance_buffer is attached to the arena VAO for per-instance attributes
+TF_GLGeometryArena *tf_gl_geometry_arena_create(const TF_VertexLayout *layout, u32 vertex_capacity,
+                                                u32 index_capacity, TF_GLVertexArrayCache *vertex_arrays,
+                                                TF_GLStateCache *state, u32 instance_buffer);
+
+// Frees every mesh still resident
+void tf_gl_geometry_arena_destroy(TF_GLGeometryArena *arena);
+
+// Copy the mesh into the arena (NULL on failure or if the mesh is too large)
+TF_GLMesh *tf_gl_geometry_arena_add(TF_GLGeometryArena *arena, TF_Mesh *mesh);
+
+// Release the mesh's ranges and free gl_mesh
+void tf_gl_geometry_arena_remove(TF_GLGeometryArena *arena, TF_GLMesh *gl_mesh);
+
+// Pack every resident mesh to the front of the buffers
+b32 tf_gl_geometry_arena_defragment(TF_GLGeometryArena *arena);
+
+// VAO over the arena buffers (0 on failure)
+u32 tf_gl_geometry_arena_get_vertex_array(TF_GLGeometryArena *arena);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,207 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "renderer/backend/opengl/gl_mesh.h"
+#include "renderer/backend/opengl/gl_state.h"
+#include "renderer/mesh_internal.h"
+#include "tunafish/core/log.h"
+#include "tunafish/renderer/renderer_types.h"
+#include <stdlib.h>
+
+// =============================================================================
+// GPU meshes
+// =============================================================================
+
+TF_GLMesh *tf_gl_mesh_create(TF_Mesh *mesh) {
+    if (!mesh) return NULL;
+
+    TF_GLMesh *gl_mesh = calloc(1, sizeof(TF_GLMesh));
+    if (!gl_mesh) {
+        TF_ERROR("Failed to allocate GPU mesh");
+        return NULL;
+    }
+
+    gl_mesh->mesh = mesh;
+    gl_mesh->index_count = mesh->index_count;
+
+    // Halve index bandwidth whenever the vertex count allows it
+    u16 *short_indices = NULL;
+    if (mesh->vertex_count <= 0xFFFF) {
+        short_indices = malloc(sizeof(u16) * mesh->index_count);
+    }
+    if (short_indices) {
+        for (u32 i = 0; i < mesh->index_count; i++) {
+            short_indices[i] = (u16)mesh->indices[i];
+        }
+        gl_mesh->index_type = GL_UNSIGNED_SHORT;
+    } else {
+        gl_mesh->index_type = GL_UNSIGNED_INT;
+    }
+
+    // GL_COPY_WRITE_BUFFER keeps the upload from disturbing any VAO binding
+    glGenBuffers(1, &gl_mesh->vertex_buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, gl_mesh->vertex_buffer);
+    glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)mesh->layout.stride * mesh->vertex_count,
+                 mesh->vertices, GL_STATIC_DRAW);
+
+    glGenBuffers(1, &gl_mesh->index_buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, gl_mesh->index_buffer);
+    if (short_indices) {
+        glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)(sizeof(u16) * mesh->index_count),
+                     short_indices, GL_STATIC_DRAW);
+    } else {
+        glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)(sizeof(u32) * mesh->index_count),
+                     mesh->indices, GL_STATIC_DRAW);
+    }
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    free(short_indices);
+
+    return gl_mesh;
+}
+
+void tf_gl_mesh_destroy(TF_GLMesh *gl_mesh) {
+    if (!gl_mesh) return;
+
+    if (gl_mesh->vertex_buffer) {
+        glDeleteBuffers(1, &gl_mesh->vertex_buffer);
+    }
+    if (gl_mesh->index_buffer) {
+        glDeleteBuffers(1, &gl_mesh->index_buffer);
+    }
+
+    free(gl_mesh);
+}
+
+// =============================================================================
+// Vertex array cache
+// =============================================================================
+
+u64 tf_gl_vertex_layout_hash(const TF_VertexLayout *layout) {
+    u64 hash = 14695981039346656037ull;
+    hash = (hash ^ layout->stride) * 1099511628211ull;
+    for (u32 i = 0; i < layout->element_count; i++) {
+        const TF_VertexElement *element = &layout->elements[i];
+        hash = (hash ^ (u64)element->attribute) * 1099511628211ull;
+        hash = (hash ^ (u64)element->format) * 1099511628211ull;
+        hash = (hash ^ (u64)element->offset) * 1099511628211ull;
+    }
+    return hash;
+}
+
+static void tf_gl_set_attribute(const TF_VertexElement *element, u32 stride) {
+    GLint components = 0;
+    GLenum type = GL_FLOAT;
+    GLboolean normalized = GL_FALSE;
+
+    switch (element->format) {
+        case TF_VERTEX_FORMAT_FLOAT2: components = 2; break;
+        case TF_VERTEX_FORMAT_FLOAT3: components = 3; break;
+        case TF_VERTEX_FORMAT_FLOAT4: components = 4; break;
+        case TF_VERTEX_FORMAT_UBYTE4_NORM:
+            components = 4;
+            type = GL_UNSIGNED_BYTE;
+            normalized = GL_TRUE;
+            break;
+    }
+
+    GLuint location = (GLuint)element->attribute;
+    glVertexAttribPointer(location, components, type, normalized, (GLsizei)stride,
+                          (const void *)(usize)element->offset);
+    glEnableVertexAttribArray(location);
+}
+
+void tf_gl_set_instance_attributes(usize offset) {
+    for (u32 i = 0; i < TF_GL_INSTANCE_ATTRIBUTE_COUNT; i++) {
+        GLuint location = TF_GL_INSTANCE_ATTRIBUTE_FIRST + i;
+        glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, (GLsizei)sizeof(TF_InstanceData),
+                              (const void *)(offset + i * 4 * sizeof(f32)));
+    }
+}
+
+TF_GLVertexArrayCache *tf_gl_vertex_array_cache_create(void) {
+    TF_GLVertexArrayCache *cache = calloc(1, sizeof(TF_GLVertexArrayCache));
+    if (!cache) {
+        TF_ERROR("Failed to allocate vertex array cache");
+    }
+    return cache;
+}
+
+void tf_gl_vertex_array_cache_destroy(TF_GLVertexArrayCache *cache) {
+    if (!cache) return;
+
+    for (u32 i = 0; i < cache->count; i++) {
+        glDeleteVertexArrays(1, &cache->entries[i].vertex_array);
+    }
+
+    free(cache->entries);
+    free(cache);
+}
+
+u32 tf_gl_vertex_array_cache_get(TF_GLVertexArrayCache *cache, TF_GLStateCache *state,
+                                 const TF_VertexLayout *layout, u32 vertex_buffer, u32 index_buffer,
+                                 u32 instance_buffer) {
+    u64 layout_hash = tf_gl_vertex_layout_hash(layout);
+
+    for (u32 i = 0; i < cache->count; i++) {
+        const TF_GLVertexArrayEntry *entry = &cache->entries[i];
+        if (entry->layout_hash == layout_hash && entry->vertex_buffer == vertex_buffer &&
+            entry->index_buffer == index_buffer && entry->instance_buffer == instance_buffer) {
+            return entry->vertex_array;
+        }
+    }
+
+    if (cache->count == cache->capacity) {
+        u32 capacity = cache->capacity ? cache->capacity * 2 : 32;
+        TF_GLVertexArrayEntry *entries = realloc(cache->entries, sizeof(TF_GLVertexArrayEntry) * capacity);
+        if (!entries) {
+            TF_ERROR("Failed to grow vertex array cache");
+            return 0;
+        }
+        cache->entries = entries;
+        cache->capacity = capacity;
+    }
+
+    u32 vertex_array = 0;
+    glGenVertexArrays(1, &vertex_array);
+    tf_gl_state_bind_vertex_array(state, vertex_array);
+    tf_gl_state_bind_array_buffer(state, vertex_buffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer);
+
+    for (u32 i = 0; i < layout->element_count; i++) {
+        tf_gl_set_attribute(&layout->elements[i], layout->stride);
+    }
+
+    if (instance_buffer) {
+        tf_gl_state_bind_array_buffer(state, instance_buffer);
+        tf_gl_set_instance_attributes(0);
+        for (u32 i = 0; i < TF_GL_INSTANCE_ATTRIBUTE_COUNT; i++) {
+            glEnableVertexAttribArray(TF_GL_INSTANCE_ATTRIBUTE_FIRST + i);
+            glVertexAttribDivisor(TF_GL_INSTANCE_ATTRIBUTE_FIRST + i, 1);
+        }
+    }
+
+    cache->entries[cache->count++] = (TF_GLVertexArrayEntry){
+        layout_hash, vertex_buffer, index_buffer, instance_buffer, vertex_array
+    };
+    return vertex_array;
+}
+
+void tf_gl_vertex_array_cache_evict(TF_GLVertexArrayCache *cache, TF_GLStateCache *state, u32 buffer) {
+    if (!cache) return;
+
+    u32 i = 0;
+    while (i < cache->count) {
+        TF_GLVertexArrayEntry *entry = &cache->entries[i];
+        if (entry->vertex_buffer != buffer && entry->index_buffer != buffer && entry->instance_buffer != buffer) {
+            i++;
+            continue;
+        }
+
+        // Deleting a bound VAO silently rebinds 0, keep the shadow state honest
+        if (state && state->vertex_array == entry->vertex_array) {
+            tf_gl_state_bind_vertex_array(state, 0);
+        }
+        glDeleteVertexArrays(1, &entry->vertex_array);
+        *entry = cache->entries[--cache->count];
+    }
+}
@@ -0,0 +1,86 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include "tunafish/renderer/mesh.h"
+#include <glad/gl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct TF_GLStateCache TF_GLStateCache;
+typedef struct TF_GLGeometryArena TF_GLGeometryArena;
+
+// =============================================================================
+// GPU meshes
+// =============================================================================
+
+// GPU copy of one TF_Mesh: either its own static buffers, or a range of a
+// shared geometry arena (arena != NULL, buffers and VAO belong to the arena)
+typedef struct TF_GLMesh {
+    TF_Mesh *mesh;
+    u32 vertex_buffer;
+    u32 index_buffer;
+    GLenum index_type; // GL_UNSIGNED_SHORT when every index fits, otherwise GL_UNSIGNED_INT
+    u32 index_count;
+    u32 vertex_array;  // Owned by the vertex array cache
+
+    TF_GLGeometryArena *arena;
+    u32 base_vertex;   // Added to every index
+    u32 first_index;   // First index inside the index buffer
+} TF_GLMesh;
+
+// Upload the mesh data into new static buffers
+TF_GLMesh *tf_gl_mesh_create(TF_Mesh *mesh);
+
+void tf_gl_mesh_destroy(TF_GLMesh *gl_mesh);
+
+// =============================================================================
+// Vertex array cache
+// =============================================================================
+
+// VAOs keyed by vertex layout + vertex buffer + index buffer + instance buffer,
+// so meshes that share buffers and a layout also share one VAO.
+typedef struct {
+    u64 layout_hash;
+    u32 vertex_buffer;
+    u32 index_buffer;
+    u32 instance_buffer;
+    u32 vertex_array;
+} TF_GLVertexArrayEntry;
+
+// Per-instance attributes (TF_InstanceData): three transform rows and a color
+#define TF_GL_INSTANCE_ATTRIBUTE_FIRST 4
+#define TF_GL_INSTANCE_ATTRIBUTE_COUNT 4
+
+typedef struct TF_GLVertexArrayCache {
+    TF_GLVertexArrayEntry *entries;
+    u32 count;
+    u32 capacity;
+} TF_GLVertexArrayCache;
+
+u64 tf_gl_vertex_layout_hash(const TF_VertexLayout *layout);
+
+TF_GLVertexArrayCache *tf_gl_vertex_array_cache_create(void);
+
+void tf_gl_vertex_array_cache_destroy(TF_GLVertexArrayCache *cache);
+
+// Find or build the VAO for this combination (0 on failure). A non-zero
+// instance_buffer gets the per-instance attributes, starting at offset 0.
+u32 tf_gl_vertex_array_cache_get(TF_GLVertexArrayCache *cache, TF_GLStateCache *state,
+                                 const TF_VertexLayout *layout, u32 vertex_buffer, u32 index_buffer,
+                                 u32 instance_buffer);
+
+// Point the per-instance attributes of the bound VAO at offset in the bound
+// array buffer (used when the driver lacks base instance support)
+void tf_gl_set_instance_attributes(usize offset);
+
+// Delete every VAO that references buffer (call before deleting the buffer)
+void tf_gl_vertex_array_cache_evict(TF_GLVertexArrayCache *cache, TF_GLStateCache *state, u32 buffer);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,255 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "renderer/backend/opengl/gl_program_cache.h"
+#include "renderer/backend/opengl/gl_extensions.h"
+#include "tunafish/core/export.h"
+#include "tunafish/core/log.h"
+#include "tunafish/core/time.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef TF_PLATFORM_WINDOWS
+#include <direct.h>
+#define tf_make_directory(path) _mkdir(path)
+#else
+#include <sys/stat.h>
+#define tf_make_directory(path) mkdir(path, 0755)
+#endif
+
+#define TF_PROGRAM_CACHE_MAGIC   0x42505446u // "TFPB"
+#define TF_PROGRAM_CACHE_VERSION 1u
+#define TF_PROGRAM_CACHE_PATH_MAX 512
+
+// File layout: header followed by `length` bytes of driver binary
+typedef struct {
+    u32 magic;
+    u32 version;
+    u64 key;
+    u32 format;
+    u32 length;
+} TF_ProgramCacheHeader;
+
+static struct {
+    b32 enabled;
+    char directory[TF_PROGRAM_CACHE_PATH_MAX];
+    u64 driver_hash;
+    TF_ShaderCacheStats stats;
+    u32 users; // Backends between init and shutdown
+} s_program_cache = {0};
+
+// =============================================================================
+// Internal helpers
+// =============================================================================
+
+// 64-bit FNV-1a, chained through hash so several strings form one key
+static u64 tf_program_cache_hash(u64 hash, const char *string) {
+    if (!string) return hash;
+
+    for (const u8 *c = (const u8 *)string; *c; c++) {
+        hash ^= *c;
+        hash *= 1099511628211ull;
+    }
+
+    // Separator, so ("ab", "c") and ("a", "bc") differ
+    hash ^= 0xFF;
+    hash *= 1099511628211ull;
+    return hash;
+}
+
+// Entry file for key, with suffix appended; TF_FALSE if it does not fit in size
+static b32 tf_program_cache_path(u64 key, const char *suffix, char *path, usize size) {
+    int length = snprintf(path, size, "%s/%016llx.bin%s", s_program_cache.directory, (unsigned long long)key,
+                          suffix);
+    if (length < 0 || (usize)length >= size) {
+        TF_ERROR("Shader cache path for entry %016llx is too long", (unsigned long long)key);
+        return TF_FALSE;
+    }
+    return TF_TRUE;
+}
+
+static f64 tf_program_cache_ms_since(f64 start) {
+    return (tf_time_get_current() - start) * 1000.0;
+}
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+b32 tf_gl_program_cache_init(const char *directory) {
+    // Shared by every backend: only the first to start resets it
+    if (s_program_cache.users++ == 0) {
+        memset(&s_program_cache, 0, sizeof(s_program_cache));
+        s_program_cache.users = 1;
+    }
+    if (!directory) return s_program_cache.enabled;
+
+    if (s_program_cache.enabled) {
+        if (strcmp(directory, s_program_cache.directory) != 0) {
+            TF_WARN("Shader cache already uses %s, ignoring %s", s_program_cache.directory, directory);
+        }
+        return TF_TRUE;
+    }
+
+    if (!tf_gl_extensions_get()->program_binary) {
+        TF_WARN("Program binaries are not supported, shader cache disabled");
+        return TF_FALSE;
+    }
+
+    if (strlen(directory) >= TF_PROGRAM_CACHE_PATH_MAX - 32) {
+        TF_ERROR("Shader cache path is too long: %s", directory);
+        return TF_FALSE;
+    }
+
+    // Fails harmlessly if the directory already exists; a real problem shows up on first store
+    tf_make_directory(directory);
+    strcpy(s_program_cache.directory, directory);
+
+    u64 hash = 14695981039346656037ull;
+    hash = tf_program_cache_hash(hash, (const char *)glGetString(GL_VENDOR));
+    hash = tf_program_cache_hash(hash, (const char *)glGetString(GL_RENDERER));
+    hash = tf_program_cache_hash(hash, (const char *)glGetString(GL_VERSION));
+    hash = tf_program_cache_hash(hash, (const char *)glGetString(GL_SHADING_LANGUAGE_VERSION));
+    s_program_cache.driver_hash = hash;
+    s_program_cache.enabled = TF_TRUE;
+
+    TF_INFO("Shader cache enabled: %s", directory);
+    return TF_TRUE;
+}
+
+void tf_gl_program_cache_shutdown(void) {
+    if (s_program_cache.users == 0) return;
+
+    // Stays enabled for the backends still running
+    if (--s_program_cache.users == 0) {
+        s_program_cache.enabled = TF_FALSE;
+    }
+}
+
+b32 tf_gl_program_cache_enabled(void) {
+    return s_program_cache.enabled;
+}
+
+// =============================================================================
+// Lookup and storage
+// =============================================================================
+
+u64 tf_gl_program_cache_key(const char *vertex_source, const char *fragment_source) {
+    u64 hash = tf_program_cache_hash(s_program_cache.driver_hash, vertex_source);
+    return tf_program_cache_hash(hash, fragment_source);
+}
+
+u32 tf_gl_program_cache_load(u64 key) {
+    if (!s_program_cache.enabled) return 0;
+
+    f64 start = tf_time_get_current();
+
+    char path[TF_PROGRAM_CACHE_PATH_MAX];
+    FILE *file = tf_program_cache_path(key, "", path, sizeof(path)) ? fopen(path, "rb") : NULL;
+    if (!file) {
+        s_program_cache.stats.misses++;
+        return 0;
+    }
+
+    TF_ProgramCacheHeader header;
+    void *binary = NULL;
+    b32 valid = fread(&header, sizeof(header), 1, file) == 1 &&
+                header.magic == TF_PROGRAM_CACHE_MAGIC &&
+                header.version == TF_PROGRAM_CACHE_VERSION &&
+                header.key == key && header.length > 0;
+    if (valid) {
+        binary = malloc(header.length);
+        valid = binary && fread(binary, header.length, 1, file) == 1;
+    }
+    fclose(file);
+
+    u32 program = 0;
+    if (valid) {
+        program = glCreateProgram();
+        tf_gl_extensions_get()->glProgramBinary(program, header.format, binary, (GLsizei)header.length);
+
+        // Drivers reject binaries from other builds even when our key matched
+        i32 success = 0;
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+        if (!success) {
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+    free(binary);
+
+    if (!program) {
+        TF_DEBUG("Shader cache entry %016llx rejected, recompiling", (unsigned long long)key);
+        s_program_cache.stats.rejected++;
+        s_program_cache.stats.misses++;
+        remove(path);
+        return 0;
+    }
+
+    s_program_cache.stats.hits++;
+    s_program_cache.stats.load_time_ms += tf_program_cache_ms_since(start);
+    return program;
+}
+
+void tf_gl_program_cache_store(u64 key, u32 program) {
+    if (!s_program_cache.enabled || program == 0) return;
+
+    i32 length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    void *binary = malloc((usize)length);
+    if (!binary) {
+        TF_ERROR("Failed to allocate %d bytes for program binary", length);
+        return;
+    }
+
+    TF_ProgramCacheHeader header = {TF_PROGRAM_CACHE_MAGIC, TF_PROGRAM_CACHE_VERSION, key, 0, 0};
+    GLsizei written = 0;
+    tf_gl_extensions_get()->glGetProgramBinary(program, length, &written, &header.format, binary);
+    header.length = (u32)written;
+
+    // Write to a temporary file first so a crash never leaves a truncated entry behind
+    char path[TF_PROGRAM_CACHE_PATH_MAX];
+    char temp_path[TF_PROGRAM_CACHE_PATH_MAX];
+    if (!tf_program_cache_path(key, "", path, sizeof(path)) ||
+        !tf_program_cache_path(key, ".tmp", temp_path, sizeof(temp_path))) {
+        free(binary);
+        return;
+    }
+
+    FILE *file = fopen(temp_path, "wb");
+    b32 ok = file && written > 0 &&
+             fwrite(&header, sizeof(header), 1, file) == 1 &&
+             fwrite(binary, (usize)written, 1, file) == 1;
+    if (file) fclose(file);
+    free(binary);
+
+    remove(path);
+    if (!ok || rename(temp_path, path) != 0) {
+        TF_WARN("Failed to write shader cache entry %s", path);
+        remove(temp_path);
+        return;
+    }
+
+    s_program_cache.stats.stores++;
+}
+
+void tf_gl_program_cache_prepare(u32 program) {
+    if (!s_program_cache.enabled) return;
+    tf_gl_extensions_get()->glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+}
+
+// =============================================================================
+// Statistics
+// =============================================================================
+
+void tf_gl_program_cache_record_compile(f64 milliseconds) {
+    s_program_cache.stats.compiled++;
+    s_program_cache.stats.compile_time_ms += milliseconds;
+}
+
+TF_ShaderCacheStats tf_gl_program_cache_get_stats(void) {
+    return s_program_cache.stats;
+}
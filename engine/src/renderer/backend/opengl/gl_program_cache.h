@@ -0,0 +1,53 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include "tunafish/renderer/shader.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// Program binary cache
+// =============================================================================
+
+// Linked programs are saved with glGetProgramBinary and restored with
+// glProgramBinary on the next launch. Entries are keyed by the shader sources
+// and the driver identity (vendor, renderer, version strings), so a driver
+// update or a source change simply misses and recompiles. A binary the driver
+// rejects is treated the same way.
+
+// Enable the cache in directory (created if missing). Requires a current
+// context; does nothing if directory is NULL or program binaries are unsupported.
+// Every backend inits and shuts down once: the first init resets the stats,
+// the first directory given is the one used, and the cache stays enabled
+// until the last shutdown.
+b32 tf_gl_program_cache_init(const char *directory);
+
+void tf_gl_program_cache_shutdown(void);
+
+b32 tf_gl_program_cache_enabled(void);
+
+// Key for a program built from these sources on the current driver
+u64 tf_gl_program_cache_key(const char *vertex_source, const char *fragment_source);
+
+// Returns a linked program, or 0 on a miss
+u32 tf_gl_program_cache_load(u64 key);
+
+// Save a linked program (it must have been linked with the retrievable hint)
+void tf_gl_program_cache_store(u64 key, u32 program);
+
+// Mark a program as retrievable; call between attaching shaders and linking
+void tf_gl_program_cache_prepare(u32 program);
+
+// Account time spent compiling and linking from source
+void tf_gl_program_cache_record_compile(f64 milliseconds);
+
+TF_ShaderCacheStats tf_gl_program_cache_get_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,121 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "renderer/backend/opengl/gl_readback.h"
+#include "tunafish/core/log.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Fence wait granularity when the caller asks to block (1 ms)
+#define TF_GL_READBACK_WAIT_TIMEOUT_NS 1000000ull
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+TF_GLReadback *tf_gl_readback_create(void) {
+    TF_GLReadback *readback = calloc(1, sizeof(TF_GLReadback));
+    if (!readback) {
+        TF_ERROR("Failed to allocate readback ring");
+        return NULL;
+    }
+
+    // Buffers are sized on first use, when the framebuffer size is known
+    GLuint buffers[TF_GL_READBACK_SLOTS];
+    glGenBuffers(TF_GL_READBACK_SLOTS, buffers);
+    for (u32 i = 0; i < TF_GL_READBACK_SLOTS; i++) {
+        readback->slots[i].buffer = buffers[i];
+    }
+    readback->next_ticket = 1;
+
+    return readback;
+}
+
+void tf_gl_readback_destroy(TF_GLReadback *readback) {
+    if (!readback) return;
+
+    for (u32 i = 0; i < TF_GL_READBACK_SLOTS; i++) {
+        TF_GLReadbackSlot *slot = &readback->slots[i];
+        if (slot->fence) {
+            glDeleteSync(slot->fence);
+        }
+        glDeleteBuffers(1, &slot->buffer);
+    }
+    free(readback);
+}
+
+// =============================================================================
+// Readback
+// =============================================================================
+
+u32 tf_gl_readback_begin(TF_GLReadback *readback, u32 width, u32 height) {
+    if (!readback || width == 0 || height == 0) return 0;
+
+    u32 ticket = readback->next_ticket;
+    TF_GLReadbackSlot *slot = &readback->slots[(ticket - 1) % TF_GL_READBACK_SLOTS];
+    if (slot->ticket != 0) {
+        return 0;
+    }
+
+    usize size = (usize)width * height * 4;
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+    if (slot->size < size) {
+        glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)size, NULL, GL_STREAM_READ);
+        slot->size = size;
+    }
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadPixels(0, 0, (GLsizei)width, (GLsizei)height, GL_RGBA, GL_UNSIGNED_BYTE, (void *)0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    slot->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot->ticket = ticket;
+    slot->width = width;
+    slot->height = height;
+
+    // Ticket 0 means "failed", so skip it on wrap-around
+    readback->next_ticket = ticket + 1 ? ticket + 1 : 1;
+    return ticket;
+}
+
+b32 tf_gl_readback_end(TF_GLReadback *readback, u32 ticket, void *pixels, b32 wait) {
+    if (!readback || ticket == 0) return TF_FALSE;
+
+    TF_GLReadbackSlot *slot = &readback->slots[(ticket - 1) % TF_GL_READBACK_SLOTS];
+    if (slot->ticket != ticket) {
+        TF_WARN("Readback ticket %u is not in flight", ticket);
+        return TF_FALSE;
+    }
+
+    // The flush bit makes sure the fence reaches the GPU even if nothing else flushes
+    GLenum result = glClientWaitSync(slot->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    while (wait && result == GL_TIMEOUT_EXPIRED) {
+        result = glClientWaitSync(slot->fence, GL_SYNC_FLUSH_COMMANDS_BIT, TF_GL_READBACK_WAIT_TIMEOUT_NS);
+    }
+    if (result == GL_TIMEOUT_EXPIRED) {
+        return TF_FALSE;
+    }
+    if (result == GL_WAIT_FAILED) {
+        TF_ERROR("Readback fence wait failed");
+    }
+
+    b32 copied = TF_TRUE;
+    if (pixels) {
+        usize size = (usize)slot->width * slot->height * 4;
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+        const void *mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)size, GL_MAP_READ_BIT);
+        copied = mapped != NULL;
+        if (mapped) {
+            memcpy(pixels, mapped, size);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        } else {
+            TF_ERROR("Failed to map readback buffer");
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+
+    glDeleteSync(slot->fence);
+    slot->fence = NULL;
+    slot->ticket = 0;
+    return copied;
+}
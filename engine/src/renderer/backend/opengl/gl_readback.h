@@ -0,0 +1,52 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include <glad/gl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// Readback ring - asynchronous framebuffer copies through pixel-buffer objects
+// =============================================================================
+
+// glReadPixels into a bound GL_PIXEL_PACK_BUFFER returns immediately; the copy
+// runs on the GPU behind the frame's draws. Each slot is fenced after its copy
+// and only mapped once the fence has signalled, normally a few frames later,
+// so collecting the pixels never stalls the pipeline.
+
+#define TF_GL_READBACK_SLOTS 3
+
+typedef struct {
+    u32 buffer;
+    usize size;   // Buffer capacity in bytes
+    GLsync fence; // Signalled once the copy has landed
+    u32 ticket;   // 0 when the slot is free
+    u32 width, height;
+} TF_GLReadbackSlot;
+
+typedef struct TF_GLReadback {
+    TF_GLReadbackSlot slots[TF_GL_READBACK_SLOTS];
+    u32 next_ticket;
+} TF_GLReadback;
+
+TF_GLReadback *tf_gl_readback_create(void);
+
+void tf_gl_readback_destroy(TF_GLReadback *readback);
+
+// Queue a copy of the bound read framebuffer; returns its ticket, or 0 when
+// every slot is still waiting to be collected
+u32 tf_gl_readback_begin(TF_GLReadback *readback, u32 width, u32 height);
+
+// Copy a ticket's RGBA8 pixels out and free its slot (pixels = NULL frees it
+// without copying). Returns TF_FALSE while the copy is in flight (unless wait
+// is set) or for unknown tickets.
+b32 tf_gl_readback_end(TF_GLReadback *readback, u32 ticket, void *pixels, b32 wait);
+
+#ifdef __cplusplus
+}
+#endif
@@ -2,45 +2,151 @@
 // Created by Preetiman Misra on 17/07/25.
 //
 #include "tunafish/renderer/backend/opengl/gl_renderer.h"
+#include "platform/window_internal.h"
+#include "renderer/mesh_internal.h"
+#include "renderer/backend/opengl/gl_debug.h"
+#include "renderer/backend/opengl/gl_extensions.h"
+#include "renderer/backend/opengl/gl_frame_pacer.h"
+#include "renderer/backend/opengl/gl_geometry_arena.h"
+#include "renderer/backend/opengl/gl_mesh.h"
+#include "renderer/backend/opengl/gl_program_cache.h"
+#include "renderer/backend/opengl/gl_readback.h"
+#include "renderer/backend/opengl/gl_state.h"
+#include "renderer/backend/opengl/gl_stream_buffer.h"
+#include "renderer/backend/opengl/gl_timer.h"
 #include "tunafish/core/log.h"
+#include "tunafish/core/time.h"
+#include "tunafish/platform/window.h"
+#include "tunafish/renderer/shader_variant.h"
 #include <glad/gl.h>
-#include <GLFW/glfw3.h>
 #include <stdlib.h>
+#include <string.h>
 
 // =============================================================================
-// Default shaders for triangle rendering
+// Built-in shader includes and templates
 // =============================================================================
 
-static const char *s_triangle_vertex_shader =
+static const char *s_frame_include =
+    "layout (std140) uniform TF_FrameData {\n"
+    "    vec4 tf_time;\n"
+    "    vec4 tf_viewport;\n"
+    "};\n";
+
+static const char *s_camera_include =
+    "layout (std140) uniform TF_CameraData {\n"
+    "    mat4 tf_view;\n"
+    "    mat4 tf_projection;\n"
+    "    mat4 tf_view_projection;\n"
+    "    vec4 tf_camera_position;\n"
+    "};\n";
+
+// Unlit template shared by the triangle batch, the fallback and meshes.
+// Without TF_TRANSFORM positions are already in clip space; with TF_INSTANCED
+// the model transform and a color multiplier come from per-instance attributes
+// (TF_InstanceData) instead of tf_model. Without any color feature the output
+// is a flat grey, which is what the fallback shows.
+static const char *s_unlit_features[] = {
+    "TF_TRANSFORM",
+    "TF_VERTEX_COLOR",
+    "TF_UNIFORM_COLOR",
+    "TF_INSTANCED"
+};
+
+static const char *s_unlit_vertex_shader =
     "#version 330 core\n"
+    "#include \"tunafish/camera.glsl\"\n"
+    "#if defined(TF_VERTEX_COLOR) || defined(TF_INSTANCED)\n"
+    "#define TF_VARYING_COLOR\n"
+    "out vec4 vertexColor;\n"
+    "#endif\n"
     "layout (location = 0) in vec3 aPos;\n"
+    "#ifdef TF_VERTEX_COLOR\n"
     "layout (location = 1) in vec4 aColor;\n"
-    "out vec4 vertexColor;\n"
+    "#endif\n"
+    "#ifdef TF_INSTANCED\n"
+    "layout (location = 4) in vec4 aInstanceRow0;\n"
+    "layout (location = 5) in vec4 aInstanceRow1;\n"
+    "layout (location = 6) in vec4 aInstanceRow2;\n"
+    "layout (location = 7) in vec4 aInstanceColor;\n"
+    "#elif defined(TF_TRANSFORM)\n"
+    "uniform mat4 tf_model;\n"
+    "#endif\n"
     "void main() {\n"
-    "    gl_Position = vec4(aPos, 1.0);\n"
-    "    vertexColor = aColor;\n"
+    "    vec4 position = vec4(aPos, 1.0);\n"
+    "#ifdef TF_INSTANCED\n"
+    "    position = vec4(dot(aInstanceRow0, position), dot(aInstanceRow1, position),\n"
+    "                    dot(aInstanceRow2, position), 1.0);\n"
+    "#elif defined(TF_TRANSFORM)\n"
+    "    position = tf_model * position;\n"
+    "#endif\n"
+    "#ifdef TF_TRANSFORM\n"
+    "    gl_Position = tf_view_projection * position;\n"
+    "#else\n"
+    "    gl_Position = position;\n"
+    "#endif\n"
+    "#ifdef TF_VARYING_COLOR\n"
+    "    vertexColor = vec4(1.0);\n"
+    "#endif\n"
+    "#ifdef TF_VERTEX_COLOR\n"
+    "    vertexColor *= aColor;\n"
+    "#endif\n"
+    "#ifdef TF_INSTANCED\n"
+    "    vertexColor *= aInstanceColor;\n"
+    "#endif\n"
     "}\n";
 
-static const char *s_triangle_fragment_shader =
+static const char *s_unlit_fragment_shader =
     "#version 330 core\n"
+    "#if defined(TF_VERTEX_COLOR) || defined(TF_INSTANCED)\n"
+    "#define TF_VARYING_COLOR\n"
     "in vec4 vertexColor;\n"
+    "#endif\n"
+    "#ifdef TF_UNIFORM_COLOR\n"
+    "uniform vec4 tf_color;\n"
+    "#endif\n"
     "out vec4 FragColor;\n"
     "void main() {\n"
-    "    FragColor = vertexColor;\n"
+    "#if defined(TF_VARYING_COLOR) || defined(TF_UNIFORM_COLOR)\n"
+    "    vec4 color = vec4(1.0);\n"
+    "#else\n"
+    "    vec4 color = vec4(0.5, 0.5, 0.5, 1.0);\n"
+    "#endif\n"
+    "#ifdef TF_VARYING_COLOR\n"
+    "    color *= vertexColor;\n"
+    "#endif\n"
+    "#ifdef TF_UNIFORM_COLOR\n"
+    "    color *= tf_color;\n"
+    "#endif\n"
+    "    FragColor = color;\n"
     "}\n";
 
 // =============================================================================
 // Forward declarations
 // =============================================================================
 
-static b32 tf_opengl_create(TF_RendererBackend *backend, TF_Window *window);
+static b32 tf_opengl_create(TF_RendererBackend *backend, TF_Window *window, const TF_RendererConfig *config);
 static void tf_opengl_destroy(TF_RendererBackend *backend);
 static void tf_opengl_begin_frame(TF_RendererBackend *backend);
 static void tf_opengl_end_frame(TF_RendererBackend *backend);
+static void tf_opengl_present(TF_RendererBackend *backend);
 static void tf_opengl_clear(TF_RendererBackend *backend, TF_ClearFlags flags);
 static void tf_opengl_set_clear_color(TF_RendererBackend *backend, TF_Color color);
 static void tf_opengl_set_viewport(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height);
+static void tf_opengl_set_camera(TF_RendererBackend *backend, const TF_CameraUniforms *camera);
 static void tf_opengl_draw_triangle(TF_RendererBackend *backend, TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3, TF_Color color);
+static void tf_opengl_draw_meshes(TF_RendererBackend *backend, const TF_MeshDraw *draws, u32 count);
+static void tf_opengl_release_mesh(TF_RendererBackend *backend, TF_Mesh *mesh);
+static b32 tf_opengl_read_pixels(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height, void *pixels);
+static u32 tf_opengl_readback_begin(TF_RendererBackend *backend, u32 *width, u32 *height);
+static b32 tf_opengl_readback_end(TF_RendererBackend *backend, u32 ticket, void *pixels, b32 wait);
+static void tf_opengl_begin_pass(TF_RendererBackend *backend, const char *name);
+static void tf_opengl_end_pass(TF_RendererBackend *backend);
+static b32 tf_opengl_get_gpu_timings(TF_RendererBackend *backend, TF_GPUTimings *timings);
+static TF_RendererStats tf_opengl_get_stats(TF_RendererBackend *backend);
+static u32 tf_opengl_get_api_calls(TF_RendererBackend *backend, TF_APICallCount *calls, u32 max_calls);
+static void tf_opengl_flush_triangles(TF_OpenGLData *gl_data);
+static void tf_opengl_upload_uniform_block(TF_OpenGLData *gl_data, u32 binding, const void *data, usize size);
+static void tf_opengl_upload_frame_uniforms(TF_OpenGLData *gl_data);
 
 // =============================================================================
 // VTable
@@ -51,10 +157,22 @@ static TF_RendererBackendVTable s_opengl_vtable = {
     .destroy = tf_opengl_destroy,
     .begin_frame = tf_opengl_begin_frame,
     .end_frame = tf_opengl_end_frame,
+    .present = tf_opengl_present,
     .clear = tf_opengl_clear,
     .set_clear_color = tf_opengl_set_clear_color,
     .set_viewport = tf_opengl_set_viewport,
-    .draw_triangle = tf_opengl_draw_triangle
+    .set_camera = tf_opengl_set_camera,
+    .draw_triangle = tf_opengl_draw_triangle,
+    .draw_meshes = tf_opengl_draw_meshes,
+    .release_mesh = tf_opengl_release_mesh,
+    .read_pixels = tf_opengl_read_pixels,
+    .readback_begin = tf_opengl_readback_begin,
+    .readback_end = tf_opengl_readback_end,
+    .begin_pass = tf_opengl_begin_pass,
+    .end_pass = tf_opengl_end_pass,
+    .get_gpu_timings = tf_opengl_get_gpu_timings,
+    .get_stats = tf_opengl_get_stats,
+    .get_api_calls = tf_opengl_get_api_calls
 };
 
 // =============================================================================
@@ -80,11 +198,60 @@ TF_RendererBackend *tf_renderer_backend_create_opengl(void) {
 // Implementation
 // =============================================================================
 
-static b32 tf_opengl_create(TF_RendererBackend *backend, TF_Window *window) {
+// Color + depth renderbuffers standing in for the default framebuffer
+static b32 tf_opengl_create_offscreen_target(TF_OpenGLData *gl_data, TF_Window *window) {
+    u32 width = 0, height = 0;
+    tf_window_get_size(window, &width, &height);
+
+    glGenRenderbuffers(1, &gl_data->offscreen_color);
+    glBindRenderbuffer(GL_RENDERBUFFER, gl_data->offscreen_color);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, (GLsizei)width, (GLsizei)height);
+    glGenRenderbuffers(1, &gl_data->offscreen_depth);
+    glBindRenderbuffer(GL_RENDERBUFFER, gl_data->offscreen_depth);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, (GLsizei)width, (GLsizei)height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    // Stays bound for the lifetime of the backend
+    glGenFramebuffers(1, &gl_data->offscreen_framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, gl_data->offscreen_framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, gl_data->offscreen_color);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, gl_data->offscreen_depth);
+
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        TF_ERROR("Offscreen framebuffer is incomplete (0x%x)", status);
+        return TF_FALSE;
+    }
+
+    glViewport(0, 0, (GLsizei)width, (GLsizei)height);
+    TF_INFO("Rendering offscreen into a %ux%u framebuffer", width, height);
+    return TF_TRUE;
+}
+
+// Swap interval for the configured present mode, on the calling thread's context
+static void tf_opengl_apply_present_mode(TF_Window *window, const TF_RendererConfig *config) {
+    TF_PresentMode mode = config->present_mode;
+    if (mode == TF_PRESENT_MODE_DEFAULT) {
+        mode = config->enable_vsync ? TF_PRESENT_MODE_VSYNC : TF_PRESENT_MODE_UNLOCKED;
+    }
+
+    if (mode == TF_PRESENT_MODE_ADAPTIVE && !tf_window_set_swap_interval(window, -1)) {
+        TF_WARN("Adaptive vsync unsupported by the driver, using vsync");
+        mode = TF_PRESENT_MODE_VSYNC;
+    }
+    if (mode != TF_PRESENT_MODE_ADAPTIVE) {
+        tf_window_set_swap_interval(window, mode == TF_PRESENT_MODE_VSYNC ? 1 : 0);
+    }
+
+    static const char *s_mode_names[] = {"default", "vsync", "adaptive vsync", "unlocked"};
+    TF_DEBUG("Present mode: %s", s_mode_names[mode]);
+}
+
+static b32 tf_opengl_create(TF_RendererBackend *backend, TF_Window *window, const TF_RendererConfig *config) {
     TF_DEBUG("Initializing OpenGL backend...");
 
-    // Initialize GLAD
-    int version = gladLoadGL(glfwGetProcAddress);
+    // Initialize GLAD (through the window layer, which knows GLFW from EGL)
+    int version = gladLoadGL(tf_window_get_proc_address);
     if (version == 0) {
         TF_ERROR("Failed to initialize OpenGL context");
         return TF_FALSE;
@@ -94,55 +261,184 @@ static b32 tf_opengl_create(TF_RendererBackend *backend, TF_Window *window) {
     TF_INFO("OpenGL Vendor: %s", glGetString(GL_VENDOR));
     TF_INFO("OpenGL Renderer: %s", glGetString(GL_RENDERER));
 
+    tf_gl_extensions_load(tf_window_get_proc_address);
+
+    // Reloading replaced the debug layer's wrappers if another renderer has it installed
+    tf_gl_debug_refresh();
+
     // Allocate OpenGL-specific data
-    TF_OpenGLData *gl_data = malloc(sizeof(TF_OpenGLData));
+    TF_OpenGLData *gl_data = calloc(1, sizeof(TF_OpenGLData));
     if (!gl_data) {
         TF_ERROR("Failed to allocate OpenGL data");
         return TF_FALSE;
     }
     backend->data = gl_data;
 
-    // Initialize OpenGL state
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GL_LESS);
+    // Shared with other renderers; tf_opengl_destroy drops this backend's use
+    tf_gl_program_cache_init(config->shader_cache_dir);
+    tf_shader_variants_init();
+
+    // Installed first so every call the backend makes from here on is counted
+    if (config->enable_api_debug) {
+        gl_data->api_debug = tf_gl_debug_install();
+    }
+
+    if (tf_window_is_headless(window) && !tf_opengl_create_offscreen_target(gl_data, window)) {
+        tf_opengl_destroy(backend);
+        return TF_FALSE;
+    }
+
+    // Uniform block ranges inside the stream buffer must honour this alignment
+    GLint ubo_alignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &ubo_alignment);
+    gl_data->uniform_buffer_alignment = ubo_alignment > 0 ? (u32)ubo_alignment : 256;
+
+    GLint viewport[4] = {0};
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    gl_data->viewport_x = viewport[0];
+    gl_data->viewport_y = viewport[1];
+    gl_data->viewport_width = (u32)viewport[2];
+    gl_data->viewport_height = (u32)viewport[3];
+    gl_data->framebuffer_width = gl_data->viewport_width;
+    gl_data->framebuffer_height = gl_data->viewport_height;
+
+    // Allocate CPU staging for the triangle batch
+    gl_data->triangle_capacity = config->triangle_batch_size ? config->triangle_batch_size
+                                                             : TF_OPENGL_DEFAULT_TRIANGLE_BATCH;
+    gl_data->triangle_vertices = malloc(sizeof(f32) * TF_OPENGL_TRIANGLE_FLOATS * gl_data->triangle_capacity);
+    if (!gl_data->triangle_vertices) {
+        TF_ERROR("Failed to allocate triangle batch (%u triangles)", gl_data->triangle_capacity);
+        tf_opengl_destroy(backend);
+        return TF_FALSE;
+    }
+
+    // Initialize OpenGL state through the shadow cache so it starts out exact
+    gl_data->state = tf_gl_state_create();
+    if (!gl_data->state) {
+        tf_opengl_destroy(backend);
+        return TF_FALSE;
+    }
+    tf_gl_state_set_depth_test(gl_data->state, config->enable_depth_test);
+
+    // Optional: frames are simply not timed without it
+    gl_data->timer = tf_gl_timer_create();
+
+    // end_frame swaps the buffers from here on; the window ignores its own swap call
+    tf_opengl_apply_present_mode(window, config);
+    gl_data->window = window;
+    tf_window_add_presenter(window);
+    gl_data->pacer = tf_gl_frame_pacer_create(config->max_frames_in_flight ? config->max_frames_in_flight
+                                                                           : TF_DEFAULT_FRAMES_IN_FLIGHT);
+    if (!gl_data->pacer) {
+        tf_opengl_destroy(backend);
+        return TF_FALSE;
+    }
 
     // Set default clear color
     gl_data->clear_color = TF_COLOR_BLUE;
     glClearColor(gl_data->clear_color.r, gl_data->clear_color.g,
                  gl_data->clear_color.b, gl_data->clear_color.a);
 
-    // Create triangle shader
-    gl_data->triangle_shader = tf_shader_create(s_triangle_vertex_shader, s_triangle_fragment_shader);
-    if (!gl_data->triangle_shader) {
-        TF_ERROR("Failed to create triangle shader");
-        free(gl_data);
+    // Built-in shaders are variants of the unlit template. Later renderers
+    // register the same includes again, which leaves them unchanged.
+    tf_shader_include_register("tunafish/frame.glsl", s_frame_include);
+    tf_shader_include_register("tunafish/camera.glsl", s_camera_include);
+
+    TF_ShaderTemplateDesc unlit_desc = {
+        .vertex_source = s_unlit_vertex_shader,
+        .fragment_source = s_unlit_fragment_shader,
+        .features = s_unlit_features,
+        .feature_count = sizeof(s_unlit_features) / sizeof(s_unlit_features[0])
+    };
+    gl_data->unlit_template = tf_shader_template_create(&unlit_desc);
+    if (!gl_data->unlit_template) {
+        TF_ERROR("Failed to create unlit shader template");
+        tf_opengl_destroy(backend);
+        return TF_FALSE;
+    }
+
+    // Both are needed from the first frame, so wait for them here
+    TF_ShaderFeatures transform = tf_shader_template_feature(gl_data->unlit_template, "TF_TRANSFORM");
+    TF_ShaderFeatures vertex_color = tf_shader_template_feature(gl_data->unlit_template, "TF_VERTEX_COLOR");
+    gl_data->triangle_shader = tf_shader_variant_acquire(gl_data->unlit_template, vertex_color);
+    gl_data->fallback_shader = tf_shader_variant_acquire(gl_data->unlit_template, transform);
+    if (tf_shader_wait(gl_data->triangle_shader) != TF_SHADER_STATUS_READY ||
+        tf_shader_wait(gl_data->fallback_shader) != TF_SHADER_STATUS_READY) {
+        TF_ERROR("Failed to create built-in shaders");
+        tf_opengl_destroy(backend);
+        return TF_FALSE;
+    }
+
+    // Stand-in for shaders that are still compiling
+    tf_shader_set_fallback(gl_data->fallback_shader);
+
+    // Triangles are 2D overlays: no depth testing or writes
+    TF_GLPipelineDesc triangle_desc = tf_gl_pipeline_desc_default(gl_data->triangle_shader);
+    triangle_desc.depth.test = TF_FALSE;
+    triangle_desc.depth.write = TF_FALSE;
+    gl_data->triangle_pipeline = tf_gl_pipeline_create(&triangle_desc);
+    if (!gl_data->triangle_pipeline) {
+        tf_opengl_destroy(backend);
+        return TF_FALSE;
+    }
+
+    // Mesh shaders compile in the background; the fallback covers the first frames
+    TF_ShaderFeatures instanced = transform | tf_shader_template_feature(gl_data->unlit_template, "TF_INSTANCED");
+    gl_data->mesh_shader = tf_shader_variant_acquire(gl_data->unlit_template, instanced);
+    gl_data->mesh_vertex_color_shader = tf_shader_variant_acquire(gl_data->unlit_template, instanced | vertex_color);
+    if (!gl_data->mesh_shader || !gl_data->mesh_vertex_color_shader) {
+        TF_ERROR("Failed to create mesh shaders");
+        tf_opengl_destroy(backend);
+        return TF_FALSE;
+    }
+
+    TF_GLPipelineDesc mesh_desc = tf_gl_pipeline_desc_default(gl_data->mesh_shader);
+    mesh_desc.depth.test = config->enable_depth_test;
+    gl_data->mesh_pipeline = tf_gl_pipeline_create(&mesh_desc);
+    mesh_desc.shader = gl_data->mesh_vertex_color_shader;
+    gl_data->mesh_vertex_color_pipeline = tf_gl_pipeline_create(&mesh_desc);
+    gl_data->vertex_arrays = tf_gl_vertex_array_cache_create();
+    if (!gl_data->mesh_pipeline || !gl_data->mesh_vertex_color_pipeline || !gl_data->vertex_arrays) {
+        tf_opengl_destroy(backend);
+        return TF_FALSE;
+    }
+
+    // Create the streaming ring; a full triangle batch must fit in one region
+    usize batch_bytes = sizeof(f32) * TF_OPENGL_TRIANGLE_FLOATS * gl_data->triangle_capacity;
+    usize region_size = batch_bytes > TF_OPENGL_STREAM_REGION_SIZE ? batch_bytes : TF_OPENGL_STREAM_REGION_SIZE;
+    gl_data->stream = tf_gl_stream_buffer_create(region_size);
+    if (!gl_data->stream) {
+        TF_ERROR("Failed to create stream buffer");
+        tf_opengl_destroy(backend);
         return TF_FALSE;
     }
 
     // Create VAO for triangle rendering
+    // 3 vertices * (3 floats position + 4 floats color) = 21 floats per triangle
     glGenVertexArrays(1, &gl_data->triangle_vao);
-    glBindVertexArray(gl_data->triangle_vao);
-
-    // Create VBO for triangle vertices (position + color per vertex)
-    // 3 vertices * (3 floats position + 4 floats color) = 21 floats
-    glGenBuffers(1, &gl_data->triangle_vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, gl_data->triangle_vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(f32) * 21, NULL, GL_DYNAMIC_DRAW);
+    tf_gl_state_bind_vertex_array(gl_data->state, gl_data->triangle_vao);
+    tf_gl_state_bind_array_buffer(gl_data->state, gl_data->stream->buffer);
 
     // Position attribute (location 0)
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 7 * sizeof(f32), (void *)0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, TF_OPENGL_TRIANGLE_VERTEX_FLOATS * sizeof(f32), (void *)0);
     glEnableVertexAttribArray(0);
 
     // Color attribute (location 1)
-    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 7 * sizeof(f32), (void *)(3 * sizeof(f32)));
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, TF_OPENGL_TRIANGLE_VERTEX_FLOATS * sizeof(f32),
+                          (void *)(3 * sizeof(f32)));
     glEnableVertexAttribArray(1);
 
-    glBindVertexArray(0);
+    tf_gl_state_bind_vertex_array(gl_data->state, 0);
 
-    TF_INFO("OpenGL backend initialized successfully");
+    TF_ShaderCacheStats cache_stats = tf_gl_program_cache_get_stats();
+    TF_INFO("Shader startup: %u compiled in %.2f ms, %u loaded from cache in %.2f ms",
+            cache_stats.compiled, cache_stats.compile_time_ms, cache_stats.hits, cache_stats.load_time_ms);
+
+    TF_INFO("OpenGL backend initialized successfully (triangle batch: %u)", gl_data->triangle_capacity);
     return TF_TRUE;
 }
 
+// Also used to unwind a partially created backend, so every member may be unset
 static void tf_opengl_destroy(TF_RendererBackend *backend) {
     if (!backend || !backend->data) return;
 
@@ -151,40 +447,144 @@ static void tf_opengl_destroy(TF_RendererBackend *backend) {
     TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
 
     // Clean up OpenGL resources
-    if (gl_data->triangle_vbo) {
-        glDeleteBuffers(1, &gl_data->triangle_vbo);
+    if (gl_data->stream) {
+        tf_gl_stream_buffer_destroy(gl_data->stream);
     }
     if (gl_data->triangle_vao) {
         glDeleteVertexArrays(1, &gl_data->triangle_vao);
     }
-    if (gl_data->triangle_shader) {
-        tf_shader_destroy(gl_data->triangle_shader);
+    if (gl_data->triangle_pipeline) {
+        tf_gl_pipeline_destroy(gl_data->triangle_pipeline);
     }
 
+    // Meshes outlive the backend, detach them from their GPU copies
+    for (u32 i = 0; i < gl_data->mesh_count; i++) {
+        TF_GLMesh *gl_mesh = gl_data->meshes[i];
+        gl_mesh->mesh->gpu_owner = NULL;
+        gl_mesh->mesh->gpu_data = NULL;
+        if (!gl_mesh->arena) {
+            tf_gl_mesh_destroy(gl_mesh);
+        }
+    }
+    free(gl_data->meshes);
+    for (u32 i = 0; i < gl_data->arena_count; i++) {
+        tf_gl_geometry_arena_destroy(gl_data->arenas[i]);
+    }
+    free(gl_data->arenas);
+    free(gl_data->multi_draw_counts);
+    free(gl_data->multi_draw_offsets);
+    free(gl_data->multi_draw_base_vertices);
+    tf_gl_vertex_array_cache_destroy(gl_data->vertex_arrays);
+    if (gl_data->mesh_pipeline) {
+        tf_gl_pipeline_destroy(gl_data->mesh_pipeline);
+    }
+    if (gl_data->mesh_vertex_color_pipeline) {
+        tf_gl_pipeline_destroy(gl_data->mesh_vertex_color_pipeline);
+    }
+    tf_shader_variant_release(gl_data->mesh_shader);
+    tf_shader_variant_release(gl_data->mesh_vertex_color_shader);
+    tf_shader_variant_release(gl_data->triangle_shader);
+    tf_shader_variant_release(gl_data->fallback_shader);
+    tf_shader_template_destroy(gl_data->unlit_template);
+    tf_shader_variants_shutdown(); // Only the last renderer's clears the registry
+    if (gl_data->state) {
+        tf_gl_state_destroy(gl_data->state);
+    }
+    tf_gl_readback_destroy(gl_data->readback);
+    tf_gl_timer_destroy(gl_data->timer);
+    tf_gl_frame_pacer_destroy(gl_data->pacer);
+    tf_window_remove_presenter(gl_data->window);
+    if (gl_data->offscreen_framebuffer) {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteFramebuffers(1, &gl_data->offscreen_framebuffer);
+    }
+    if (gl_data->offscreen_color) {
+        glDeleteRenderbuffers(1, &gl_data->offscreen_color);
+    }
+    if (gl_data->offscreen_depth) {
+        glDeleteRenderbuffers(1, &gl_data->offscreen_depth);
+    }
+
+    if (gl_data->api_debug) {
+        tf_gl_debug_uninstall();
+    }
+
+    free(gl_data->triangle_vertices);
     free(gl_data);
     backend->data = NULL;
 
+    tf_gl_program_cache_shutdown();
+
     TF_INFO("OpenGL backend destroyed");
 }
 
 static void tf_opengl_begin_frame(TF_RendererBackend *backend) {
-    (void)backend;
-    // Nothing special needed for begin frame
+    if (!backend || !backend->data) return;
+
+    TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+    gl_data->stats = (TF_RendererStats){0};
+    tf_gl_frame_pacer_begin_frame(gl_data->pacer);
+    tf_gl_stream_buffer_reset_stats(gl_data->stream);
+    tf_gl_state_reset_stats(gl_data->state);
+    tf_gl_timer_begin_frame(gl_data->timer);
+    if (gl_data->api_debug) {
+        tf_gl_debug_reset_stats();
+    }
+
+    // Bindings may have been changed outside the backend (e.g. tf_shader_bind)
+    tf_gl_state_invalidate_bindings(gl_data->state);
+
+    // Pick up shaders that finished compiling since the last frame
+    tf_shader_poll_pending();
+
+    // Per-frame block, shared by every shader that declares it
+    gl_data->frame_uniforms.time = (TF_Vec4){(f32)tf_time_get_elapsed(), tf_time_get_delta(), 0.0f, 0.0f};
+    tf_opengl_upload_frame_uniforms(gl_data);
 }
 
 static void tf_opengl_end_frame(TF_RendererBackend *backend) {
-    (void)backend;
-    // Nothing special needed for end frame
+    if (!backend || !backend->data) return;
+
+    TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+    tf_opengl_flush_triangles(gl_data);
+    tf_gl_timer_end_frame(gl_data->timer);
+    tf_gl_stream_buffer_end_frame(gl_data->stream);
+
+    // Compact arenas whose free space has splintered from meshes coming and going
+    for (u32 i = 0; i < gl_data->arena_count; i++) {
+        TF_GLGeometryArena *arena = gl_data->arenas[i];
+        if (arena->vertices.free_count > TF_OPENGL_ARENA_DEFRAG_RANGES ||
+            arena->indices.free_count > TF_OPENGL_ARENA_DEFRAG_RANGES) {
+            tf_gl_geometry_arena_defragment(arena);
+        }
+    }
+}
+
+static void tf_opengl_present(TF_RendererBackend *backend) {
+    if (!backend || !backend->data) return;
+
+    TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+    tf_gl_frame_pacer_present(gl_data->pacer, gl_data->window);
+
+    gl_data->stats.cpu_to_swap_ms = gl_data->pacer->cpu_to_swap_ms;
+    gl_data->stats.present_wait_ms = gl_data->pacer->wait_ms;
+    gl_data->stats.frames_in_flight = gl_data->pacer->frames_in_flight;
 }
 
 static void tf_opengl_clear(TF_RendererBackend *backend, TF_ClearFlags flags) {
-    (void)backend;
+    if (!backend || !backend->data) return;
+
+    // Batched triangles were submitted before this clear
+    TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+    tf_opengl_flush_triangles(gl_data);
 
     GLbitfield gl_flags = 0;
     if (flags & TF_CLEAR_COLOR) {
         gl_flags |= GL_COLOR_BUFFER_BIT;
     }
     if (flags & TF_CLEAR_DEPTH) {
+        // glClear honours the depth mask
+        tf_gl_state_set_depth_write(gl_data->state, TF_TRUE);
         gl_flags |= GL_DEPTH_BUFFER_BIT;
     }
     glClear(gl_flags);
@@ -202,12 +602,24 @@ static void tf_opengl_set_viewport(TF_RendererBackend *backend, i32 x, i32 y, u3
     if (!backend || !backend->data) return;
 
     TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+    tf_opengl_flush_triangles(gl_data);
+
     gl_data->viewport_x = x;
     gl_data->viewport_y = y;
     gl_data->viewport_width = width;
     gl_data->viewport_height = height;
 
     glViewport(x, y, width, height);
+
+    // Draws after this point must see the new viewport in TF_FrameData
+    tf_opengl_upload_frame_uniforms(gl_data);
+}
+
+static void tf_opengl_set_camera(TF_RendererBackend *backend, const TF_CameraUniforms *camera) {
+    if (!backend || !backend->data || !camera) return;
+
+    TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+    tf_opengl_upload_uniform_block(gl_data, TF_SHADER_CAMERA_BINDING, camera, sizeof(*camera));
 }
 
 static void tf_opengl_draw_triangle(TF_RendererBackend *backend, TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3, TF_Color color) {
@@ -215,30 +627,512 @@ static void tf_opengl_draw_triangle(TF_RendererBackend *backend, TF_Vec3 p1, TF_
 
     TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
 
-    // Vertex data: position (3) + color (4) per vertex
-    f32 vertices[] = {
-        // Vertex 1
-        p1.x, p1.y, p1.z,  color.r, color.g, color.b, color.a,
-        // Vertex 2
-        p2.x, p2.y, p2.z,  color.r, color.g, color.b, color.a,
-        // Vertex 3
-        p3.x, p3.y, p3.z,  color.r, color.g, color.b, color.a
-    };
+    if (gl_data->triangle_count == gl_data->triangle_capacity) {
+        tf_opengl_flush_triangles(gl_data);
+    }
+
+    // Append vertex data: position (3) + color (4) per vertex
+    f32 *v = gl_data->triangle_vertices + (usize)gl_data->triangle_count * TF_OPENGL_TRIANGLE_FLOATS;
+    v[0] = p1.x;  v[1] = p1.y;  v[2] = p1.z;
+    v[3] = color.r;  v[4] = color.g;  v[5] = color.b;  v[6] = color.a;
+    v[7] = p2.x;  v[8] = p2.y;  v[9] = p2.z;
+    v[10] = color.r; v[11] = color.g; v[12] = color.b; v[13] = color.a;
+    v[14] = p3.x; v[15] = p3.y; v[16] = p3.z;
+    v[17] = color.r; v[18] = color.g; v[19] = color.b; v[20] = color.a;
+
+    gl_data->triangle_count++;
+    gl_data->stats.triangles++;
+}
+
+// Arena shared by every mesh with this layout, created on first use
+static TF_GLGeometryArena *tf_opengl_get_arena(TF_OpenGLData *gl_data, const TF_VertexLayout *layout) {
+    u64 layout_hash = tf_gl_vertex_layout_hash(layout);
+    for (u32 i = 0; i < gl_data->arena_count; i++) {
+        if (gl_data->arenas[i]->layout_hash == layout_hash) {
+            return gl_data->arenas[i];
+        }
+    }
 
-    // Update VBO with new vertex data
-    glBindBuffer(GL_ARRAY_BUFFER, gl_data->triangle_vbo);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
+    if (gl_data->arena_count == gl_data->arena_capacity) {
+        u32 capacity = gl_data->arena_capacity ? gl_data->arena_capacity * 2 : 4;
+        TF_GLGeometryArena **arenas = realloc(gl_data->arenas, sizeof(TF_GLGeometryArena *) * capacity);
+        if (!arenas) {
+            TF_ERROR("Failed to grow geometry arena list");
+            return NULL;
+        }
+        gl_data->arenas = arenas;
+        gl_data->arena_capacity = capacity;
+    }
 
-    // Bind shader and VAO, then draw
-    tf_shader_bind(gl_data->triangle_shader);
-    glBindVertexArray(gl_data->triangle_vao);
+    TF_GLGeometryArena *arena = tf_gl_geometry_arena_create(layout, TF_OPENGL_ARENA_VERTICES, TF_OPENGL_ARENA_INDICES,
+                                                            gl_data->vertex_arrays, gl_data->state,
+                                                            gl_data->stream->buffer);
+    if (arena) {
+        gl_data->arenas[gl_data->arena_count++] = arena;
+    }
+    return arena;
+}
 
-    // Ensure proper GL state for 2D triangle rendering
-    glDisable(GL_DEPTH_TEST);
+// Upload on first use; the mesh keeps a pointer back to its GPU copy
+static TF_GLMesh *tf_opengl_get_gl_mesh(TF_RendererBackend *backend, TF_Mesh *mesh) {
+    if (mesh->gpu_owner == backend) {
+        return (TF_GLMesh *)mesh->gpu_data;
+    }
 
-    glDrawArrays(GL_TRIANGLES, 0, 3);
+    if (mesh->gpu_owner) {
+        TF_WARN("Mesh %u is already resident in another renderer", mesh->id);
+        return NULL;
+    }
+
+    TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+    if (gl_data->mesh_count == gl_data->mesh_capacity) {
+        u32 capacity = gl_data->mesh_capacity ? gl_data->mesh_capacity * 2 : 64;
+        TF_GLMesh **meshes = realloc(gl_data->meshes, sizeof(TF_GLMesh *) * capacity);
+        if (!meshes) {
+            TF_ERROR("Failed to grow mesh list");
+            return NULL;
+        }
+        gl_data->meshes = meshes;
+        gl_data->mesh_capacity = capacity;
+    }
+
+    // Small meshes go into the shared arena, large ones get their own buffers
+    TF_GLMesh *gl_mesh = NULL;
+    if (mesh->vertex_count <= TF_GL_GEOMETRY_ARENA_MAX_MESH_VERTICES) {
+        TF_GLGeometryArena *arena = tf_opengl_get_arena(gl_data, &mesh->layout);
+        gl_mesh = tf_gl_geometry_arena_add(arena, mesh);
+        if (!gl_mesh) return NULL;
+    } else {
+        gl_mesh = tf_gl_mesh_create(mesh);
+        if (!gl_mesh) return NULL;
+
+        // Instance data is streamed, so every mesh VAO reads it from the ring
+        gl_mesh->vertex_array = tf_gl_vertex_array_cache_get(gl_data->vertex_arrays, gl_data->state, &mesh->layout,
+                                                             gl_mesh->vertex_buffer, gl_mesh->index_buffer,
+                                                             gl_data->stream->buffer);
+        if (!gl_mesh->vertex_array) {
+            tf_gl_mesh_destroy(gl_mesh);
+            return NULL;
+        }
+    }
+
+    gl_data->meshes[gl_data->mesh_count++] = gl_mesh;
+    mesh->gpu_owner = backend;
+    mesh->gpu_data = gl_mesh;
+    return gl_mesh;
+}
+
+static const TF_GLPipeline *tf_opengl_mesh_pipeline(const TF_OpenGLData *gl_data, const TF_Mesh *mesh) {
+    return tf_vertex_layout_has(&mesh->layout, TF_VERTEX_ATTRIBUTE_COLOR) ? gl_data->mesh_vertex_color_pipeline
+                                                                          : gl_data->mesh_pipeline;
+}
+
+// Bind the VAO that holds the mesh (arena VAOs are rebuilt after a repack)
+static b32 tf_opengl_bind_mesh(TF_OpenGLData *gl_data, TF_GLMesh *gl_mesh) {
+    u32 vertex_array = gl_mesh->arena ? tf_gl_geometry_arena_get_vertex_array(gl_mesh->arena)
+                                      : gl_mesh->vertex_array;
+    if (!vertex_array) return TF_FALSE;
+
+    tf_gl_state_bind_vertex_array(gl_data->state, vertex_array);
+    return TF_TRUE;
+}
+
+// Byte offset of a mesh's index first_index (relative to the mesh) in its index buffer
+static const void *tf_opengl_mesh_index_offset(const TF_GLMesh *gl_mesh, u32 first_index) {
+    usize index_size = gl_mesh->index_type == GL_UNSIGNED_SHORT ? sizeof(u16) : sizeof(u32);
+    return (const void *)((gl_mesh->first_index + first_index) * index_size);
+}
+
+static b32 tf_opengl_reserve_multi_draw(TF_OpenGLData *gl_data, u32 count) {
+    if (count <= gl_data->multi_draw_capacity) {
+        return TF_TRUE;
+    }
+
+    u32 capacity = gl_data->multi_draw_capacity ? gl_data->multi_draw_capacity : 64;
+    while (capacity < count) {
+        capacity *= 2;
+    }
+    i32 *counts = realloc(gl_data->multi_draw_counts, sizeof(i32) * capacity);
+    if (counts) gl_data->multi_draw_counts = counts;
+    const void **offsets = realloc(gl_data->multi_draw_offsets, sizeof(const void *) * capacity);
+    if (offsets) gl_data->multi_draw_offsets = offsets;
+    i32 *base_vertices = realloc(gl_data->multi_draw_base_vertices, sizeof(i32) * capacity);
+    if (base_vertices) gl_data->multi_draw_base_vertices = base_vertices;
+    if (!counts || !offsets || !base_vertices) {
+        TF_ERROR("Failed to grow multi-draw parameters to %u draws", capacity);
+        return TF_FALSE;
+    }
+    gl_data->multi_draw_capacity = capacity;
+    return TF_TRUE;
+}
+
+// The fallback standing in for a compiling mesh shader is not instanced, so
+// draw the instances one by one through tf_model for those first frames
+static void tf_opengl_draw_mesh_fallback(TF_OpenGLData *gl_data, TF_Shader *shader, const TF_GLMesh *gl_mesh,
+                                         const TF_InstanceData *instances, u32 count, const TF_IndexRange *ranges,
+                                         u32 range_count) {
+    TF_ShaderUniform model_uniform = tf_shader_get_uniform(shader, "tf_model");
+    for (u32 i = 0; i < count; i++) {
+        TF_Mat4 model = tf_mat4_identity();
+        for (u32 row = 0; row < 3; row++) {
+            for (u32 column = 0; column < 4; column++) {
+                model.m[column * 4 + row] = instances[i].transform[row * 4 + column];
+            }
+        }
+        tf_shader_set_mat4(shader, model_uniform, &model);
+        for (u32 r = 0; r < range_count; r++) {
+            glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)ranges[r].index_count, gl_mesh->index_type,
+                                     tf_opengl_mesh_index_offset(gl_mesh, ranges[r].first_index),
+                                     (GLint)gl_mesh->base_vertex);
+        }
+    }
+
+    gl_data->stats.draw_calls += count * range_count;
+}
+
+// Several ranges of one mesh go out as a glMultiDrawElementsBaseVertex per
+// instance; multi-draws have no instance count, so the instance attributes
+// point at each instance in turn
+static void tf_opengl_multi_draw_ranges(TF_OpenGLData *gl_data, const TF_GLMesh *gl_mesh, usize offset, u32 count,
+                                        const TF_IndexRange *ranges, u32 range_count) {
+    if (!tf_opengl_reserve_multi_draw(gl_data, range_count)) {
+        return;
+    }
+
+    for (u32 r = 0; r < range_count; r++) {
+        gl_data->multi_draw_counts[r] = (i32)ranges[r].index_count;
+        gl_data->multi_draw_offsets[r] = tf_opengl_mesh_index_offset(gl_mesh, ranges[r].first_index);
+        gl_data->multi_draw_base_vertices[r] = (i32)gl_mesh->base_vertex;
+    }
+
+    tf_gl_state_bind_array_buffer(gl_data->state, gl_data->stream->buffer);
+    for (u32 i = 0; i < count; i++) {
+        tf_gl_set_instance_attributes(offset + sizeof(TF_InstanceData) * i);
+        glMultiDrawElementsBaseVertex(GL_TRIANGLES, gl_data->multi_draw_counts, gl_mesh->index_type,
+                                      gl_data->multi_draw_offsets, (GLsizei)range_count,
+                                      gl_data->multi_draw_base_vertices);
+    }
+    if (tf_gl_extensions_get()->base_instance) {
+        tf_gl_set_instance_attributes(0);
+    }
+
+    gl_data->stats.draw_calls += count;
+}
+
+static void tf_opengl_draw_mesh_instances(TF_OpenGLData *gl_data, TF_GLMesh *gl_mesh, const TF_MeshDraw *draw) {
+    const TF_GLPipeline *pipeline = tf_opengl_mesh_pipeline(gl_data, gl_mesh->mesh);
+    tf_gl_state_apply_pipeline(gl_data->state, pipeline);
+    if (!tf_opengl_bind_mesh(gl_data, gl_mesh)) return;
+
+    const TF_InstanceData *instances = draw->instances;
+    u32 count = draw->instance_count;
+    const TF_IndexRange whole = {0, gl_mesh->index_count};
+    const TF_IndexRange *ranges = draw->range_count ? draw->ranges : &whole;
+    u32 range_count = draw->range_count ? draw->range_count : 1;
+    u32 index_count = 0;
+    for (u32 r = 0; r < range_count; r++) {
+        index_count += ranges[r].index_count;
+    }
+
+    gl_data->stats.instances += count;
+    gl_data->stats.triangles += index_count / 3 * count;
+
+    TF_Shader *shader = tf_shader_resolve(pipeline->desc.shader);
+    if (shader != pipeline->desc.shader) {
+        tf_opengl_draw_mesh_fallback(gl_data, shader, gl_mesh, instances, count, ranges, range_count);
+        return;
+    }
+
+    const TF_GLExtensions *extensions = tf_gl_extensions_get();
+    const void *index_offset = tf_opengl_mesh_index_offset(gl_mesh, ranges[0].first_index);
+    u32 first = 0;
+    while (first < count) {
+        u32 batch = count - first;
+        if (batch > TF_OPENGL_MAX_INSTANCES_PER_DRAW) {
+            batch = TF_OPENGL_MAX_INSTANCES_PER_DRAW;
+        }
+
+        // Instance-size alignment lets the stream offset double as the base instance
+        usize offset;
+        if (!tf_gl_stream_buffer_write(gl_data->stream, instances + first, sizeof(TF_InstanceData) * batch,
+                                       sizeof(TF_InstanceData), &offset)) {
+            TF_ERROR("Failed to stream %u instances of mesh %u", batch, gl_mesh->mesh->id);
+            return;
+        }
+
+        if (range_count > 1) {
+            tf_opengl_multi_draw_ranges(gl_data, gl_mesh, offset, batch, ranges, range_count);
+        } else if (extensions->base_instance) {
+            extensions->glDrawElementsInstancedBaseVertexBaseInstance(
+                GL_TRIANGLES, (GLsizei)ranges[0].index_count, gl_mesh->index_type, index_offset, (GLsizei)batch,
+                (GLint)gl_mesh->base_vertex, (GLuint)(offset / sizeof(TF_InstanceData)));
+            gl_data->stats.draw_calls++;
+        } else {
+            tf_gl_state_bind_array_buffer(gl_data->state, gl_data->stream->buffer);
+            tf_gl_set_instance_attributes(offset);
+            glDrawElementsInstancedBaseVertex(GL_TRIANGLES, (GLsizei)ranges[0].index_count, gl_mesh->index_type,
+                                              index_offset, (GLsizei)batch, (GLint)gl_mesh->base_vertex);
+            gl_data->stats.draw_calls++;
+        }
+
+        first += batch;
+    }
+}
+
+// Different arena meshes sharing one instance (typically static level geometry
+// at the identity transform) go out as a single glMultiDrawElementsBaseVertex
+static void tf_opengl_multi_draw_meshes(TF_OpenGLData *gl_data, const TF_MeshDraw *draws, u32 count) {
+    if (!tf_opengl_reserve_multi_draw(gl_data, count)) {
+        return;
+    }
+
+    TF_GLMesh *head = (TF_GLMesh *)draws[0].mesh->gpu_data;
+    tf_gl_state_apply_pipeline(gl_data->state, tf_opengl_mesh_pipeline(gl_data, head->mesh));
+    if (!tf_opengl_bind_mesh(gl_data, head)) return;
+
+    usize offset;
+    if (!tf_gl_stream_buffer_write(gl_data->stream, draws[0].instances, sizeof(TF_InstanceData),
+                                   sizeof(TF_InstanceData), &offset)) {
+        TF_ERROR("Failed to stream instance for %u merged meshes", count);
+        return;
+    }
+
+    for (u32 i = 0; i < count; i++) {
+        const TF_GLMesh *gl_mesh = (const TF_GLMesh *)draws[i].mesh->gpu_data;
+        gl_data->multi_draw_counts[i] = (i32)gl_mesh->index_count;
+        gl_data->multi_draw_offsets[i] = tf_opengl_mesh_index_offset(gl_mesh, 0);
+        gl_data->multi_draw_base_vertices[i] = (i32)gl_mesh->base_vertex;
+        gl_data->stats.triangles += gl_mesh->index_count / 3;
+    }
+
+    // Multi-draws have no base instance, so point the instance attributes at
+    // the data and restore them for base-instance draws afterwards
+    tf_gl_state_bind_array_buffer(gl_data->state, gl_data->stream->buffer);
+    tf_gl_set_instance_attributes(offset);
+    glMultiDrawElementsBaseVertex(GL_TRIANGLES, gl_data->multi_draw_counts, GL_UNSIGNED_SHORT,
+                                  gl_data->multi_draw_offsets, (GLsizei)count, gl_data->multi_draw_base_vertices);
+    if (tf_gl_extensions_get()->base_instance) {
+        tf_gl_set_instance_attributes(0);
+    }
+
+    gl_data->stats.draw_calls++;
+    gl_data->stats.instances += count;
+}
+
+// Whether draw can join a multi-draw started by head
+static b32 tf_opengl_can_multi_draw(TF_RendererBackend *backend, const TF_MeshDraw *head, const TF_MeshDraw *draw) {
+    if (draw->instance_count != 1 || draw->range_count != 0 ||
+        tf_vertex_layout_has(&draw->mesh->layout, TF_VERTEX_ATTRIBUTE_COLOR) !=
+        tf_vertex_layout_has(&head->mesh->layout, TF_VERTEX_ATTRIBUTE_COLOR) ||
+        memcmp(draw->instances, head->instances, sizeof(TF_InstanceData)) != 0) {
+        return TF_FALSE;
+    }
+
+    TF_GLMesh *gl_mesh = tf_opengl_get_gl_mesh(backend, draw->mesh);
+    return gl_mesh && gl_mesh->arena == ((TF_GLMesh *)head->mesh->gpu_data)->arena;
+}
+
+static void tf_opengl_draw_meshes(TF_RendererBackend *backend, const TF_MeshDraw *draws, u32 count) {
+    if (!backend || !backend->data || !draws) return;
+
+    TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+
+    // Batched triangles were submitted before these meshes
+    tf_opengl_flush_triangles(gl_data);
+
+    u32 i = 0;
+    while (i < count) {
+        const TF_MeshDraw *draw = &draws[i];
+        TF_GLMesh *gl_mesh = draw->mesh ? tf_opengl_get_gl_mesh(backend, draw->mesh) : NULL;
+        if (!gl_mesh || !draw->instances || draw->instance_count == 0) {
+            i++;
+            continue;
+        }
+
+        // Multi-draws need the real instanced shader, not the fallback
+        u32 end = i + 1;
+        const TF_GLPipeline *pipeline = tf_opengl_mesh_pipeline(gl_data, draw->mesh);
+        if (gl_mesh->arena && draw->instance_count == 1 && draw->range_count == 0 &&
+            tf_shader_resolve(pipeline->desc.shader) == pipeline->desc.shader) {
+            while (end < count && draws[end].mesh && tf_opengl_can_multi_draw(backend, draw, &draws[end])) {
+                end++;
+            }
+        }
+
+        if (end - i > 1) {
+            tf_opengl_multi_draw_meshes(gl_data, draw, end - i);
+        } else {
+            tf_opengl_draw_mesh_instances(gl_data, gl_mesh, draw);
+        }
+        i = end;
+    }
+}
+
+static void tf_opengl_release_mesh(TF_RendererBackend *backend, TF_Mesh *mesh) {
+    if (!backend || !backend->data || !mesh || mesh->gpu_owner != backend) return;
+
+    TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+    TF_GLMesh *gl_mesh = (TF_GLMesh *)mesh->gpu_data;
+
+    for (u32 i = 0; i < gl_data->mesh_count; i++) {
+        if (gl_data->meshes[i] == gl_mesh) {
+            gl_data->meshes[i] = gl_data->meshes[--gl_data->mesh_count];
+            break;
+        }
+    }
+
+    if (gl_mesh->arena) {
+        tf_gl_geometry_arena_remove(gl_mesh->arena, gl_mesh);
+    } else {
+        tf_gl_vertex_array_cache_evict(gl_data->vertex_arrays, gl_data->state, gl_mesh->vertex_buffer);
+        tf_gl_vertex_array_cache_evict(gl_data->vertex_arrays, gl_data->state, gl_mesh->index_buffer);
+        tf_gl_mesh_destroy(gl_mesh);
+    }
+
+    mesh->gpu_owner = NULL;
+    mesh->gpu_data = NULL;
+}
+
+// Synchronous: waits for every submitted draw to finish
+static b32 tf_opengl_read_pixels(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height, void *pixels) {
+    if (!backend || !backend->data) return TF_FALSE;
+
+    TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+    tf_opengl_flush_triangles(gl_data);
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadPixels(x, y, (GLsizei)width, (GLsizei)height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    return glGetError() == GL_NO_ERROR;
+}
+
+static u32 tf_opengl_readback_begin(TF_RendererBackend *backend, u32 *width, u32 *height) {
+    if (!backend || !backend->data) return 0;
+
+    // Created on first use, most renderers never capture
+    TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+    if (!gl_data->readback) {
+        gl_data->readback = tf_gl_readback_create();
+        if (!gl_data->readback) return 0;
+    }
+
+    tf_opengl_flush_triangles(gl_data);
+    *width = gl_data->framebuffer_width;
+    *height = gl_data->framebuffer_height;
+    return tf_gl_readback_begin(gl_data->readback, gl_data->framebuffer_width, gl_data->framebuffer_height);
+}
+
+static b32 tf_opengl_readback_end(TF_RendererBackend *backend, u32 ticket, void *pixels, b32 wait) {
+    if (!backend || !backend->data) return TF_FALSE;
+
+    TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+    return tf_gl_readback_end(gl_data->readback, ticket, pixels, wait);
+}
+
+static void tf_opengl_begin_pass(TF_RendererBackend *backend, const char *name) {
+    if (!backend || !backend->data) return;
+
+    // Batched triangles belong to whatever came before the pass
+    TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+    tf_opengl_flush_triangles(gl_data);
+    tf_gl_timer_begin_pass(gl_data->timer, name);
+}
+
+static void tf_opengl_end_pass(TF_RendererBackend *backend) {
+    if (!backend || !backend->data) return;
+
+    TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+    tf_opengl_flush_triangles(gl_data);
+    tf_gl_timer_end_pass(gl_data->timer);
+}
+
+static b32 tf_opengl_get_gpu_timings(TF_RendererBackend *backend, TF_GPUTimings *timings) {
+    if (!backend || !backend->data) return TF_FALSE;
+
+    TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+    if (!gl_data->timer || gl_data->timer->latest.frame == 0) {
+        return TF_FALSE;
+    }
+
+    *timings = gl_data->timer->latest;
+    return TF_TRUE;
+}
+
+static TF_RendererStats tf_opengl_get_stats(TF_RendererBackend *backend) {
+    if (!backend || !backend->data) return (TF_RendererStats){0};
+
+    TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+    TF_RendererStats stats = gl_data->stats;
+    stats.bytes_uploaded = gl_data->stream->bytes_written;
+    stats.stream_waits = gl_data->stream->waits;
+    stats.state_calls_issued = gl_data->state->calls_issued;
+    stats.state_calls_filtered = gl_data->state->calls_filtered;
+    stats.program_binds = gl_data->state->program_binds;
+    stats.vertex_array_binds = gl_data->state->vertex_array_binds;
+    stats.buffer_binds = gl_data->state->buffer_binds;
+    if (gl_data->api_debug) {
+        TF_GLDebugStats debug = tf_gl_debug_get_stats();
+        stats.texture_binds = debug.texture_binds;
+        stats.api_calls = debug.calls;
+        stats.api_redundant_binds = debug.redundant_binds;
+        stats.api_messages = debug.messages;
+    }
+    if (gl_data->timer) {
+        stats.gpu_frame_ms = gl_data->timer->latest.frame_ms;
+    }
+    return stats;
+}
+
+static u32 tf_opengl_get_api_calls(TF_RendererBackend *backend, TF_APICallCount *calls, u32 max_calls) {
+    if (!backend || !backend->data) return 0;
+
+    TF_OpenGLData *gl_data = (TF_OpenGLData *)backend->data;
+    if (!gl_data->api_debug) {
+        return 0;
+    }
+
+    return tf_gl_debug_get_calls(calls, max_calls);
+}
+
+// Submit every buffered triangle in a single draw
+static void tf_opengl_flush_triangles(TF_OpenGLData *gl_data) {
+    if (gl_data->triangle_count == 0) return;
+
+    usize stride = sizeof(f32) * TF_OPENGL_TRIANGLE_VERTEX_FLOATS;
+    usize size = sizeof(f32) * TF_OPENGL_TRIANGLE_FLOATS * gl_data->triangle_count;
+
+    // Vertex-stride alignment lets the stream offset double as the first vertex index
+    usize offset;
+    if (!tf_gl_stream_buffer_write(gl_data->stream, gl_data->triangle_vertices, size, stride, &offset)) {
+        TF_ERROR("Failed to stream %u triangles", gl_data->triangle_count);
+        gl_data->triangle_count = 0;
+        return;
+    }
+
+    // Only state that differs from the previous draw reaches the driver
+    tf_gl_state_apply_pipeline(gl_data->state, gl_data->triangle_pipeline);
+    tf_gl_state_bind_vertex_array(gl_data->state, gl_data->triangle_vao);
+
+    glDrawArrays(GL_TRIANGLES, (GLint)(offset / stride), (GLsizei)(gl_data->triangle_count * 3));
+
+    gl_data->stats.draw_calls++;
+    gl_data->stats.batch_flushes++;
+    gl_data->triangle_count = 0;
+}
+
+// Stream a std140 block and bind its range; earlier draws keep the range they were issued with
+static void tf_opengl_upload_uniform_block(TF_OpenGLData *gl_data, u32 binding, const void *data, usize size) {
+    usize offset = 0;
+    if (!tf_gl_stream_buffer_write(gl_data->stream, data, size, gl_data->uniform_buffer_alignment, &offset)) {
+        TF_ERROR("Failed to upload uniform block for binding %u", binding);
+        return;
+    }
+
+    glBindBufferRange(GL_UNIFORM_BUFFER, binding, gl_data->stream->buffer, (GLintptr)offset, (GLsizeiptr)size);
+}
 
-    glEnable(GL_DEPTH_TEST);
-    glBindVertexArray(0);
-    tf_shader_unbind();
+static void tf_opengl_upload_frame_uniforms(TF_OpenGLData *gl_data) {
+    gl_data->frame_uniforms.viewport = (TF_Vec4){(f32)gl_data->viewport_x, (f32)gl_data->viewport_y,
+                                                 (f32)gl_data->viewport_width, (f32)gl_data->viewport_height};
+    tf_opengl_upload_uniform_block(gl_data, TF_SHADER_FRAME_BINDING, &gl_data->frame_uniforms,
+                                   sizeof(gl_data->frame_uniforms));
 }
@@ -0,0 +1,257 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "renderer/backend/opengl/gl_state.h"
+#include "tunafish/core/log.h"
+#include <stdlib.h>
+
+// =============================================================================
+// Pipeline state objects
+// =============================================================================
+
+TF_GLPipelineDesc tf_gl_pipeline_desc_default(TF_Shader *shader) {
+    TF_GLPipelineDesc desc = {0};
+    desc.shader = shader;
+    desc.depth.test = TF_TRUE;
+    desc.depth.write = TF_TRUE;
+    desc.depth.func = GL_LESS;
+    desc.blend.enabled = TF_FALSE;
+    desc.blend.src = GL_ONE;
+    desc.blend.dst = GL_ZERO;
+    desc.raster.cull = TF_FALSE;
+    desc.raster.cull_face = GL_BACK;
+    desc.raster.front_face = GL_CCW;
+    return desc;
+}
+
+TF_GLPipeline *tf_gl_pipeline_create(const TF_GLPipelineDesc *desc) {
+    if (!desc) {
+        TF_ERROR("Pipeline description cannot be null");
+        return NULL;
+    }
+
+    TF_GLPipeline *pipeline = malloc(sizeof(TF_GLPipeline));
+    if (!pipeline) {
+        TF_ERROR("Failed to allocate pipeline");
+        return NULL;
+    }
+
+    pipeline->desc = *desc;
+    return pipeline;
+}
+
+void tf_gl_pipeline_destroy(TF_GLPipeline *pipeline) {
+    free(pipeline);
+}
+
+// =============================================================================
+// Shadow state cache
+// =============================================================================
+
+TF_GLStateCache *tf_gl_state_create(void) {
+    TF_GLStateCache *cache = calloc(1, sizeof(TF_GLStateCache));
+    if (!cache) {
+        TF_ERROR("Failed to allocate GL state cache");
+        return NULL;
+    }
+
+    tf_gl_state_reset(cache);
+    return cache;
+}
+
+void tf_gl_state_destroy(TF_GLStateCache *cache) {
+    free(cache);
+}
+
+void tf_gl_state_reset(TF_GLStateCache *cache) {
+    if (!cache) return;
+
+    cache->program = 0;
+    cache->vertex_array = 0;
+    cache->array_buffer = 0;
+    glUseProgram(0);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    cache->depth_test = TF_TRUE;
+    cache->depth_write = TF_TRUE;
+    cache->depth_func = GL_LESS;
+    glEnable(GL_DEPTH_TEST);
+    glDepthMask(GL_TRUE);
+    glDepthFunc(GL_LESS);
+
+    cache->blend = TF_FALSE;
+    cache->blend_src = GL_ONE;
+    cache->blend_dst = GL_ZERO;
+    glDisable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ZERO);
+
+    cache->cull = TF_FALSE;
+    cache->cull_face = GL_BACK;
+    cache->front_face = GL_CCW;
+    glDisable(GL_CULL_FACE);
+    glCullFace(GL_BACK);
+    glFrontFace(GL_CCW);
+}
+
+void tf_gl_state_invalidate_bindings(TF_GLStateCache *cache) {
+    if (!cache) return;
+
+    cache->program = TF_GL_STATE_UNKNOWN;
+    cache->vertex_array = TF_GL_STATE_UNKNOWN;
+    cache->array_buffer = TF_GL_STATE_UNKNOWN;
+}
+
+void tf_gl_state_reset_stats(TF_GLStateCache *cache) {
+    if (!cache) return;
+
+    cache->calls_issued = 0;
+    cache->calls_filtered = 0;
+    cache->program_binds = 0;
+    cache->vertex_array_binds = 0;
+    cache->buffer_binds = 0;
+}
+
+// =============================================================================
+// Bindings
+// =============================================================================
+
+void tf_gl_state_use_program(TF_GLStateCache *cache, u32 program) {
+    if (cache->program == program) {
+        cache->calls_filtered++;
+        return;
+    }
+
+    glUseProgram(program);
+    cache->program = program;
+    cache->calls_issued++;
+    cache->program_binds++;
+}
+
+void tf_gl_state_bind_vertex_array(TF_GLStateCache *cache, u32 vertex_array) {
+    if (cache->vertex_array == vertex_array) {
+        cache->calls_filtered++;
+        return;
+    }
+
+    glBindVertexArray(vertex_array);
+    cache->vertex_array = vertex_array;
+    cache->calls_issued++;
+    cache->vertex_array_binds++;
+}
+
+void tf_gl_state_bind_array_buffer(TF_GLStateCache *cache, u32 buffer) {
+    if (cache->array_buffer == buffer) {
+        cache->calls_filtered++;
+        return;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    cache->array_buffer = buffer;
+    cache->calls_issued++;
+    cache->buffer_binds++;
+}
+
+// =============================================================================
+// Fixed-function state
+// =============================================================================
+
+static void tf_gl_state_set_capability(TF_GLStateCache *cache, b32 *current, GLenum capability, b32 enabled) {
+    if (*current == enabled) {
+        cache->calls_filtered++;
+        return;
+    }
+
+    if (enabled) {
+        glEnable(capability);
+    } else {
+        glDisable(capability);
+    }
+    *current = enabled;
+    cache->calls_issued++;
+}
+
+void tf_gl_state_set_depth_test(TF_GLStateCache *cache, b32 enabled) {
+    tf_gl_state_set_capability(cache, &cache->depth_test, GL_DEPTH_TEST, enabled ? TF_TRUE : TF_FALSE);
+}
+
+void tf_gl_state_set_depth_write(TF_GLStateCache *cache, b32 enabled) {
+    enabled = enabled ? TF_TRUE : TF_FALSE;
+    if (cache->depth_write == enabled) {
+        cache->calls_filtered++;
+        return;
+    }
+
+    glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+    cache->depth_write = enabled;
+    cache->calls_issued++;
+}
+
+void tf_gl_state_set_depth_func(TF_GLStateCache *cache, GLenum func) {
+    if (cache->depth_func == func) {
+        cache->calls_filtered++;
+        return;
+    }
+
+    glDepthFunc(func);
+    cache->depth_func = func;
+    cache->calls_issued++;
+}
+
+void tf_gl_state_set_blend(TF_GLStateCache *cache, b32 enabled, GLenum src, GLenum dst) {
+    tf_gl_state_set_capability(cache, &cache->blend, GL_BLEND, enabled ? TF_TRUE : TF_FALSE);
+
+    // The blend function only matters while blending is enabled
+    if (!enabled) return;
+
+    if (cache->blend_src == src && cache->blend_dst == dst) {
+        cache->calls_filtered++;
+        return;
+    }
+
+    glBlendFunc(src, dst);
+    cache->blend_src = src;
+    cache->blend_dst = dst;
+    cache->calls_issued++;
+}
+
+void tf_gl_state_set_cull(TF_GLStateCache *cache, b32 enabled, GLenum cull_face, GLenum front_face) {
+    tf_gl_state_set_capability(cache, &cache->cull, GL_CULL_FACE, enabled ? TF_TRUE : TF_FALSE);
+
+    // Face selection only matters while culling is enabled
+    if (!enabled) return;
+
+    if (cache->cull_face != cull_face) {
+        glCullFace(cull_face);
+        cache->cull_face = cull_face;
+        cache->calls_issued++;
+    } else {
+        cache->calls_filtered++;
+    }
+
+    if (cache->front_face != front_face) {
+        glFrontFace(front_face);
+        cache->front_face = front_face;
+        cache->calls_issued++;
+    } else {
+        cache->calls_filtered++;
+    }
+}
+
+void tf_gl_state_apply_pipeline(TF_GLStateCache *cache, const TF_GLPipeline *pipeline) {
+    if (!cache || !pipeline) return;
+
+    const TF_GLPipelineDesc *desc = &pipeline->desc;
+
+    // Pending shaders draw with the fallback until they are ready
+    tf_gl_state_use_program(cache, tf_shader_get_program_id(tf_shader_resolve(desc->shader)));
+
+    tf_gl_state_set_depth_test(cache, desc->depth.test);
+    if (desc->depth.test) {
+        tf_gl_state_set_depth_func(cache, desc->depth.func);
+    }
+    tf_gl_state_set_depth_write(cache, desc->depth.write);
+
+    tf_gl_state_set_blend(cache, desc->blend.enabled, desc->blend.src, desc->blend.dst);
+    tf_gl_state_set_cull(cache, desc->raster.cull, desc->raster.cull_face, desc->raster.front_face);
+}
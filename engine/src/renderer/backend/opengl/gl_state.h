@@ -0,0 +1,116 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include "tunafish/renderer/shader.h"
+#include <glad/gl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// Pipeline state objects
+// =============================================================================
+
+// Immutable bundle of program + fixed-function state. Created once and applied
+// as a diff against the shadow state, so switching between similar pipelines
+// only touches what actually differs.
+typedef struct {
+    TF_Shader *shader;
+
+    struct {
+        b32 test;
+        b32 write;
+        GLenum func;
+    } depth;
+
+    struct {
+        b32 enabled;
+        GLenum src;
+        GLenum dst;
+    } blend;
+
+    struct {
+        b32 cull;
+        GLenum cull_face;
+        GLenum front_face;
+    } raster;
+} TF_GLPipelineDesc;
+
+typedef struct TF_GLPipeline {
+    TF_GLPipelineDesc desc;
+} TF_GLPipeline;
+
+// Defaults: depth test/write on (GL_LESS), no blending, no culling, CCW front faces
+TF_GLPipelineDesc tf_gl_pipeline_desc_default(TF_Shader *shader);
+
+TF_GLPipeline *tf_gl_pipeline_create(const TF_GLPipelineDesc *desc);
+
+void tf_gl_pipeline_destroy(TF_GLPipeline *pipeline);
+
+// =============================================================================
+// Shadow state cache
+// =============================================================================
+
+// Mirrors the GL state the backend touches and filters redundant calls.
+// Anything that changes GL state behind the cache's back must invalidate it.
+typedef struct TF_GLStateCache {
+    // Bindings (0 = unbound, TF_GL_STATE_UNKNOWN = not known)
+    u32 program;
+    u32 vertex_array;
+    u32 array_buffer;
+
+    // Fixed-function state
+    b32 depth_test;
+    b32 depth_write;
+    GLenum depth_func;
+    b32 blend;
+    GLenum blend_src;
+    GLenum blend_dst;
+    b32 cull;
+    GLenum cull_face;
+    GLenum front_face;
+
+    // Counters since the last reset
+    u32 calls_issued;
+    u32 calls_filtered;
+    u32 program_binds;
+    u32 vertex_array_binds;
+    u32 buffer_binds;
+} TF_GLStateCache;
+
+#define TF_GL_STATE_UNKNOWN 0xFFFFFFFFu
+
+TF_GLStateCache *tf_gl_state_create(void);
+
+void tf_gl_state_destroy(TF_GLStateCache *cache);
+
+// Push every tracked value to GL so the shadow copy is known to be exact
+void tf_gl_state_reset(TF_GLStateCache *cache);
+
+// Forget bindings (e.g. after user code called tf_shader_bind directly)
+void tf_gl_state_invalidate_bindings(TF_GLStateCache *cache);
+
+void tf_gl_state_reset_stats(TF_GLStateCache *cache);
+
+// Bindings
+void tf_gl_state_use_program(TF_GLStateCache *cache, u32 program);
+void tf_gl_state_bind_vertex_array(TF_GLStateCache *cache, u32 vertex_array);
+void tf_gl_state_bind_array_buffer(TF_GLStateCache *cache, u32 buffer);
+
+// Fixed-function state
+void tf_gl_state_set_depth_test(TF_GLStateCache *cache, b32 enabled);
+void tf_gl_state_set_depth_write(TF_GLStateCache *cache, b32 enabled);
+void tf_gl_state_set_depth_func(TF_GLStateCache *cache, GLenum func);
+void tf_gl_state_set_blend(TF_GLStateCache *cache, b32 enabled, GLenum src, GLenum dst);
+void tf_gl_state_set_cull(TF_GLStateCache *cache, b32 enabled, GLenum cull_face, GLenum front_face);
+
+// Apply a pipeline as a diff against the current state
+void tf_gl_state_apply_pipeline(TF_GLStateCache *cache, const TF_GLPipeline *pipeline);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,216 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "renderer/backend/opengl/gl_stream_buffer.h"
+#include "renderer/backend/opengl/gl_extensions.h"
+#include "tunafish/core/log.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Fence wait granularity while the GPU still owns a region (1 ms)
+#define TF_GL_STREAM_WAIT_TIMEOUT_NS 1000000ull
+
+// =============================================================================
+// Internal helpers
+// =============================================================================
+
+// Alignment does not have to be a power of two (vertex strides are not)
+static usize tf_gl_stream_align(usize value, usize alignment) {
+    if (alignment <= 1) return value;
+    return ((value + alignment - 1) / alignment) * alignment;
+}
+
+static void tf_gl_stream_wait_region(TF_GLStreamBuffer *stream, u32 region) {
+    GLsync fence = stream->fences[region];
+    if (!fence) return;
+
+    GLenum result = glClientWaitSync(fence, 0, 0);
+    if (result == GL_TIMEOUT_EXPIRED) {
+        stream->waits++;
+        do {
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, TF_GL_STREAM_WAIT_TIMEOUT_NS);
+        } while (result == GL_TIMEOUT_EXPIRED);
+    }
+    if (result == GL_WAIT_FAILED) {
+        TF_ERROR("Stream buffer fence wait failed");
+    }
+
+    glDeleteSync(fence);
+    stream->fences[region] = NULL;
+}
+
+static void tf_gl_stream_advance(TF_GLStreamBuffer *stream) {
+    stream->fences[stream->region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    stream->region = (stream->region + 1) % TF_GL_STREAM_REGION_COUNT;
+    stream->offset = 0;
+
+    tf_gl_stream_wait_region(stream, stream->region);
+}
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+TF_GLStreamBuffer *tf_gl_stream_buffer_create(usize region_size) {
+    if (region_size == 0) {
+        TF_ERROR("Stream buffer region size cannot be zero");
+        return NULL;
+    }
+
+    TF_GLStreamBuffer *stream = calloc(1, sizeof(TF_GLStreamBuffer));
+    if (!stream) {
+        TF_ERROR("Failed to allocate stream buffer");
+        return NULL;
+    }
+
+    stream->region_size = region_size;
+    usize total_size = region_size * TF_GL_STREAM_REGION_COUNT;
+
+    // GL_COPY_WRITE_BUFFER is used for all housekeeping so no VAO binding is disturbed
+    glGenBuffers(1, &stream->buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, stream->buffer);
+
+    const TF_GLExtensions *extensions = tf_gl_extensions_get();
+    if (extensions->buffer_storage) {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        extensions->glBufferStorage(GL_COPY_WRITE_BUFFER, (GLsizeiptr)total_size, NULL, flags);
+        stream->mapped = (u8 *)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, (GLsizeiptr)total_size, flags);
+        stream->persistent = stream->mapped != NULL;
+        if (!stream->persistent) {
+            // Immutable storage cannot be respecified, start over with a mutable buffer
+            TF_WARN("Persistent mapping failed, falling back to unsynchronized mapping");
+            glDeleteBuffers(1, &stream->buffer);
+            glGenBuffers(1, &stream->buffer);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, stream->buffer);
+        }
+    }
+
+    if (!stream->persistent) {
+        glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)total_size, NULL, GL_STREAM_DRAW);
+    }
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    TF_DEBUG("Stream buffer created: %u x %llu bytes (%s)", TF_GL_STREAM_REGION_COUNT,
+             (unsigned long long)region_size, stream->persistent ? "persistent" : "unsynchronized map");
+    return stream;
+}
+
+void tf_gl_stream_buffer_destroy(TF_GLStreamBuffer *stream) {
+    if (!stream) return;
+
+    for (u32 i = 0; i < TF_GL_STREAM_REGION_COUNT; i++) {
+        if (stream->fences[i]) {
+            glDeleteSync(stream->fences[i]);
+        }
+    }
+
+    if (stream->buffer) {
+        if (stream->persistent) {
+            glBindBuffer(GL_COPY_WRITE_BUFFER, stream->buffer);
+            glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        }
+        glDeleteBuffers(1, &stream->buffer);
+    }
+
+    free(stream);
+}
+
+// =============================================================================
+// Sub-allocation
+// =============================================================================
+
+void *tf_gl_stream_buffer_map(TF_GLStreamBuffer *stream, usize size, usize alignment, usize *out_offset) {
+    if (!stream || size == 0) return NULL;
+
+    if (stream->writing) {
+        TF_ERROR("Stream buffer is already mapped");
+        return NULL;
+    }
+
+    if (size > stream->region_size) {
+        TF_ERROR("Stream allocation of %llu bytes exceeds region size %llu",
+                 (unsigned long long)size, (unsigned long long)stream->region_size);
+        return NULL;
+    }
+
+    // Offsets are aligned in absolute terms so they can be turned into first vertex indices
+    usize region_base = stream->region * stream->region_size;
+    usize offset = tf_gl_stream_align(region_base + stream->offset, alignment);
+    if (offset + size > region_base + stream->region_size) {
+        tf_gl_stream_advance(stream);
+        region_base = stream->region * stream->region_size;
+        offset = tf_gl_stream_align(region_base, alignment);
+        if (offset + size > region_base + stream->region_size) {
+            TF_ERROR("Stream allocation does not fit after alignment");
+            return NULL;
+        }
+    }
+
+    void *ptr;
+    if (stream->persistent) {
+        ptr = stream->mapped + offset;
+    } else {
+        // The fence already guarantees the GPU is done with this range
+        glBindBuffer(GL_COPY_WRITE_BUFFER, stream->buffer);
+        ptr = glMapBufferRange(GL_COPY_WRITE_BUFFER, (GLintptr)offset, (GLsizeiptr)size,
+                               GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        if (!ptr) {
+            TF_ERROR("Failed to map stream buffer range");
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+            return NULL;
+        }
+    }
+
+    stream->offset = offset + size - region_base;
+    stream->bytes_written += size;
+    stream->writing = TF_TRUE;
+
+    if (out_offset) *out_offset = offset;
+    return ptr;
+}
+
+void tf_gl_stream_buffer_unmap(TF_GLStreamBuffer *stream) {
+    if (!stream || !stream->writing) return;
+
+    if (!stream->persistent) {
+        glBindBuffer(GL_COPY_WRITE_BUFFER, stream->buffer);
+        glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+
+    stream->writing = TF_FALSE;
+}
+
+b32 tf_gl_stream_buffer_write(TF_GLStreamBuffer *stream, const void *data, usize size, usize alignment,
+                              usize *out_offset) {
+    void *ptr = tf_gl_stream_buffer_map(stream, size, alignment, out_offset);
+    if (!ptr) return TF_FALSE;
+
+    memcpy(ptr, data, size);
+    tf_gl_stream_buffer_unmap(stream);
+    return TF_TRUE;
+}
+
+// =============================================================================
+// Frame management
+// =============================================================================
+
+void tf_gl_stream_buffer_end_frame(TF_GLStreamBuffer *stream) {
+    if (!stream) return;
+
+    if (stream->writing) {
+        TF_WARN("Stream buffer still mapped at end of frame");
+        tf_gl_stream_buffer_unmap(stream);
+    }
+
+    tf_gl_stream_advance(stream);
+}
+
+void tf_gl_stream_buffer_reset_stats(TF_GLStreamBuffer *stream) {
+    if (!stream) return;
+
+    stream->bytes_written = 0;
+    stream->waits = 0;
+}
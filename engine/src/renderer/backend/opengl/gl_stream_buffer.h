@@ -0,0 +1,61 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include <glad/gl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// Streaming buffer - triple-buffered ring for per-frame data
+// =============================================================================
+
+// The buffer is split into regions, one per frame in flight. The CPU writes
+// into the current region while the GPU reads older ones; each region is
+// guarded by a fence so it is only reused once the GPU is done with it.
+// With ARB_buffer_storage the whole ring stays persistently mapped, otherwise
+// each write maps its range unsynchronized (safe because of the fences).
+
+#define TF_GL_STREAM_REGION_COUNT 3
+
+typedef struct TF_GLStreamBuffer {
+    u32 buffer;
+    usize region_size;
+    u32 region;       // Region the CPU is currently writing
+    usize offset;     // Write offset inside the current region
+    GLsync fences[TF_GL_STREAM_REGION_COUNT];
+    u8 *mapped;       // Persistent mapping of the whole ring (NULL when not persistent)
+    b32 persistent;
+    b32 writing;      // Between map and unmap
+
+    // Counters since the last reset
+    usize bytes_written;
+    u32 waits;        // Times the CPU had to wait for the GPU to release a region
+} TF_GLStreamBuffer;
+
+TF_GLStreamBuffer *tf_gl_stream_buffer_create(usize region_size);
+
+void tf_gl_stream_buffer_destroy(TF_GLStreamBuffer *stream);
+
+// Reserve space and return a write pointer; out_offset receives the absolute
+// buffer offset to bind/draw from. Must be followed by tf_gl_stream_buffer_unmap.
+void *tf_gl_stream_buffer_map(TF_GLStreamBuffer *stream, usize size, usize alignment, usize *out_offset);
+
+void tf_gl_stream_buffer_unmap(TF_GLStreamBuffer *stream);
+
+// Copy data into the ring; returns TF_FALSE if it does not fit in a region
+b32 tf_gl_stream_buffer_write(TF_GLStreamBuffer *stream, const void *data, usize size, usize alignment,
+                              usize *out_offset);
+
+// Fence the current region and move to the next one
+void tf_gl_stream_buffer_end_frame(TF_GLStreamBuffer *stream);
+
+void tf_gl_stream_buffer_reset_stats(TF_GLStreamBuffer *stream);
+
+#ifdef __cplusplus
+}
+#endif
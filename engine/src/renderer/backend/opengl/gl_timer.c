@@ -0,0 +1,162 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "renderer/backend/opengl/gl_timer.h"
+#include "tunafish/core/log.h"
+#include <glad/gl.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Marks an open pass that ran past TF_GPU_MAX_PASSES and is not timed
+#define TF_GL_TIMER_UNTIMED 0xFFFFFFFFu
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+TF_GLTimer *tf_gl_timer_create(void) {
+    // Timestamp queries are core in 3.3, but the counter may be unimplemented
+    GLint counter_bits = 0;
+    glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &counter_bits);
+    if (counter_bits == 0) {
+        TF_WARN("GPU timestamp counter unavailable, GPU timings disabled");
+        return NULL;
+    }
+
+    TF_GLTimer *timer = calloc(1, sizeof(TF_GLTimer));
+    if (!timer) {
+        TF_ERROR("Failed to allocate GPU timer");
+        return NULL;
+    }
+
+    for (u32 i = 0; i < TF_GL_TIMER_FRAMES; i++) {
+        glGenQueries(TF_GL_TIMER_QUERIES, timer->frames[i].queries);
+    }
+
+    TF_DEBUG("GPU timers enabled (%d-bit timestamps, %u frames in flight)", counter_bits, TF_GL_TIMER_FRAMES);
+    return timer;
+}
+
+void tf_gl_timer_destroy(TF_GLTimer *timer) {
+    if (!timer) return;
+
+    for (u32 i = 0; i < TF_GL_TIMER_FRAMES; i++) {
+        glDeleteQueries(TF_GL_TIMER_QUERIES, timer->frames[i].queries);
+    }
+    free(timer);
+}
+
+// =============================================================================
+// Result collection
+// =============================================================================
+
+static f32 tf_gl_timer_elapsed_ms(const u32 *queries) {
+    GLuint64 begin = 0, end = 0;
+    glGetQueryObjectui64v(queries[0], GL_QUERY_RESULT, &begin);
+    glGetQueryObjectui64v(queries[1], GL_QUERY_RESULT, &end);
+    return end > begin ? (f32)((f64)(end - begin) / 1000000.0) : 0.0f;
+}
+
+// Read a frame back if its last query has landed (queries complete in order)
+static b32 tf_gl_timer_collect(TF_GLTimer *timer, TF_GLTimerFrame *frame) {
+    GLuint available = GL_FALSE;
+    glGetQueryObjectuiv(frame->queries[1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+        return TF_FALSE;
+    }
+
+    TF_GPUTimings *latest = &timer->latest;
+    latest->frame = frame->frame;
+    latest->frame_ms = tf_gl_timer_elapsed_ms(&frame->queries[0]);
+    latest->pass_count = frame->pass_count;
+    for (u32 i = 0; i < frame->pass_count; i++) {
+        memcpy(latest->passes[i].name, frame->names[i], TF_GPU_PASS_NAME_LENGTH);
+        latest->passes[i].depth = frame->depths[i];
+        latest->passes[i].gpu_ms = tf_gl_timer_elapsed_ms(&frame->queries[2 + 2 * i]);
+    }
+    latest->dropped_frames = timer->dropped_frames;
+
+    frame->pending = TF_FALSE;
+    return TF_TRUE;
+}
+
+// =============================================================================
+// Frame and pass timing
+// =============================================================================
+
+void tf_gl_timer_begin_frame(TF_GLTimer *timer) {
+    if (!timer) return;
+
+    timer->frame_number++;
+
+    // Oldest first (the slot this frame reuses), so results never go backwards
+    for (u32 i = 0; i < TF_GL_TIMER_FRAMES; i++) {
+        TF_GLTimerFrame *frame = &timer->frames[(timer->frame_number + i) % TF_GL_TIMER_FRAMES];
+        if (frame->pending && !tf_gl_timer_collect(timer, frame)) {
+            break;
+        }
+    }
+
+    TF_GLTimerFrame *frame = &timer->frames[timer->frame_number % TF_GL_TIMER_FRAMES];
+    if (frame->pending) {
+        timer->dropped_frames++;
+        timer->current = NULL;
+        return;
+    }
+
+    frame->frame = timer->frame_number;
+    frame->pass_count = 0;
+    timer->current = frame;
+    timer->open_count = 0;
+    glQueryCounter(frame->queries[0], GL_TIMESTAMP);
+}
+
+void tf_gl_timer_end_frame(TF_GLTimer *timer) {
+    if (!timer || !timer->current) return;
+
+    if (timer->open_count > 0) {
+        TF_WARN("%u GPU pass(es) still open at end of frame", timer->open_count);
+        while (timer->open_count > 0) {
+            tf_gl_timer_end_pass(timer);
+        }
+    }
+
+    glQueryCounter(timer->current->queries[1], GL_TIMESTAMP);
+    timer->current->pending = TF_TRUE;
+    timer->current = NULL;
+}
+
+void tf_gl_timer_begin_pass(TF_GLTimer *timer, const char *name) {
+    if (!timer || !timer->current) return;
+
+    TF_GLTimerFrame *frame = timer->current;
+    u32 index = TF_GL_TIMER_UNTIMED;
+    if (frame->pass_count < TF_GPU_MAX_PASSES) {
+        index = frame->pass_count++;
+        strncpy(frame->names[index], name ? name : "", TF_GPU_PASS_NAME_LENGTH - 1);
+        frame->names[index][TF_GPU_PASS_NAME_LENGTH - 1] = '\0';
+        frame->depths[index] = timer->open_count;
+        glQueryCounter(frame->queries[2 + 2 * index], GL_TIMESTAMP);
+    }
+
+    // Deeper than the stack can hold means the pass count ran out long ago
+    if (timer->open_count < TF_GPU_MAX_PASSES) {
+        timer->open_passes[timer->open_count] = index;
+    }
+    timer->open_count++;
+}
+
+void tf_gl_timer_end_pass(TF_GLTimer *timer) {
+    if (!timer || !timer->current) return;
+
+    if (timer->open_count == 0) {
+        TF_WARN("GPU pass ended without a matching begin");
+        return;
+    }
+
+    timer->open_count--;
+    if (timer->open_count < TF_GPU_MAX_PASSES && timer->open_passes[timer->open_count] != TF_GL_TIMER_UNTIMED) {
+        u32 index = timer->open_passes[timer->open_count];
+        glQueryCounter(timer->current->queries[3 + 2 * index], GL_TIMESTAMP);
+    }
+}
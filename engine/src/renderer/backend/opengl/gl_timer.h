@@ -0,0 +1,66 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include "tunafish/renderer/renderer_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// GPU timers - per-frame and per-pass timestamp queries
+// =============================================================================
+
+// Every frame gets its own set of timestamp queries: one pair around the frame
+// and one pair per labelled pass. Timestamps (rather than GL_TIME_ELAPSED,
+// which cannot nest) let passes sit inside the frame timer and inside each
+// other. Results are only read once the GPU reports them available, normally
+// a few frames later; when every set is still in flight, the frame simply
+// goes untimed instead of waiting.
+
+#define TF_GL_TIMER_FRAMES 4 // Frames of queries in flight
+#define TF_GL_TIMER_QUERIES (2 * (TF_GPU_MAX_PASSES + 1))
+
+typedef struct {
+    u32 queries[TF_GL_TIMER_QUERIES]; // Frame begin/end, then begin/end per pass
+    char names[TF_GPU_MAX_PASSES][TF_GPU_PASS_NAME_LENGTH];
+    u32 depths[TF_GPU_MAX_PASSES];
+    u32 pass_count;
+    u64 frame;    // Frame number the queries were issued in
+    b32 pending;  // Issued and not yet read back
+} TF_GLTimerFrame;
+
+typedef struct TF_GLTimer {
+    TF_GLTimerFrame frames[TF_GL_TIMER_FRAMES];
+    TF_GLTimerFrame *current; // NULL outside a timed frame
+    u32 open_passes[TF_GPU_MAX_PASSES];
+    u32 open_count;
+    u64 frame_number;
+    u32 dropped_frames;
+
+    // Most recent complete results
+    TF_GPUTimings latest;
+} TF_GLTimer;
+
+// NULL when the context has no usable timestamp counter
+TF_GLTimer *tf_gl_timer_create(void);
+
+void tf_gl_timer_destroy(TF_GLTimer *timer);
+
+// Publish finished frames, then start timing a new one
+void tf_gl_timer_begin_frame(TF_GLTimer *timer);
+
+// Closes passes left open
+void tf_gl_timer_end_frame(TF_GLTimer *timer);
+
+// Passes nest; beyond TF_GPU_MAX_PASSES per frame they are not timed
+void tf_gl_timer_begin_pass(TF_GLTimer *timer, const char *name);
+
+void tf_gl_timer_end_pass(TF_GLTimer *timer);
+
+#ifdef __cplusplus
+}
+#endif
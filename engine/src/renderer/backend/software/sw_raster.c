@@ -0,0 +1,316 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "renderer/backend/software/sw_raster.h"
+#include "tunafish/core/log.h"
+#include <math.h>
+#include <stdlib.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define TF_SW_SSE2 1
+#include <emmintrin.h>
+#else
+#define TF_SW_SSE2 0
+#endif
+
+// =============================================================================
+// Framebuffer
+// =============================================================================
+
+TF_SWFramebuffer *tf_sw_framebuffer_create(u32 width, u32 height) {
+    if (width == 0 || height == 0) {
+        TF_ERROR("Invalid software framebuffer size %ux%u", width, height);
+        return NULL;
+    }
+
+    TF_SWFramebuffer *framebuffer = calloc(1, sizeof(TF_SWFramebuffer));
+    if (!framebuffer) {
+        TF_ERROR("Failed to allocate software framebuffer");
+        return NULL;
+    }
+
+    framebuffer->width = width;
+    framebuffer->height = height;
+    framebuffer->pitch = (width + 3) & ~3u;
+
+    usize pixels = (usize)framebuffer->pitch * height;
+    framebuffer->color = calloc(pixels, sizeof(u32));
+    framebuffer->depth = calloc(pixels, sizeof(f32));
+    if (!framebuffer->color || !framebuffer->depth) {
+        TF_ERROR("Failed to allocate %ux%u software framebuffer", width, height);
+        tf_sw_framebuffer_destroy(framebuffer);
+        return NULL;
+    }
+
+    return framebuffer;
+}
+
+void tf_sw_framebuffer_destroy(TF_SWFramebuffer *framebuffer) {
+    if (!framebuffer) return;
+
+    free(framebuffer->color);
+    free(framebuffer->depth);
+    free(framebuffer);
+}
+
+static u32 tf_sw_unorm8(f32 value) {
+    value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+    return (u32)(value * 255.0f + 0.5f);
+}
+
+u32 tf_sw_pack_color(f32 r, f32 g, f32 b, f32 a) {
+    return tf_sw_unorm8(r) | (tf_sw_unorm8(g) << 8) | (tf_sw_unorm8(b) << 16) | (tf_sw_unorm8(a) << 24);
+}
+
+void tf_sw_clear_rect(TF_SWFramebuffer *framebuffer, const u32 *color, const f32 *depth, i32 min_x, i32 min_y,
+                      i32 max_x, i32 max_y) {
+    for (i32 y = min_y; y < max_y; y++) {
+        usize row = (usize)y * framebuffer->pitch;
+        if (color) {
+            u32 *pixels = framebuffer->color + row;
+            for (i32 x = min_x; x < max_x; x++) {
+                pixels[x] = *color;
+            }
+        }
+        if (depth) {
+            f32 *depths = framebuffer->depth + row;
+            for (i32 x = min_x; x < max_x; x++) {
+                depths[x] = *depth;
+            }
+        }
+    }
+}
+
+// =============================================================================
+// Triangle setup
+// =============================================================================
+
+// Edge from a to b, positive on its left (the inside of a counter-clockwise
+// triangle). Written so the shared edge of two neighbours evaluates to exactly
+// the negated value, which keeps the top-left rule watertight.
+static void tf_sw_edge(TF_SWTriangle *triangle, u32 edge, const TF_SWScreenVertex *a, const TF_SWScreenVertex *b) {
+    f32 edge_a = a->y - b->y;
+    f32 edge_b = b->x - a->x;
+    triangle->edge_a[edge] = edge_a;
+    triangle->edge_b[edge] = edge_b;
+    triangle->edge_c[edge] = a->x * b->y - b->x * a->y;
+
+    // With y up: left edges go down, top edges go left
+    if (edge_a > 0.0f || (edge_a == 0.0f && edge_b < 0.0f)) {
+        triangle->top_left |= 1u << edge;
+    }
+}
+
+static void tf_sw_plane(TF_SWPlane *plane, const TF_SWTriangle *triangle, f32 inv_area, f32 v0, f32 v1, f32 v2) {
+    // Edge i is opposite vertex i, so it is that vertex's barycentric weight * 2 * area
+    plane->dx = (v0 * triangle->edge_a[0] + v1 * triangle->edge_a[1] + v2 * triangle->edge_a[2]) * inv_area;
+    plane->dy = (v0 * triangle->edge_b[0] + v1 * triangle->edge_b[1] + v2 * triangle->edge_b[2]) * inv_area;
+    plane->c = (v0 * triangle->edge_c[0] + v1 * triangle->edge_c[1] + v2 * triangle->edge_c[2]) * inv_area;
+}
+
+b32 tf_sw_triangle_setup(TF_SWTriangle *triangle, const TF_SWScreenVertex *v0, const TF_SWScreenVertex *v1,
+                         const TF_SWScreenVertex *v2, i32 clip_min_x, i32 clip_min_y, i32 clip_max_x,
+                         i32 clip_max_y, u32 flags) {
+    f32 area = (v1->x - v0->x) * (v2->y - v0->y) - (v2->x - v0->x) * (v1->y - v0->y);
+    if (area == 0.0f || area != area) {
+        return TF_FALSE;
+    }
+
+    // No culling: clockwise triangles are flipped to counter-clockwise
+    if (area < 0.0f) {
+        const TF_SWScreenVertex *swap = v1;
+        v1 = v2;
+        v2 = swap;
+        area = -area;
+    }
+
+    f32 min_xf = fminf(v0->x, fminf(v1->x, v2->x));
+    f32 min_yf = fminf(v0->y, fminf(v1->y, v2->y));
+    f32 max_xf = fmaxf(v0->x, fmaxf(v1->x, v2->x));
+    f32 max_yf = fmaxf(v0->y, fmaxf(v1->y, v2->y));
+    if (max_xf < (f32)clip_min_x || max_yf < (f32)clip_min_y ||
+        min_xf > (f32)clip_max_x || min_yf > (f32)clip_max_y) {
+        return TF_FALSE;
+    }
+
+    triangle->min_x = (i32)floorf(min_xf) < clip_min_x ? clip_min_x : (i32)floorf(min_xf);
+    triangle->min_y = (i32)floorf(min_yf) < clip_min_y ? clip_min_y : (i32)floorf(min_yf);
+    triangle->max_x = (i32)ceilf(max_xf) > clip_max_x ? clip_max_x : (i32)ceilf(max_xf);
+    triangle->max_y = (i32)ceilf(max_yf) > clip_max_y ? clip_max_y : (i32)ceilf(max_yf);
+    if (triangle->min_x >= triangle->max_x || triangle->min_y >= triangle->max_y) {
+        return TF_FALSE;
+    }
+
+    triangle->top_left = 0;
+    tf_sw_edge(triangle, 0, v1, v2);
+    tf_sw_edge(triangle, 1, v2, v0);
+    tf_sw_edge(triangle, 2, v0, v1);
+
+    f32 inv_area = 1.0f / area;
+    tf_sw_plane(&triangle->planes[TF_SW_PLANE_Z], triangle, inv_area, v0->z, v1->z, v2->z);
+    tf_sw_plane(&triangle->planes[TF_SW_PLANE_INV_W], triangle, inv_area, v0->inv_w, v1->inv_w, v2->inv_w);
+    tf_sw_plane(&triangle->planes[TF_SW_PLANE_R], triangle, inv_area,
+                v0->r * v0->inv_w, v1->r * v1->inv_w, v2->r * v2->inv_w);
+    tf_sw_plane(&triangle->planes[TF_SW_PLANE_G], triangle, inv_area,
+                v0->g * v0->inv_w, v1->g * v1->inv_w, v2->g * v2->inv_w);
+    tf_sw_plane(&triangle->planes[TF_SW_PLANE_B], triangle, inv_area,
+                v0->b * v0->inv_w, v1->b * v1->inv_w, v2->b * v2->inv_w);
+    tf_sw_plane(&triangle->planes[TF_SW_PLANE_A], triangle, inv_area,
+                v0->a * v0->inv_w, v1->a * v1->inv_w, v2->a * v2->inv_w);
+
+    triangle->flags = flags;
+    return TF_TRUE;
+}
+
+// =============================================================================
+// Rasterization
+// =============================================================================
+
+#if TF_SW_SSE2
+
+// Four horizontally adjacent pixels per step. Edge values are evaluated
+// directly (not stepped) so shared edges stay exact.
+static void tf_sw_rasterize_triangle(TF_SWFramebuffer *framebuffer, const TF_SWTriangle *triangle,
+                                     i32 min_x, i32 min_y, i32 max_x, i32 max_y) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 lane_offsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+    const __m128 span_min = _mm_set1_ps((f32)min_x + 0.5f);
+    const __m128 span_max = _mm_set1_ps((f32)max_x);
+
+    __m128 edge_a[3], zero_ok[3];
+    for (u32 e = 0; e < 3; e++) {
+        edge_a[e] = _mm_set1_ps(triangle->edge_a[e]);
+        zero_ok[e] = (triangle->top_left & (1u << e)) ? _mm_castsi128_ps(_mm_set1_epi32(-1)) : zero;
+    }
+
+    const TF_SWPlane *planes = triangle->planes;
+    b32 depth_test = (triangle->flags & TF_SW_TRIANGLE_DEPTH_TEST) != 0;
+    b32 depth_write = (triangle->flags & TF_SW_TRIANGLE_DEPTH_WRITE) != 0;
+
+    i32 start_x = min_x & ~3;
+    for (i32 y = min_y; y < max_y; y++) {
+        f32 py = (f32)y + 0.5f;
+        __m128 edge_row[3];
+        for (u32 e = 0; e < 3; e++) {
+            edge_row[e] = _mm_set1_ps(triangle->edge_b[e] * py + triangle->edge_c[e]);
+        }
+        __m128 plane_row[TF_SW_PLANE_COUNT];
+        for (u32 p = 0; p < TF_SW_PLANE_COUNT; p++) {
+            plane_row[p] = _mm_set1_ps(planes[p].dy * py + planes[p].c);
+        }
+
+        u32 *color_row = framebuffer->color + (usize)y * framebuffer->pitch;
+        f32 *depth_row = framebuffer->depth + (usize)y * framebuffer->pitch;
+
+        for (i32 x = start_x; x < max_x; x += 4) {
+            __m128 px = _mm_add_ps(_mm_set1_ps((f32)x), lane_offsets);
+
+            // Inside all three edges and within the clipped span
+            __m128 mask = _mm_and_ps(_mm_cmpge_ps(px, span_min), _mm_cmplt_ps(px, span_max));
+            for (u32 e = 0; e < 3; e++) {
+                __m128 value = _mm_add_ps(_mm_mul_ps(edge_a[e], px), edge_row[e]);
+                __m128 inside = _mm_or_ps(_mm_cmpgt_ps(value, zero),
+                                          _mm_and_ps(_mm_cmpeq_ps(value, zero), zero_ok[e]));
+                mask = _mm_and_ps(mask, inside);
+            }
+            if (_mm_movemask_ps(mask) == 0) {
+                continue;
+            }
+
+            __m128 z = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[TF_SW_PLANE_Z].dx), px), plane_row[TF_SW_PLANE_Z]);
+            __m128 old_depth = _mm_loadu_ps(depth_row + x);
+            if (depth_test) {
+                mask = _mm_and_ps(mask, _mm_cmplt_ps(z, old_depth));
+                if (_mm_movemask_ps(mask) == 0) {
+                    continue;
+                }
+            }
+            if (depth_write) {
+                _mm_storeu_ps(depth_row + x, _mm_or_ps(_mm_and_ps(mask, z), _mm_andnot_ps(mask, old_depth)));
+            }
+
+            // Perspective-correct color: (color / w) / (1 / w)
+            __m128 inv_w = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[TF_SW_PLANE_INV_W].dx), px),
+                                      plane_row[TF_SW_PLANE_INV_W]);
+            __m128 w = _mm_div_ps(one, inv_w);
+            __m128i packed = _mm_setzero_si128();
+            for (u32 channel = 0; channel < 4; channel++) {
+                u32 p = TF_SW_PLANE_R + channel;
+                __m128 value = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[p].dx), px), plane_row[p]), w);
+                value = _mm_min_ps(_mm_max_ps(value, zero), one);
+                __m128i bytes = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value, scale), half));
+                packed = _mm_or_si128(packed, _mm_slli_epi32(bytes, (int)(channel * 8)));
+            }
+
+            __m128i mask_i = _mm_castps_si128(mask);
+            __m128i old_color = _mm_loadu_si128((const __m128i *)(color_row + x));
+            _mm_storeu_si128((__m128i *)(color_row + x),
+                             _mm_or_si128(_mm_and_si128(mask_i, packed), _mm_andnot_si128(mask_i, old_color)));
+        }
+    }
+}
+
+#else
+
+static void tf_sw_rasterize_triangle(TF_SWFramebuffer *framebuffer, const TF_SWTriangle *triangle,
+                                     i32 min_x, i32 min_y, i32 max_x, i32 max_y) {
+    const TF_SWPlane *planes = triangle->planes;
+    b32 depth_test = (triangle->flags & TF_SW_TRIANGLE_DEPTH_TEST) != 0;
+    b32 depth_write = (triangle->flags & TF_SW_TRIANGLE_DEPTH_WRITE) != 0;
+
+    for (i32 y = min_y; y < max_y; y++) {
+        f32 py = (f32)y + 0.5f;
+        u32 *color_row = framebuffer->color + (usize)y * framebuffer->pitch;
+        f32 *depth_row = framebuffer->depth + (usize)y * framebuffer->pitch;
+
+        for (i32 x = min_x; x < max_x; x++) {
+            f32 px = (f32)x + 0.5f;
+
+            b32 inside = TF_TRUE;
+            for (u32 e = 0; e < 3 && inside; e++) {
+                f32 value = triangle->edge_a[e] * px + (triangle->edge_b[e] * py + triangle->edge_c[e]);
+                inside = value > 0.0f || (value == 0.0f && (triangle->top_left & (1u << e)));
+            }
+            if (!inside) {
+                continue;
+            }
+
+            f32 z = planes[TF_SW_PLANE_Z].dx * px + (planes[TF_SW_PLANE_Z].dy * py + planes[TF_SW_PLANE_Z].c);
+            if (depth_test && !(z < depth_row[x])) {
+                continue;
+            }
+            if (depth_write) {
+                depth_row[x] = z;
+            }
+
+            f32 inv_w = planes[TF_SW_PLANE_INV_W].dx * px +
+                        (planes[TF_SW_PLANE_INV_W].dy * py + planes[TF_SW_PLANE_INV_W].c);
+            f32 w = 1.0f / inv_w;
+            f32 channels[4];
+            for (u32 channel = 0; channel < 4; channel++) {
+                const TF_SWPlane *plane = &planes[TF_SW_PLANE_R + channel];
+                channels[channel] = (plane->dx * px + (plane->dy * py + plane->c)) * w;
+            }
+            color_row[x] = tf_sw_pack_color(channels[0], channels[1], channels[2], channels[3]);
+        }
+    }
+}
+
+#endif
+
+void tf_sw_rasterize(TF_SWFramebuffer *framebuffer, const TF_SWTriangle *triangles, const u32 *indices,
+                     u32 count, i32 rect_min_x, i32 rect_min_y, i32 rect_max_x, i32 rect_max_y) {
+    for (u32 i = 0; i < count; i++) {
+        const TF_SWTriangle *triangle = &triangles[indices[i]];
+        i32 min_x = triangle->min_x > rect_min_x ? triangle->min_x : rect_min_x;
+        i32 min_y = triangle->min_y > rect_min_y ? triangle->min_y : rect_min_y;
+        i32 max_x = triangle->max_x < rect_max_x ? triangle->max_x : rect_max_x;
+        i32 max_y = triangle->max_y < rect_max_y ? triangle->max_y : rect_max_y;
+        if (min_x < max_x && min_y < max_y) {
+            tf_sw_rasterize_triangle(framebuffer, triangle, min_x, min_y, max_x, max_y);
+        }
+    }
+}
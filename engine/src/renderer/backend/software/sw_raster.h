@@ -0,0 +1,90 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// Framebuffer
+// =============================================================================
+
+// Rows are stored bottom-up (row 0 is the bottom of the image, as in GL) and
+// padded to a multiple of four pixels so the rasterizer can always work on
+// whole 4-pixel spans. Colors are RGBA8, R in the lowest byte.
+typedef struct TF_SWFramebuffer {
+    u32 width;
+    u32 height;
+    u32 pitch; // Pixels per row
+    u32 *color;
+    f32 *depth;
+} TF_SWFramebuffer;
+
+TF_SWFramebuffer *tf_sw_framebuffer_create(u32 width, u32 height);
+
+void tf_sw_framebuffer_destroy(TF_SWFramebuffer *framebuffer);
+
+u32 tf_sw_pack_color(f32 r, f32 g, f32 b, f32 a);
+
+// =============================================================================
+// Triangles
+// =============================================================================
+
+#define TF_SW_TILE_SIZE 64 // Pixels per tile side (multiple of 4)
+
+#define TF_SW_TRIANGLE_DEPTH_TEST  (1u << 0)
+#define TF_SW_TRIANGLE_DEPTH_WRITE (1u << 1)
+
+// Post-projection vertex in framebuffer pixels
+typedef struct {
+    f32 x, y;
+    f32 z;     // Window depth in [0, 1]
+    f32 inv_w; // 1 / clip w, for perspective-correct colors
+    f32 r, g, b, a;
+} TF_SWScreenVertex;
+
+// Value of an attribute at pixel center (x, y) is dx * x + dy * y + c
+typedef struct {
+    f32 dx, dy, c;
+} TF_SWPlane;
+
+enum {
+    TF_SW_PLANE_Z = 0,
+    TF_SW_PLANE_INV_W,
+    TF_SW_PLANE_R, // Color planes hold color / w
+    TF_SW_PLANE_G,
+    TF_SW_PLANE_B,
+    TF_SW_PLANE_A,
+    TF_SW_PLANE_COUNT
+};
+
+// Set-up triangle: three edge functions (inside when >= 0, or > 0 for edges
+// that fail the top-left rule) plus attribute planes and a pixel bounding box
+typedef struct TF_SWTriangle {
+    f32 edge_a[3], edge_b[3], edge_c[3];
+    u32 top_left; // Bit per edge
+    TF_SWPlane planes[TF_SW_PLANE_COUNT];
+    i32 min_x, min_y, max_x, max_y; // Inclusive min, exclusive max
+    u32 flags;
+} TF_SWTriangle;
+
+// Returns TF_FALSE for degenerate triangles or ones outside the clip rectangle
+b32 tf_sw_triangle_setup(TF_SWTriangle *triangle, const TF_SWScreenVertex *v0, const TF_SWScreenVertex *v1,
+                         const TF_SWScreenVertex *v2, i32 clip_min_x, i32 clip_min_y, i32 clip_max_x,
+                         i32 clip_max_y, u32 flags);
+
+// Rasterize triangles (by index, in order) restricted to one rectangle
+void tf_sw_rasterize(TF_SWFramebuffer *framebuffer, const TF_SWTriangle *triangles, const u32 *indices,
+                     u32 count, i32 rect_min_x, i32 rect_min_y, i32 rect_max_x, i32 rect_max_y);
+
+// Fill a rectangle of the color and/or depth planes
+void tf_sw_clear_rect(TF_SWFramebuffer *framebuffer, const u32 *color, const f32 *depth, i32 min_x, i32 min_y,
+                      i32 max_x, i32 max_y);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,648 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "tunafish/renderer/backend/software/sw_renderer.h"
+#include "renderer/backend/software/sw_raster.h"
+#include "renderer/backend/software/sw_workers.h"
+#include "renderer/mesh_internal.h"
+#include "tunafish/core/log.h"
+#include "tunafish/platform/thread.h"
+#include "tunafish/platform/window.h"
+#include <stdlib.h>
+#include <string.h>
+
+// =============================================================================
+// Forward declarations
+// =============================================================================
+
+static b32 tf_software_create(TF_RendererBackend *backend, TF_Window *window, const TF_RendererConfig *config);
+static void tf_software_destroy(TF_RendererBackend *backend);
+static void tf_software_begin_frame(TF_RendererBackend *backend);
+static void tf_software_end_frame(TF_RendererBackend *backend);
+static void tf_software_clear(TF_RendererBackend *backend, TF_ClearFlags flags);
+static void tf_software_set_clear_color(TF_RendererBackend *backend, TF_Color color);
+static void tf_software_set_viewport(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height);
+static void tf_software_set_camera(TF_RendererBackend *backend, const TF_CameraUniforms *camera);
+static void tf_software_draw_triangle(TF_RendererBackend *backend, TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3,
+                                      TF_Color color);
+static void tf_software_draw_meshes(TF_RendererBackend *backend, const TF_MeshDraw *draws, u32 count);
+static b32 tf_software_read_pixels(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height, void *pixels);
+static u32 tf_software_readback_begin(TF_RendererBackend *backend, u32 *width, u32 *height);
+static b32 tf_software_readback_end(TF_RendererBackend *backend, u32 ticket, void *pixels, b32 wait);
+static TF_RendererStats tf_software_get_stats(TF_RendererBackend *backend);
+static void tf_software_flush(TF_SoftwareData *sw_data);
+
+// =============================================================================
+// VTable
+// =============================================================================
+
+static TF_RendererBackendVTable s_software_vtable = {
+    .create = tf_software_create,
+    .destroy = tf_software_destroy,
+    .begin_frame = tf_software_begin_frame,
+    .end_frame = tf_software_end_frame,
+    .clear = tf_software_clear,
+    .set_clear_color = tf_software_set_clear_color,
+    .set_viewport = tf_software_set_viewport,
+    .set_camera = tf_software_set_camera,
+    .draw_triangle = tf_software_draw_triangle,
+    .draw_meshes = tf_software_draw_meshes,
+    .release_mesh = NULL, // Meshes are read straight from system memory
+    .read_pixels = tf_software_read_pixels,
+    .readback_begin = tf_software_readback_begin,
+    .readback_end = tf_software_readback_end,
+    .get_stats = tf_software_get_stats
+};
+
+// =============================================================================
+// Backend creation
+// =============================================================================
+
+TF_RendererBackend *tf_renderer_backend_create_software(void) {
+    TF_DEBUG("Creating software renderer backend...");
+
+    TF_RendererBackend *backend = malloc(sizeof(TF_RendererBackend));
+    if (!backend) {
+        TF_ERROR("Failed to allocate software backend");
+        return NULL;
+    }
+
+    backend->vtable = &s_software_vtable;
+    backend->data = NULL;
+
+    return backend;
+}
+
+// =============================================================================
+// Implementation
+// =============================================================================
+
+static b32 tf_software_create(TF_RendererBackend *backend, TF_Window *window, const TF_RendererConfig *config) {
+    TF_DEBUG("Initializing software backend...");
+
+    u32 width = config->width;
+    u32 height = config->height;
+    if ((width == 0 || height == 0) && window) {
+        tf_window_get_size(window, &width, &height);
+    }
+    if (width == 0 || height == 0) {
+        TF_ERROR("Software backend needs a window or a framebuffer size");
+        return TF_FALSE;
+    }
+
+    TF_SoftwareData *sw_data = calloc(1, sizeof(TF_SoftwareData));
+    if (!sw_data) {
+        TF_ERROR("Failed to allocate software data");
+        return TF_FALSE;
+    }
+    backend->data = sw_data;
+
+    sw_data->framebuffer = tf_sw_framebuffer_create(width, height);
+    if (!sw_data->framebuffer) {
+        tf_software_destroy(backend);
+        return TF_FALSE;
+    }
+
+    sw_data->tiles_x = (width + TF_SW_TILE_SIZE - 1) / TF_SW_TILE_SIZE;
+    sw_data->tiles_y = (height + TF_SW_TILE_SIZE - 1) / TF_SW_TILE_SIZE;
+    u32 tile_count = sw_data->tiles_x * sw_data->tiles_y;
+    sw_data->bins = calloc(tile_count, sizeof(TF_SWTileBin));
+    sw_data->active_tiles = malloc(sizeof(u32) * tile_count);
+    if (!sw_data->bins || !sw_data->active_tiles) {
+        TF_ERROR("Failed to allocate %u tile bins", tile_count);
+        tf_software_destroy(backend);
+        return TF_FALSE;
+    }
+
+    // The calling thread rasterizes too, so one core is already covered
+    u32 thread_count = config->worker_threads;
+    if (thread_count == 0) {
+        thread_count = tf_thread_get_cpu_count() - 1;
+        if (thread_count > TF_SOFTWARE_MAX_WORKER_THREADS) {
+            thread_count = TF_SOFTWARE_MAX_WORKER_THREADS;
+        }
+    }
+    sw_data->workers = tf_sw_workers_create(thread_count);
+    if (!sw_data->workers) {
+        tf_software_destroy(backend);
+        return TF_FALSE;
+    }
+
+    sw_data->view_projection = tf_mat4_identity();
+    sw_data->depth_test = config->enable_depth_test;
+    sw_data->viewport_width = width;
+    sw_data->viewport_height = height;
+    sw_data->clear_color = TF_COLOR_BLUE;
+    sw_data->readback_next_ticket = 1;
+
+    TF_INFO("Software backend initialized (%ux%u, %u tiles, %u worker threads)",
+            width, height, tile_count, tf_sw_workers_get_thread_count(sw_data->workers));
+    return TF_TRUE;
+}
+
+// Also used to unwind a partially created backend, so every member may be unset
+static void tf_software_destroy(TF_RendererBackend *backend) {
+    if (!backend || !backend->data) return;
+
+    TF_DEBUG("Destroying software backend...");
+
+    TF_SoftwareData *sw_data = (TF_SoftwareData *)backend->data;
+    tf_sw_workers_destroy(sw_data->workers);
+
+    if (sw_data->bins) {
+        for (u32 i = 0; i < sw_data->tiles_x * sw_data->tiles_y; i++) {
+            free(sw_data->bins[i].triangles);
+        }
+        free(sw_data->bins);
+    }
+    free(sw_data->active_tiles);
+    free(sw_data->triangles);
+    free(sw_data->vertices);
+    for (u32 i = 0; i < TF_SOFTWARE_READBACK_SLOTS; i++) {
+        free(sw_data->readback_pixels[i]);
+    }
+    tf_sw_framebuffer_destroy(sw_data->framebuffer);
+
+    free(sw_data);
+    backend->data = NULL;
+
+    TF_INFO("Software backend destroyed");
+}
+
+static void tf_software_begin_frame(TF_RendererBackend *backend) {
+    if (!backend || !backend->data) return;
+
+    TF_SoftwareData *sw_data = (TF_SoftwareData *)backend->data;
+    sw_data->stats = (TF_RendererStats){0};
+}
+
+static void tf_software_end_frame(TF_RendererBackend *backend) {
+    if (!backend || !backend->data) return;
+
+    // There is nothing to present; the frame is complete once it is rasterized
+    tf_software_flush((TF_SoftwareData *)backend->data);
+}
+
+static void tf_software_clear(TF_RendererBackend *backend, TF_ClearFlags flags) {
+    if (!backend || !backend->data) return;
+
+    // Triangles binned before the clear must land before it
+    TF_SoftwareData *sw_data = (TF_SoftwareData *)backend->data;
+    if (sw_data->triangle_count > 0) {
+        tf_software_flush(sw_data);
+    }
+
+    sw_data->pending_clear |= flags;
+    if (flags & TF_CLEAR_COLOR) {
+        TF_Color color = sw_data->clear_color;
+        sw_data->pending_clear_color = tf_sw_pack_color(color.r, color.g, color.b, color.a);
+    }
+}
+
+static void tf_software_set_clear_color(TF_RendererBackend *backend, TF_Color color) {
+    if (!backend || !backend->data) return;
+
+    TF_SoftwareData *sw_data = (TF_SoftwareData *)backend->data;
+    sw_data->clear_color = color;
+}
+
+static void tf_software_set_viewport(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height) {
+    if (!backend || !backend->data) return;
+
+    // Binned triangles are already in pixels, so only later draws are affected
+    TF_SoftwareData *sw_data = (TF_SoftwareData *)backend->data;
+    sw_data->viewport_x = x;
+    sw_data->viewport_y = y;
+    sw_data->viewport_width = width;
+    sw_data->viewport_height = height;
+}
+
+static void tf_software_set_camera(TF_RendererBackend *backend, const TF_CameraUniforms *camera) {
+    if (!backend || !backend->data || !camera) return;
+
+    TF_SoftwareData *sw_data = (TF_SoftwareData *)backend->data;
+    sw_data->view_projection = camera->view_projection;
+}
+
+// =============================================================================
+// Binning
+// =============================================================================
+
+static b32 tf_software_bin_push(TF_SWTileBin *bin, u32 triangle) {
+    if (bin->count == bin->capacity) {
+        u32 capacity = bin->capacity ? bin->capacity * 2 : 256;
+        u32 *triangles = realloc(bin->triangles, sizeof(u32) * capacity);
+        if (!triangles) {
+            TF_ERROR("Failed to grow tile bin");
+            return TF_FALSE;
+        }
+        bin->triangles = triangles;
+        bin->capacity = capacity;
+    }
+
+    bin->triangles[bin->count++] = triangle;
+    return TF_TRUE;
+}
+
+// Set up a screen-space triangle and add it to every tile its bounds touch
+static void tf_software_bin_triangle(TF_SoftwareData *sw_data, const TF_SWScreenVertex *v0,
+                                     const TF_SWScreenVertex *v1, const TF_SWScreenVertex *v2, u32 flags) {
+    if (sw_data->triangle_count == TF_SOFTWARE_MAX_BINNED_TRIANGLES) {
+        tf_software_flush(sw_data);
+    }
+
+    if (sw_data->triangle_count == sw_data->triangle_capacity) {
+        u32 capacity = sw_data->triangle_capacity ? sw_data->triangle_capacity * 2 : 1024;
+        TF_SWTriangle *triangles = realloc(sw_data->triangles, sizeof(TF_SWTriangle) * capacity);
+        if (!triangles) {
+            TF_ERROR("Failed to grow software triangle storage");
+            return;
+        }
+        sw_data->triangles = triangles;
+        sw_data->triangle_capacity = capacity;
+    }
+
+    const TF_SWFramebuffer *framebuffer = sw_data->framebuffer;
+    i32 clip_min_x = sw_data->viewport_x > 0 ? sw_data->viewport_x : 0;
+    i32 clip_min_y = sw_data->viewport_y > 0 ? sw_data->viewport_y : 0;
+    i32 clip_max_x = sw_data->viewport_x + (i32)sw_data->viewport_width;
+    i32 clip_max_y = sw_data->viewport_y + (i32)sw_data->viewport_height;
+    if (clip_max_x > (i32)framebuffer->width) clip_max_x = (i32)framebuffer->width;
+    if (clip_max_y > (i32)framebuffer->height) clip_max_y = (i32)framebuffer->height;
+
+    u32 index = sw_data->triangle_count;
+    TF_SWTriangle *triangle = &sw_data->triangles[index];
+    if (!tf_sw_triangle_setup(triangle, v0, v1, v2, clip_min_x, clip_min_y, clip_max_x, clip_max_y, flags)) {
+        return;
+    }
+    sw_data->triangle_count++;
+
+    u32 tile_min_x = (u32)triangle->min_x / TF_SW_TILE_SIZE;
+    u32 tile_min_y = (u32)triangle->min_y / TF_SW_TILE_SIZE;
+    u32 tile_max_x = (u32)(triangle->max_x - 1) / TF_SW_TILE_SIZE;
+    u32 tile_max_y = (u32)(triangle->max_y - 1) / TF_SW_TILE_SIZE;
+    for (u32 ty = tile_min_y; ty <= tile_max_y; ty++) {
+        for (u32 tx = tile_min_x; tx <= tile_max_x; tx++) {
+            tf_software_bin_push(&sw_data->bins[ty * sw_data->tiles_x + tx], index);
+        }
+    }
+}
+
+// =============================================================================
+// Vertex processing
+// =============================================================================
+
+#define TF_SW_OUTSIDE_LEFT   (1u << 0)
+#define TF_SW_OUTSIDE_RIGHT  (1u << 1)
+#define TF_SW_OUTSIDE_BOTTOM (1u << 2)
+#define TF_SW_OUTSIDE_TOP    (1u << 3)
+#define TF_SW_OUTSIDE_NEAR   (1u << 4)
+#define TF_SW_OUTSIDE_FAR    (1u << 5)
+
+static u32 tf_software_outcode(const TF_Vec4 *clip) {
+    u32 code = 0;
+    if (clip->x < -clip->w) code |= TF_SW_OUTSIDE_LEFT;
+    if (clip->x > clip->w) code |= TF_SW_OUTSIDE_RIGHT;
+    if (clip->y < -clip->w) code |= TF_SW_OUTSIDE_BOTTOM;
+    if (clip->y > clip->w) code |= TF_SW_OUTSIDE_TOP;
+    if (clip->z < -clip->w) code |= TF_SW_OUTSIDE_NEAR;
+    if (clip->z > clip->w) code |= TF_SW_OUTSIDE_FAR;
+    return code;
+}
+
+static TF_SWVertex tf_software_lerp_vertex(const TF_SWVertex *a, const TF_SWVertex *b, f32 t) {
+    TF_SWVertex result;
+    result.clip.x = a->clip.x + (b->clip.x - a->clip.x) * t;
+    result.clip.y = a->clip.y + (b->clip.y - a->clip.y) * t;
+    result.clip.z = a->clip.z + (b->clip.z - a->clip.z) * t;
+    result.clip.w = a->clip.w + (b->clip.w - a->clip.w) * t;
+    result.color.r = a->color.r + (b->color.r - a->color.r) * t;
+    result.color.g = a->color.g + (b->color.g - a->color.g) * t;
+    result.color.b = a->color.b + (b->color.b - a->color.b) * t;
+    result.color.a = a->color.a + (b->color.a - a->color.a) * t;
+    return result;
+}
+
+// Sutherland-Hodgman against z >= -w (sign = 1) or z <= w (sign = -1)
+static u32 tf_software_clip_polygon(const TF_SWVertex *in, u32 count, TF_SWVertex *out, f32 sign) {
+    u32 out_count = 0;
+    for (u32 i = 0; i < count; i++) {
+        const TF_SWVertex *a = &in[i];
+        const TF_SWVertex *b = &in[(i + 1) % count];
+        f32 da = a->clip.w + sign * a->clip.z;
+        f32 db = b->clip.w + sign * b->clip.z;
+
+        if (da >= 0.0f) {
+            out[out_count++] = *a;
+        }
+        if ((da >= 0.0f) != (db >= 0.0f)) {
+            out[out_count++] = tf_software_lerp_vertex(a, b, da / (da - db));
+        }
+    }
+    return out_count;
+}
+
+static TF_SWScreenVertex tf_software_to_screen(const TF_SoftwareData *sw_data, const TF_SWVertex *vertex) {
+    f32 inv_w = 1.0f / vertex->clip.w;
+    TF_SWScreenVertex screen;
+    screen.x = (f32)sw_data->viewport_x + (vertex->clip.x * inv_w * 0.5f + 0.5f) * (f32)sw_data->viewport_width;
+    screen.y = (f32)sw_data->viewport_y + (vertex->clip.y * inv_w * 0.5f + 0.5f) * (f32)sw_data->viewport_height;
+    screen.z = vertex->clip.z * inv_w * 0.5f + 0.5f;
+    screen.inv_w = inv_w;
+    screen.r = vertex->color.r;
+    screen.g = vertex->color.g;
+    screen.b = vertex->color.b;
+    screen.a = vertex->color.a;
+    return screen;
+}
+
+// Clip a clip-space triangle against the near and far planes and bin the result
+static void tf_software_emit_triangle(TF_SoftwareData *sw_data, const TF_SWVertex *v0, const TF_SWVertex *v1,
+                                      const TF_SWVertex *v2, u32 flags) {
+    u32 code0 = tf_software_outcode(&v0->clip);
+    u32 code1 = tf_software_outcode(&v1->clip);
+    u32 code2 = tf_software_outcode(&v2->clip);
+    if (code0 & code1 & code2) {
+        return;
+    }
+
+    // Near/far crossings are clipped; x/y are handled by the viewport bounds
+    TF_SWVertex polygon[8] = {*v0, *v1, *v2};
+    u32 count = 3;
+    if ((code0 | code1 | code2) & (TF_SW_OUTSIDE_NEAR | TF_SW_OUTSIDE_FAR)) {
+        TF_SWVertex clipped[8];
+        count = tf_software_clip_polygon(polygon, count, clipped, 1.0f);
+        count = tf_software_clip_polygon(clipped, count, polygon, -1.0f);
+        if (count < 3) {
+            return;
+        }
+    }
+
+    TF_SWScreenVertex screen[8];
+    for (u32 i = 0; i < count; i++) {
+        if (polygon[i].clip.w <= 0.0f) {
+            return;
+        }
+        screen[i] = tf_software_to_screen(sw_data, &polygon[i]);
+    }
+    for (u32 i = 1; i + 1 < count; i++) {
+        tf_software_bin_triangle(sw_data, &screen[0], &screen[i], &screen[i + 1], flags);
+    }
+}
+
+static void tf_software_draw_triangle(TF_RendererBackend *backend, TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3,
+                                      TF_Color color) {
+    if (!backend || !backend->data) return;
+
+    // Immediate triangles are clip-space overlays without depth testing
+    TF_SoftwareData *sw_data = (TF_SoftwareData *)backend->data;
+    TF_SWVertex v0 = {{p1.x, p1.y, p1.z, 1.0f}, color};
+    TF_SWVertex v1 = {{p2.x, p2.y, p2.z, 1.0f}, color};
+    TF_SWVertex v2 = {{p3.x, p3.y, p3.z, 1.0f}, color};
+    tf_software_emit_triangle(sw_data, &v0, &v1, &v2, 0);
+
+    sw_data->stats.triangles++;
+}
+
+static const TF_VertexElement *tf_software_find_element(const TF_VertexLayout *layout, TF_VertexAttribute attribute) {
+    for (u32 i = 0; i < layout->element_count; i++) {
+        if (layout->elements[i].attribute == attribute) {
+            return &layout->elements[i];
+        }
+    }
+    return NULL;
+}
+
+static TF_Vec4 tf_software_read_element(const TF_VertexElement *element, const u8 *vertex, f32 default_w) {
+    const u8 *data = vertex + element->offset;
+    TF_Vec4 value = {0.0f, 0.0f, 0.0f, default_w};
+    switch (element->format) {
+        case TF_VERTEX_FORMAT_FLOAT4:
+            memcpy(&value, data, sizeof(f32) * 4);
+            break;
+        case TF_VERTEX_FORMAT_FLOAT3:
+            memcpy(&value, data, sizeof(f32) * 3);
+            break;
+        case TF_VERTEX_FORMAT_FLOAT2:
+            memcpy(&value, data, sizeof(f32) * 2);
+            break;
+        case TF_VERTEX_FORMAT_UBYTE4_NORM:
+            value = (TF_Vec4){data[0] / 255.0f, data[1] / 255.0f, data[2] / 255.0f, data[3] / 255.0f};
+            break;
+    }
+    return value;
+}
+
+static void tf_software_draw_mesh(TF_SoftwareData *sw_data, const TF_MeshDraw *draw) {
+    const TF_Mesh *mesh = draw->mesh;
+    const TF_VertexElement *position = tf_software_find_element(&mesh->layout, TF_VERTEX_ATTRIBUTE_POSITION);
+    const TF_VertexElement *color = tf_software_find_element(&mesh->layout, TF_VERTEX_ATTRIBUTE_COLOR);
+    if (!position) {
+        TF_WARN("Mesh %u has no position attribute", mesh->id);
+        return;
+    }
+
+    if (mesh->vertex_count > sw_data->vertex_capacity) {
+        TF_SWVertex *vertices = realloc(sw_data->vertices, sizeof(TF_SWVertex) * mesh->vertex_count);
+        if (!vertices) {
+            TF_ERROR("Failed to grow software vertex scratch to %u vertices", mesh->vertex_count);
+            return;
+        }
+        sw_data->vertices = vertices;
+        sw_data->vertex_capacity = mesh->vertex_count;
+    }
+
+    // Only the triangles in the draw's ranges, when it has any
+    u32 range_count = draw->range_count ? draw->range_count : 1;
+    u32 index_count = draw->range_count ? 0 : mesh->index_count;
+    for (u32 r = 0; r < draw->range_count; r++) {
+        index_count += draw->ranges[r].index_count;
+    }
+
+    // Same rules as the GL pipeline: depth writes only happen with depth testing
+    u32 flags = sw_data->depth_test ? TF_SW_TRIANGLE_DEPTH_TEST | TF_SW_TRIANGLE_DEPTH_WRITE : 0;
+    const u8 *vertex_data = (const u8 *)mesh->vertices;
+
+    for (u32 instance = 0; instance < draw->instance_count; instance++) {
+        const TF_InstanceData *data = &draw->instances[instance];
+        TF_Mat4 model = tf_mat4_identity();
+        for (u32 row = 0; row < 3; row++) {
+            for (u32 column = 0; column < 4; column++) {
+                model.m[column * 4 + row] = data->transform[row * 4 + column];
+            }
+        }
+        TF_Mat4 mvp = tf_mat4_multiply(sw_data->view_projection, model);
+
+        for (u32 i = 0; i < mesh->vertex_count; i++) {
+            const u8 *vertex = vertex_data + (usize)i * mesh->layout.stride;
+            TF_SWVertex *out = &sw_data->vertices[i];
+
+            TF_Vec4 p = tf_software_read_element(position, vertex, 1.0f);
+            p.w = 1.0f;
+            out->clip = tf_mat4_multiply_vec4(mvp, p);
+
+            TF_Vec4 c = color ? tf_software_read_element(color, vertex, 1.0f) : (TF_Vec4){1.0f, 1.0f, 1.0f, 1.0f};
+            out->color = (TF_Color){c.x * data->color.r, c.y * data->color.g, c.z * data->color.b,
+                                    c.w * data->color.a};
+        }
+
+        for (u32 r = 0; r < range_count; r++) {
+            const TF_IndexRange range = draw->range_count ? draw->ranges[r] : (TF_IndexRange){0, mesh->index_count};
+            for (u32 i = range.first_index; i + 2 < range.first_index + range.index_count; i += 3) {
+                tf_software_emit_triangle(sw_data, &sw_data->vertices[mesh->indices[i]],
+                                          &sw_data->vertices[mesh->indices[i + 1]],
+                                          &sw_data->vertices[mesh->indices[i + 2]], flags);
+            }
+        }
+    }
+
+    sw_data->stats.draw_calls++;
+    sw_data->stats.instances += draw->instance_count;
+    sw_data->stats.triangles += index_count / 3 * draw->instance_count;
+}
+
+static void tf_software_draw_meshes(TF_RendererBackend *backend, const TF_MeshDraw *draws, u32 count) {
+    if (!backend || !backend->data || !draws) return;
+
+    TF_SoftwareData *sw_data = (TF_SoftwareData *)backend->data;
+    for (u32 i = 0; i < count; i++) {
+        if (draws[i].mesh && draws[i].instances) {
+            tf_software_draw_mesh(sw_data, &draws[i]);
+        }
+    }
+}
+
+// =============================================================================
+// Raster passes
+// =============================================================================
+
+typedef struct {
+    TF_SoftwareData *sw_data;
+    u32 clear;
+    u32 clear_color;
+} TF_SWRasterPass;
+
+static void tf_software_raster_tile(void *user_data, u32 task) {
+    const TF_SWRasterPass *pass = (const TF_SWRasterPass *)user_data;
+    TF_SoftwareData *sw_data = pass->sw_data;
+    TF_SWFramebuffer *framebuffer = sw_data->framebuffer;
+
+    u32 tile = sw_data->active_tiles[task];
+    i32 min_x = (i32)((tile % sw_data->tiles_x) * TF_SW_TILE_SIZE);
+    i32 min_y = (i32)((tile / sw_data->tiles_x) * TF_SW_TILE_SIZE);
+    i32 max_x = min_x + TF_SW_TILE_SIZE > (i32)framebuffer->width ? (i32)framebuffer->width : min_x + TF_SW_TILE_SIZE;
+    i32 max_y = min_y + TF_SW_TILE_SIZE > (i32)framebuffer->height ? (i32)framebuffer->height : min_y + TF_SW_TILE_SIZE;
+
+    if (pass->clear) {
+        const f32 far_depth = 1.0f;
+        tf_sw_clear_rect(framebuffer, (pass->clear & TF_CLEAR_COLOR) ? &pass->clear_color : NULL,
+                         (pass->clear & TF_CLEAR_DEPTH) ? &far_depth : NULL, min_x, min_y, max_x, max_y);
+    }
+
+    const TF_SWTileBin *bin = &sw_data->bins[tile];
+    tf_sw_rasterize(framebuffer, sw_data->triangles, bin->triangles, bin->count, min_x, min_y, max_x, max_y);
+}
+
+// Rasterize everything binned so far (and apply a pending clear), one task per tile
+static void tf_software_flush(TF_SoftwareData *sw_data) {
+    if (sw_data->triangle_count == 0 && sw_data->pending_clear == 0) return;
+
+    u32 active_count = 0;
+    u32 tile_count = sw_data->tiles_x * sw_data->tiles_y;
+    for (u32 tile = 0; tile < tile_count; tile++) {
+        if (sw_data->pending_clear || sw_data->bins[tile].count > 0) {
+            sw_data->active_tiles[active_count++] = tile;
+        }
+    }
+
+    TF_SWRasterPass pass = {sw_data, sw_data->pending_clear, sw_data->pending_clear_color};
+    tf_sw_workers_run(sw_data->workers, tf_software_raster_tile, &pass, active_count);
+
+    for (u32 tile = 0; tile < tile_count; tile++) {
+        sw_data->bins[tile].count = 0;
+    }
+    sw_data->triangle_count = 0;
+    sw_data->pending_clear = 0;
+    sw_data->stats.batch_flushes++;
+}
+
+static b32 tf_software_read_pixels(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height, void *pixels) {
+    if (!backend || !backend->data) return TF_FALSE;
+
+    TF_SoftwareData *sw_data = (TF_SoftwareData *)backend->data;
+    const TF_SWFramebuffer *framebuffer = sw_data->framebuffer;
+    if (x < 0 || y < 0 || (u32)x + width > framebuffer->width || (u32)y + height > framebuffer->height) {
+        TF_ERROR("Read of %ux%u pixels at (%d, %d) is outside the %ux%u framebuffer",
+                 width, height, x, y, framebuffer->width, framebuffer->height);
+        return TF_FALSE;
+    }
+
+    tf_software_flush(sw_data);
+
+    u8 *out = (u8 *)pixels;
+    for (u32 row = 0; row < height; row++) {
+        const u32 *source = framebuffer->color + (usize)(y + (i32)row) * framebuffer->pitch + x;
+        memcpy(out + (usize)row * width * 4, source, (usize)width * 4);
+    }
+    return TF_TRUE;
+}
+
+// Rasterization is finished by the time begin returns, so the copy is made
+// right away and end only hands it out
+static u32 tf_software_readback_begin(TF_RendererBackend *backend, u32 *width, u32 *height) {
+    if (!backend || !backend->data) return 0;
+
+    TF_SoftwareData *sw_data = (TF_SoftwareData *)backend->data;
+    const TF_SWFramebuffer *framebuffer = sw_data->framebuffer;
+    u32 ticket = sw_data->readback_next_ticket;
+    u32 slot = (ticket - 1) % TF_SOFTWARE_READBACK_SLOTS;
+    if (sw_data->readback_tickets[slot] != 0) {
+        return 0;
+    }
+
+    if (!sw_data->readback_pixels[slot]) {
+        sw_data->readback_pixels[slot] = malloc((usize)framebuffer->width * framebuffer->height * 4);
+        if (!sw_data->readback_pixels[slot]) {
+            TF_ERROR("Failed to allocate readback frame");
+            return 0;
+        }
+    }
+
+    tf_software_flush(sw_data);
+    for (u32 row = 0; row < framebuffer->height; row++) {
+        memcpy(sw_data->readback_pixels[slot] + (usize)row * framebuffer->width,
+               framebuffer->color + (usize)row * framebuffer->pitch, (usize)framebuffer->width * 4);
+    }
+
+    *width = framebuffer->width;
+    *height = framebuffer->height;
+    sw_data->readback_tickets[slot] = ticket;
+    sw_data->readback_next_ticket = ticket + 1 ? ticket + 1 : 1;
+    return ticket;
+}
+
+static b32 tf_software_readback_end(TF_RendererBackend *backend, u32 ticket, void *pixels, b32 wait) {
+    if (!backend || !backend->data || ticket == 0) return TF_FALSE;
+    (void)wait;
+
+    TF_SoftwareData *sw_data = (TF_SoftwareData *)backend->data;
+    u32 slot = (ticket - 1) % TF_SOFTWARE_READBACK_SLOTS;
+    if (sw_data->readback_tickets[slot] != ticket) {
+        TF_WARN("Readback ticket %u is not in flight", ticket);
+        return TF_FALSE;
+    }
+
+    if (pixels) {
+        const TF_SWFramebuffer *framebuffer = sw_data->framebuffer;
+        memcpy(pixels, sw_data->readback_pixels[slot], (usize)framebuffer->width * framebuffer->height * 4);
+    }
+    sw_data->readback_tickets[slot] = 0;
+    return TF_TRUE;
+}
+
+static TF_RendererStats tf_software_get_stats(TF_RendererBackend *backend) {
+    if (!backend || !backend->data) return (TF_RendererStats){0};
+
+    TF_SoftwareData *sw_data = (TF_SoftwareData *)backend->data;
+    return sw_data->stats;
+}
@@ -0,0 +1,141 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "renderer/backend/software/sw_workers.h"
+#include "tunafish/core/log.h"
+#include "tunafish/platform/thread.h"
+#include <stdlib.h>
+
+struct TF_SWWorkers {
+    TF_Thread **threads;
+    u32 thread_count;
+
+    TF_Mutex *mutex;
+    TF_Condition *wake;     // A new batch was published (or quit)
+    TF_Condition *finished; // The last busy worker left the batch
+    u32 generation;         // Bumped per batch, under mutex
+    u32 busy;               // Workers still inside the current batch, under mutex
+    b32 quit;
+
+    // Current batch
+    TF_SWTaskFunction function;
+    void *user_data;
+    u32 task_count;
+    volatile u32 next_task;
+};
+
+static void tf_sw_workers_drain(TF_SWWorkers *workers) {
+    for (;;) {
+        u32 task = tf_atomic_add_u32(&workers->next_task, 1);
+        if (task >= workers->task_count) {
+            break;
+        }
+        workers->function(workers->user_data, task);
+    }
+}
+
+static void tf_sw_worker_main(void *user_data) {
+    TF_SWWorkers *workers = (TF_SWWorkers *)user_data;
+    u32 seen = 0;
+
+    tf_mutex_lock(workers->mutex);
+    for (;;) {
+        while (workers->generation == seen && !workers->quit) {
+            tf_condition_wait(workers->wake, workers->mutex);
+        }
+        if (workers->quit) {
+            break;
+        }
+        seen = workers->generation;
+        tf_mutex_unlock(workers->mutex);
+
+        tf_sw_workers_drain(workers);
+
+        tf_mutex_lock(workers->mutex);
+        if (--workers->busy == 0) {
+            tf_condition_signal(workers->finished);
+        }
+    }
+    tf_mutex_unlock(workers->mutex);
+}
+
+TF_SWWorkers *tf_sw_workers_create(u32 thread_count) {
+    TF_SWWorkers *workers = calloc(1, sizeof(TF_SWWorkers));
+    if (!workers) {
+        TF_ERROR("Failed to allocate software worker pool");
+        return NULL;
+    }
+
+    workers->mutex = tf_mutex_create();
+    workers->wake = tf_condition_create();
+    workers->finished = tf_condition_create();
+    workers->threads = thread_count ? calloc(thread_count, sizeof(TF_Thread *)) : NULL;
+    if (!workers->mutex || !workers->wake || !workers->finished || (thread_count && !workers->threads)) {
+        tf_sw_workers_destroy(workers);
+        return NULL;
+    }
+
+    for (u32 i = 0; i < thread_count; i++) {
+        workers->threads[i] = tf_thread_create(tf_sw_worker_main, workers);
+        if (!workers->threads[i]) {
+            TF_WARN("Software rasterizer continues with %u worker threads", i);
+            break;
+        }
+        workers->thread_count++;
+    }
+
+    return workers;
+}
+
+void tf_sw_workers_destroy(TF_SWWorkers *workers) {
+    if (!workers) return;
+
+    if (workers->mutex) {
+        tf_mutex_lock(workers->mutex);
+        workers->quit = TF_TRUE;
+        tf_condition_broadcast(workers->wake);
+        tf_mutex_unlock(workers->mutex);
+    }
+    for (u32 i = 0; i < workers->thread_count; i++) {
+        tf_thread_join(workers->threads[i]);
+    }
+
+    free(workers->threads);
+    tf_condition_destroy(workers->finished);
+    tf_condition_destroy(workers->wake);
+    tf_mutex_destroy(workers->mutex);
+    free(workers);
+}
+
+void tf_sw_workers_run(TF_SWWorkers *workers, TF_SWTaskFunction function, void *user_data, u32 task_count) {
+    if (task_count == 0) return;
+
+    workers->function = function;
+    workers->user_data = user_data;
+    workers->task_count = task_count;
+    tf_atomic_store_u32(&workers->next_task, 0);
+
+    // Small batches are not worth waking anyone for
+    if (workers->thread_count == 0 || task_count == 1) {
+        tf_sw_workers_drain(workers);
+        return;
+    }
+
+    tf_mutex_lock(workers->mutex);
+    workers->generation++;
+    workers->busy = workers->thread_count;
+    tf_condition_broadcast(workers->wake);
+    tf_mutex_unlock(workers->mutex);
+
+    tf_sw_workers_drain(workers);
+
+    tf_mutex_lock(workers->mutex);
+    while (workers->busy > 0) {
+        tf_condition_wait(workers->finished, workers->mutex);
+    }
+    tf_mutex_unlock(workers->mutex);
+}
+
+u32 tf_sw_workers_get_thread_count(const TF_SWWorkers *workers) {
+    return workers ? workers->thread_count : 0;
+}
@@ -0,0 +1,35 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// Worker pool - parallel for over independent tasks (tiles)
+// =============================================================================
+
+// Workers sleep until tf_sw_workers_run publishes a batch, then claim task
+// indices with an atomic counter; the calling thread works through the batch
+// too and returns once every task has finished.
+
+typedef void (*TF_SWTaskFunction)(void *user_data, u32 task);
+
+typedef struct TF_SWWorkers TF_SWWorkers;
+
+// thread_count extra threads (0 = run everything on the calling thread)
+TF_SWWorkers *tf_sw_workers_create(u32 thread_count);
+
+void tf_sw_workers_destroy(TF_SWWorkers *workers);
+
+void tf_sw_workers_run(TF_SWWorkers *workers, TF_SWTaskFunction function, void *user_data, u32 task_count);
+
+u32 tf_sw_workers_get_thread_count(const TF_SWWorkers *workers);
+
+#ifdef __cplusplus
+}
+#endif
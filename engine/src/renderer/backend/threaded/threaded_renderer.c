@@ -0,0 +1,770 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "tunafish/renderer/backend/threaded/threaded_renderer.h"
+#include "renderer/mesh_internal.h"
+#include "tunafish/platform/thread.h"
+#include "tunafish/platform/window.h"
+#include "tunafish/core/log.h"
+#include "tunafish/core/time.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TF_THREADED_PACKET_INITIAL_CAPACITY (64 * 1024)
+#define TF_THREADED_ALIGNMENT 8
+
+// =============================================================================
+// Packet encoding
+// =============================================================================
+
+typedef enum {
+    TF_THREADED_OP_BEGIN_FRAME = 0,
+    TF_THREADED_OP_END_FRAME,
+    TF_THREADED_OP_PRESENT,
+    TF_THREADED_OP_CLEAR,
+    TF_THREADED_OP_SET_CLEAR_COLOR,
+    TF_THREADED_OP_SET_VIEWPORT,
+    TF_THREADED_OP_SET_CAMERA,
+    TF_THREADED_OP_DRAW_TRIANGLE,
+    TF_THREADED_OP_DRAW_MESHES,
+    TF_THREADED_OP_BEGIN_PASS,
+    TF_THREADED_OP_END_PASS,
+    TF_THREADED_OP_CALL
+} TF_ThreadedOp;
+
+// Precedes every op's payload; size covers both, padded to the alignment
+typedef struct {
+    u32 op;
+    u32 size;
+} TF_ThreadedOpHeader;
+
+typedef struct {
+    i32 x, y;
+    u32 width, height;
+} TF_ThreadedViewport;
+
+typedef struct {
+    TF_Vec3 p1, p2, p3;
+    TF_Color color;
+} TF_ThreadedTriangle;
+
+// Followed by count draws, then their instances back to back, then their ranges
+typedef struct {
+    u32 count;
+    u32 instance_count;
+    u32 range_count;
+} TF_ThreadedMeshes;
+
+// Runs on the render thread while the recording thread waits for it
+typedef void (*TF_ThreadedCallFunction)(TF_ThreadedData *threaded, void *data);
+
+typedef struct {
+    TF_ThreadedCallFunction function;
+    void *data;
+} TF_ThreadedCall;
+
+// =============================================================================
+// Forward declarations
+// =============================================================================
+
+static b32 tf_threaded_create(TF_RendererBackend *backend, TF_Window *window, const TF_RendererConfig *config);
+static void tf_threaded_destroy(TF_RendererBackend *backend);
+static void tf_threaded_begin_frame(TF_RendererBackend *backend);
+static void tf_threaded_end_frame(TF_RendererBackend *backend);
+static void tf_threaded_present(TF_RendererBackend *backend);
+static void tf_threaded_clear(TF_RendererBackend *backend, TF_ClearFlags flags);
+static void tf_threaded_set_clear_color(TF_RendererBackend *backend, TF_Color color);
+static void tf_threaded_set_viewport(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height);
+static void tf_threaded_set_camera(TF_RendererBackend *backend, const TF_CameraUniforms *camera);
+static void tf_threaded_draw_triangle(TF_RendererBackend *backend, TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3, TF_Color color);
+static void tf_threaded_draw_meshes(TF_RendererBackend *backend, const TF_MeshDraw *draws, u32 count);
+static void tf_threaded_release_mesh(TF_RendererBackend *backend, TF_Mesh *mesh);
+static b32 tf_threaded_read_pixels(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height, void *pixels);
+static u32 tf_threaded_readback_begin(TF_RendererBackend *backend, u32 *width, u32 *height);
+static b32 tf_threaded_readback_end(TF_RendererBackend *backend, u32 ticket, void *pixels, b32 wait);
+static void tf_threaded_begin_pass(TF_RendererBackend *backend, const char *name);
+static void tf_threaded_end_pass(TF_RendererBackend *backend);
+static b32 tf_threaded_get_gpu_timings(TF_RendererBackend *backend, TF_GPUTimings *timings);
+static TF_RendererStats tf_threaded_get_stats(TF_RendererBackend *backend);
+static u32 tf_threaded_get_api_calls(TF_RendererBackend *backend, TF_APICallCount *calls, u32 max_calls);
+
+// =============================================================================
+// VTable
+// =============================================================================
+
+static const TF_RendererBackendVTable s_threaded_vtable = {
+    .create = tf_threaded_create,
+    .destroy = tf_threaded_destroy,
+    .begin_frame = tf_threaded_begin_frame,
+    .end_frame = tf_threaded_end_frame,
+    .present = tf_threaded_present,
+    .clear = tf_threaded_clear,
+    .set_clear_color = tf_threaded_set_clear_color,
+    .set_viewport = tf_threaded_set_viewport,
+    .set_camera = tf_threaded_set_camera,
+    .draw_triangle = tf_threaded_draw_triangle,
+    .draw_meshes = tf_threaded_draw_meshes,
+    .release_mesh = tf_threaded_release_mesh,
+    .read_pixels = tf_threaded_read_pixels,
+    .readback_begin = tf_threaded_readback_begin,
+    .readback_end = tf_threaded_readback_end,
+    .begin_pass = tf_threaded_begin_pass,
+    .end_pass = tf_threaded_end_pass,
+    .get_gpu_timings = tf_threaded_get_gpu_timings,
+    .get_stats = tf_threaded_get_stats,
+    .get_api_calls = tf_threaded_get_api_calls
+};
+
+// =============================================================================
+// Backend creation
+// =============================================================================
+
+TF_RendererBackend *tf_renderer_backend_create_threaded(TF_RendererBackend *backend) {
+    if (!backend) {
+        return NULL;
+    }
+
+    TF_DEBUG("Creating threaded renderer backend...");
+
+    TF_ThreadedData *threaded = calloc(1, sizeof(TF_ThreadedData));
+    if (!threaded) {
+        TF_ERROR("Failed to allocate threaded backend");
+        free(backend);
+        return NULL;
+    }
+
+    // Optional entry points stay optional, so callers can still test for them.
+    // release_mesh is kept either way, since draws in flight must finish
+    // first, and so is present, which hands the frame over.
+    const TF_RendererBackendVTable *target = backend->vtable;
+    threaded->target = target;
+    threaded->vtable = s_threaded_vtable;
+    if (!target->set_camera) threaded->vtable.set_camera = NULL;
+    if (!target->read_pixels) threaded->vtable.read_pixels = NULL;
+    if (!target->readback_begin || !target->readback_end) {
+        threaded->vtable.readback_begin = NULL;
+        threaded->vtable.readback_end = NULL;
+    }
+    if (!target->begin_pass || !target->end_pass) {
+        threaded->vtable.begin_pass = NULL;
+        threaded->vtable.end_pass = NULL;
+    }
+    if (!target->get_gpu_timings) threaded->vtable.get_gpu_timings = NULL;
+    if (!target->get_api_calls) threaded->vtable.get_api_calls = NULL;
+
+    // The wrapped backend's functions run against this struct, so its data
+    // lands here and meshes it uploads point back at the wrapper
+    threaded->backend.vtable = &threaded->vtable;
+    threaded->backend.data = NULL;
+    free(backend);
+
+    return &threaded->backend;
+}
+
+// =============================================================================
+// Submission ring (recording thread)
+// =============================================================================
+
+// The backend handed out is the first member
+static TF_ThreadedData *tf_threaded_data(TF_RendererBackend *backend) {
+    return (TF_ThreadedData *)backend;
+}
+
+// Open the head packet for encoding, waiting while the ring is full
+static TF_ThreadedPacket *tf_threaded_acquire(TF_ThreadedData *threaded) {
+    TF_ThreadedPacket *packet = &threaded->packets[threaded->head % TF_THREADED_PACKETS];
+    if (threaded->recording) {
+        return packet;
+    }
+
+    if (threaded->head - tf_atomic_load_u32(&threaded->tail) >= TF_THREADED_PACKETS) {
+        tf_mutex_lock(threaded->mutex);
+        while (threaded->head - tf_atomic_load_u32(&threaded->tail) >= TF_THREADED_PACKETS) {
+            tf_condition_wait(threaded->progress, threaded->mutex);
+        }
+        tf_mutex_unlock(threaded->mutex);
+    }
+
+    packet->size = 0;
+    threaded->recording = TF_TRUE;
+    return packet;
+}
+
+// Append an op to the head packet and return its payload (NULL on failure)
+static void *tf_threaded_encode(TF_ThreadedData *threaded, TF_ThreadedOp op, usize payload_size) {
+    TF_ThreadedPacket *packet = tf_threaded_acquire(threaded);
+
+    usize size = (sizeof(TF_ThreadedOpHeader) + payload_size + TF_THREADED_ALIGNMENT - 1) &
+                 ~(usize)(TF_THREADED_ALIGNMENT - 1);
+    if (packet->size + size > packet->capacity) {
+        u32 capacity = packet->capacity ? packet->capacity : TF_THREADED_PACKET_INITIAL_CAPACITY;
+        while (capacity < packet->size + size) {
+            capacity *= 2;
+        }
+
+        u8 *data = realloc(packet->data, capacity);
+        if (!data) {
+            TF_ERROR("Failed to grow render thread packet to %u bytes", capacity);
+            return NULL;
+        }
+        packet->data = data;
+        packet->capacity = capacity;
+    }
+
+    TF_ThreadedOpHeader *header = (TF_ThreadedOpHeader *)(packet->data + packet->size);
+    header->op = op;
+    header->size = (u32)size;
+    packet->size += (u32)size;
+    return header + 1;
+}
+
+// Hand the head packet to the render thread
+static void tf_threaded_publish(TF_ThreadedData *threaded) {
+    if (!threaded->recording) {
+        return;
+    }
+
+    threaded->recording = TF_FALSE;
+    tf_atomic_add_u32(&threaded->head, 1);
+
+    tf_mutex_lock(threaded->mutex);
+    tf_condition_signal(threaded->work);
+    tf_mutex_unlock(threaded->mutex);
+}
+
+// Run function on the render thread after everything queued so far, and wait for it
+static b32 tf_threaded_call(TF_ThreadedData *threaded, TF_ThreadedCallFunction function, void *data) {
+    TF_ThreadedCall *call = tf_threaded_encode(threaded, TF_THREADED_OP_CALL, sizeof(TF_ThreadedCall));
+    if (!call) {
+        return TF_FALSE;
+    }
+
+    call->function = function;
+    call->data = data;
+    u32 issued = ++threaded->calls_issued;
+    tf_threaded_publish(threaded);
+
+    tf_mutex_lock(threaded->mutex);
+    while (tf_atomic_load_u32(&threaded->calls_completed) != issued) {
+        tf_condition_wait(threaded->progress, threaded->mutex);
+    }
+    tf_mutex_unlock(threaded->mutex);
+    return TF_TRUE;
+}
+
+// =============================================================================
+// Render thread
+// =============================================================================
+
+static void tf_threaded_notify_progress(TF_ThreadedData *threaded) {
+    tf_mutex_lock(threaded->mutex);
+    tf_condition_broadcast(threaded->progress);
+    tf_mutex_unlock(threaded->mutex);
+}
+
+// Publish the wrapped backend's results for the recording thread
+static void tf_threaded_publish_results(TF_ThreadedData *threaded) {
+    TF_RendererBackend *backend = &threaded->backend;
+    TF_RendererStats stats = threaded->target->get_stats(backend);
+    if (stats.cpu_to_swap_ms > 0.0f) {
+        stats.cpu_to_swap_ms += threaded->queue_delay_ms;
+    }
+
+    TF_GPUTimings timings;
+    b32 has_timings = threaded->target->get_gpu_timings && threaded->target->get_gpu_timings(backend, &timings);
+
+    tf_mutex_lock(threaded->mutex);
+    threaded->stats = stats;
+    if (has_timings) {
+        threaded->gpu_timings = timings;
+        threaded->has_gpu_timings = TF_TRUE;
+    }
+    tf_mutex_unlock(threaded->mutex);
+}
+
+static void tf_threaded_execute(TF_ThreadedData *threaded, TF_ThreadedPacket *packet) {
+    TF_RendererBackend *backend = &threaded->backend;
+    const TF_RendererBackendVTable *target = threaded->target;
+
+    u32 offset = 0;
+    while (offset < packet->size) {
+        TF_ThreadedOpHeader *header = (TF_ThreadedOpHeader *)(packet->data + offset);
+        void *payload = header + 1;
+        offset += header->size;
+
+        switch (header->op) {
+            case TF_THREADED_OP_BEGIN_FRAME:
+                threaded->queue_delay_ms = (f32)((tf_time_get_current() - *(f64 *)payload) * 1000.0);
+                target->begin_frame(backend);
+                break;
+            case TF_THREADED_OP_END_FRAME:
+                target->end_frame(backend);
+                break;
+            case TF_THREADED_OP_PRESENT:
+                if (target->present) {
+                    target->present(backend);
+                }
+                tf_threaded_publish_results(threaded);
+                tf_atomic_add_u32(&threaded->frames_presented, 1);
+                break;
+            case TF_THREADED_OP_CLEAR:
+                target->clear(backend, *(TF_ClearFlags *)payload);
+                break;
+            case TF_THREADED_OP_SET_CLEAR_COLOR:
+                target->set_clear_color(backend, *(TF_Color *)payload);
+                break;
+            case TF_THREADED_OP_SET_VIEWPORT: {
+                const TF_ThreadedViewport *viewport = payload;
+                target->set_viewport(backend, viewport->x, viewport->y, viewport->width, viewport->height);
+                break;
+            }
+            case TF_THREADED_OP_SET_CAMERA:
+                target->set_camera(backend, (const TF_CameraUniforms *)payload);
+                break;
+            case TF_THREADED_OP_DRAW_TRIANGLE: {
+                const TF_ThreadedTriangle *triangle = payload;
+                target->draw_triangle(backend, triangle->p1, triangle->p2, triangle->p3, triangle->color);
+                break;
+            }
+            case TF_THREADED_OP_DRAW_MESHES: {
+                const TF_ThreadedMeshes *meshes = payload;
+                TF_MeshDraw *draws = (TF_MeshDraw *)(meshes + 1);
+                const TF_InstanceData *instances = (const TF_InstanceData *)(draws + meshes->count);
+                const TF_IndexRange *ranges = (const TF_IndexRange *)(instances + meshes->instance_count);
+                for (u32 i = 0; i < meshes->count; i++) {
+                    draws[i].instances = instances;
+                    draws[i].ranges = ranges;
+                    instances += draws[i].instance_count;
+                    ranges += draws[i].range_count;
+                }
+                target->draw_meshes(backend, draws, meshes->count);
+                break;
+            }
+            case TF_THREADED_OP_BEGIN_PASS:
+                target->begin_pass(backend, (const char *)payload);
+                break;
+            case TF_THREADED_OP_END_PASS:
+                target->end_pass(backend);
+                break;
+            case TF_THREADED_OP_CALL: {
+                const TF_ThreadedCall *call = payload;
+                call->function(threaded, call->data);
+                tf_atomic_add_u32(&threaded->calls_completed, 1);
+                tf_threaded_notify_progress(threaded);
+                break;
+            }
+            default:
+                TF_WARN("Unknown render thread op: %u", header->op);
+                break;
+        }
+    }
+}
+
+static void tf_threaded_main(void *user_data) {
+    TF_ThreadedData *threaded = (TF_ThreadedData *)user_data;
+
+    while (threaded->running) {
+        u32 tail = threaded->tail;
+        if (tf_atomic_load_u32(&threaded->head) == tail) {
+            tf_mutex_lock(threaded->mutex);
+            while (tf_atomic_load_u32(&threaded->head) == tail) {
+                tf_condition_wait(threaded->work, threaded->mutex);
+            }
+            tf_mutex_unlock(threaded->mutex);
+        }
+
+        tf_threaded_execute(threaded, &threaded->packets[tail % TF_THREADED_PACKETS]);
+        tf_atomic_store_u32(&threaded->tail, tail + 1);
+        tf_threaded_notify_progress(threaded);
+    }
+}
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+typedef struct {
+    TF_Window *window;
+    const TF_RendererConfig *config;
+    b32 result;
+} TF_ThreadedCreateCall;
+
+static void tf_threaded_create_call(TF_ThreadedData *threaded, void *data) {
+    TF_ThreadedCreateCall *call = (TF_ThreadedCreateCall *)data;
+
+    if (threaded->owns_context && !tf_window_make_context_current(threaded->window)) {
+        TF_ERROR("Failed to make the GL context current on the render thread");
+        threaded->running = TF_FALSE;
+        return;
+    }
+
+    call->result = threaded->target->create(&threaded->backend, call->window, call->config);
+    if (!call->result) {
+        if (threaded->owns_context) {
+            tf_window_release_context(threaded->window);
+        }
+        threaded->running = TF_FALSE;
+        return;
+    }
+
+    tf_threaded_publish_results(threaded);
+}
+
+static void tf_threaded_destroy_call(TF_ThreadedData *threaded, void *data) {
+    (void)data;
+
+    threaded->target->destroy(&threaded->backend);
+    if (threaded->owns_context) {
+        tf_window_release_context(threaded->window);
+    }
+    threaded->running = TF_FALSE;
+}
+
+// Join the render thread (once it has left its loop) and free what the
+// wrapper owns; the context goes back to the calling thread
+static void tf_threaded_shutdown(TF_ThreadedData *threaded) {
+    if (threaded->thread) {
+        tf_thread_join(threaded->thread);
+        threaded->thread = NULL;
+    }
+    if (threaded->owns_context) {
+        tf_window_make_context_current(threaded->window);
+    }
+
+    // Meshes outlive the backend
+    for (u32 i = 0; i < threaded->mesh_count; i++) {
+        threaded->meshes[i]->thread_owner = NULL;
+    }
+    free(threaded->meshes);
+    threaded->meshes = NULL;
+    threaded->mesh_count = 0;
+
+    for (u32 i = 0; i < TF_THREADED_PACKETS; i++) {
+        free(threaded->packets[i].data);
+        threaded->packets[i] = (TF_ThreadedPacket){0};
+    }
+
+    tf_condition_destroy(threaded->progress);
+    tf_condition_destroy(threaded->work);
+    tf_mutex_destroy(threaded->mutex);
+    threaded->progress = NULL;
+    threaded->work = NULL;
+    threaded->mutex = NULL;
+}
+
+static b32 tf_threaded_create(TF_RendererBackend *backend, TF_Window *window, const TF_RendererConfig *config) {
+    TF_ThreadedData *threaded = tf_threaded_data(backend);
+    TF_DEBUG("Initializing threaded backend...");
+
+    threaded->window = window;
+    threaded->max_frames_in_flight = config->max_frames_in_flight ? config->max_frames_in_flight
+                                                                  : TF_DEFAULT_FRAMES_IN_FLIGHT;
+    threaded->owns_context = window && config->backend == TF_RENDERER_BACKEND_OPENGL;
+    threaded->mutex = tf_mutex_create();
+    threaded->work = tf_condition_create();
+    threaded->progress = tf_condition_create();
+    if (!threaded->mutex || !threaded->work || !threaded->progress) {
+        TF_ERROR("Failed to create render thread synchronization");
+        threaded->owns_context = TF_FALSE;
+        tf_threaded_shutdown(threaded);
+        return TF_FALSE;
+    }
+
+    // The render thread keeps the context for its whole life
+    if (threaded->owns_context) {
+        tf_window_release_context(window);
+    }
+
+    threaded->running = TF_TRUE;
+    threaded->thread = tf_thread_create(tf_threaded_main, threaded);
+    if (!threaded->thread) {
+        TF_ERROR("Failed to start render thread");
+        tf_threaded_shutdown(threaded);
+        return TF_FALSE;
+    }
+
+    TF_ThreadedCreateCall call = {window, config, TF_FALSE};
+    if (!tf_threaded_call(threaded, tf_threaded_create_call, &call) || !call.result) {
+        TF_ERROR("Failed to initialize backend on the render thread");
+        tf_threaded_shutdown(threaded);
+        return TF_FALSE;
+    }
+
+    TF_INFO("Render thread started (%u packets in flight)", TF_THREADED_PACKETS);
+    return TF_TRUE;
+}
+
+static void tf_threaded_destroy(TF_RendererBackend *backend) {
+    TF_ThreadedData *threaded = tf_threaded_data(backend);
+    if (!threaded->thread) return;
+
+    TF_DEBUG("Stopping render thread...");
+    if (!tf_threaded_call(threaded, tf_threaded_destroy_call, NULL)) {
+        TF_ERROR("Failed to stop render thread");
+        return;
+    }
+    tf_threaded_shutdown(threaded);
+
+    TF_INFO("Render thread stopped");
+}
+
+// =============================================================================
+// Frame and draw submission
+// =============================================================================
+
+// The frame's start on this thread, so latency covers the time it spent queued
+static void tf_threaded_begin_frame(TF_RendererBackend *backend) {
+    f64 *payload = tf_threaded_encode(tf_threaded_data(backend), TF_THREADED_OP_BEGIN_FRAME, sizeof(f64));
+    if (payload) {
+        *payload = tf_time_get_current();
+    }
+}
+
+static void tf_threaded_end_frame(TF_RendererBackend *backend) {
+    tf_threaded_encode(tf_threaded_data(backend), TF_THREADED_OP_END_FRAME, 0);
+}
+
+// Queued frames add latency just like frames queued on the GPU, so they count
+// towards the same limit
+static void tf_threaded_present(TF_RendererBackend *backend) {
+    TF_ThreadedData *threaded = tf_threaded_data(backend);
+    tf_threaded_encode(threaded, TF_THREADED_OP_PRESENT, 0);
+    tf_threaded_publish(threaded);
+
+    u32 submitted = ++threaded->frames_submitted;
+    if (submitted - tf_atomic_load_u32(&threaded->frames_presented) > threaded->max_frames_in_flight) {
+        tf_mutex_lock(threaded->mutex);
+        while (submitted - tf_atomic_load_u32(&threaded->frames_presented) > threaded->max_frames_in_flight) {
+            tf_condition_wait(threaded->progress, threaded->mutex);
+        }
+        tf_mutex_unlock(threaded->mutex);
+    }
+}
+
+static void tf_threaded_clear(TF_RendererBackend *backend, TF_ClearFlags flags) {
+    TF_ClearFlags *payload = tf_threaded_encode(tf_threaded_data(backend), TF_THREADED_OP_CLEAR, sizeof(flags));
+    if (payload) {
+        *payload = flags;
+    }
+}
+
+static void tf_threaded_set_clear_color(TF_RendererBackend *backend, TF_Color color) {
+    TF_Color *payload = tf_threaded_encode(tf_threaded_data(backend), TF_THREADED_OP_SET_CLEAR_COLOR, sizeof(color));
+    if (payload) {
+        *payload = color;
+    }
+}
+
+static void tf_threaded_set_viewport(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height) {
+    TF_ThreadedViewport *payload = tf_threaded_encode(tf_threaded_data(backend), TF_THREADED_OP_SET_VIEWPORT,
+                                                      sizeof(TF_ThreadedViewport));
+    if (payload) {
+        *payload = (TF_ThreadedViewport){x, y, width, height};
+    }
+}
+
+static void tf_threaded_set_camera(TF_RendererBackend *backend, const TF_CameraUniforms *camera) {
+    TF_CameraUniforms *payload = tf_threaded_encode(tf_threaded_data(backend), TF_THREADED_OP_SET_CAMERA,
+                                                    sizeof(TF_CameraUniforms));
+    if (payload) {
+        *payload = *camera;
+    }
+}
+
+static void tf_threaded_draw_triangle(TF_RendererBackend *backend, TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3, TF_Color color) {
+    TF_ThreadedTriangle *payload = tf_threaded_encode(tf_threaded_data(backend), TF_THREADED_OP_DRAW_TRIANGLE,
+                                                      sizeof(TF_ThreadedTriangle));
+    if (payload) {
+        *payload = (TF_ThreadedTriangle){p1, p2, p3, color};
+    }
+}
+
+// Remember a mesh drawn through this backend, so destroying it waits for the render thread
+static void tf_threaded_track_mesh(TF_ThreadedData *threaded, TF_Mesh *mesh) {
+    if (mesh->thread_owner) {
+        return;
+    }
+
+    if (threaded->mesh_count == threaded->mesh_capacity) {
+        u32 capacity = threaded->mesh_capacity ? threaded->mesh_capacity * 2 : 64;
+        TF_Mesh **meshes = realloc(threaded->meshes, sizeof(TF_Mesh *) * capacity);
+        if (!meshes) {
+            TF_ERROR("Failed to grow mesh list");
+            return;
+        }
+        threaded->meshes = meshes;
+        threaded->mesh_capacity = capacity;
+    }
+
+    threaded->meshes[threaded->mesh_count++] = mesh;
+    mesh->thread_owner = &threaded->backend;
+}
+
+static void tf_threaded_draw_meshes(TF_RendererBackend *backend, const TF_MeshDraw *draws, u32 count) {
+    if (!draws || count == 0) return;
+
+    // Instances and ranges are only valid for the call, so they travel in the packet
+    TF_ThreadedData *threaded = tf_threaded_data(backend);
+    u32 instance_count = 0;
+    u32 range_count = 0;
+    for (u32 i = 0; i < count; i++) {
+        instance_count += draws[i].instances ? draws[i].instance_count : 0;
+        range_count += draws[i].ranges ? draws[i].range_count : 0;
+    }
+
+    TF_ThreadedMeshes *payload = tf_threaded_encode(threaded, TF_THREADED_OP_DRAW_MESHES,
+                                                    sizeof(TF_ThreadedMeshes) + sizeof(TF_MeshDraw) * count +
+                                                        sizeof(TF_InstanceData) * instance_count +
+                                                        sizeof(TF_IndexRange) * range_count);
+    if (!payload) return;
+
+    payload->count = count;
+    payload->instance_count = instance_count;
+    payload->range_count = range_count;
+    TF_MeshDraw *copies = (TF_MeshDraw *)(payload + 1);
+    TF_InstanceData *instances = (TF_InstanceData *)(copies + count);
+    TF_IndexRange *ranges = (TF_IndexRange *)(instances + instance_count);
+    for (u32 i = 0; i < count; i++) {
+        u32 copied = draws[i].instances ? draws[i].instance_count : 0;
+        u32 ranges_copied = draws[i].ranges ? draws[i].range_count : 0;
+        copies[i] = (TF_MeshDraw){draws[i].mesh, NULL, copied, NULL, ranges_copied};
+        memcpy(instances, draws[i].instances, sizeof(TF_InstanceData) * copied);
+        memcpy(ranges, draws[i].ranges, sizeof(TF_IndexRange) * ranges_copied);
+        instances += copied;
+        ranges += ranges_copied;
+
+        if (draws[i].mesh) {
+            tf_threaded_track_mesh(threaded, draws[i].mesh);
+        }
+    }
+}
+
+static void tf_threaded_begin_pass(TF_RendererBackend *backend, const char *name) {
+    char *payload = tf_threaded_encode(tf_threaded_data(backend), TF_THREADED_OP_BEGIN_PASS, TF_GPU_PASS_NAME_LENGTH);
+    if (payload) {
+        strncpy(payload, name ? name : "", TF_GPU_PASS_NAME_LENGTH - 1);
+        payload[TF_GPU_PASS_NAME_LENGTH - 1] = '\0';
+    }
+}
+
+static void tf_threaded_end_pass(TF_RendererBackend *backend) {
+    tf_threaded_encode(tf_threaded_data(backend), TF_THREADED_OP_END_PASS, 0);
+}
+
+// =============================================================================
+// Blocking calls
+// =============================================================================
+
+static void tf_threaded_release_mesh_call(TF_ThreadedData *threaded, void *data) {
+    TF_Mesh *mesh = (TF_Mesh *)data;
+    if (threaded->target->release_mesh && mesh->gpu_owner == &threaded->backend) {
+        threaded->target->release_mesh(&threaded->backend, mesh);
+    }
+}
+
+static void tf_threaded_release_mesh(TF_RendererBackend *backend, TF_Mesh *mesh) {
+    TF_ThreadedData *threaded = tf_threaded_data(backend);
+    if (!mesh || mesh->thread_owner != backend) return;
+
+    for (u32 i = 0; i < threaded->mesh_count; i++) {
+        if (threaded->meshes[i] == mesh) {
+            threaded->meshes[i] = threaded->meshes[--threaded->mesh_count];
+            break;
+        }
+    }
+    mesh->thread_owner = NULL;
+
+    // Queued after every draw of the mesh still in flight
+    tf_threaded_call(threaded, tf_threaded_release_mesh_call, mesh);
+}
+
+typedef struct {
+    i32 x, y;
+    u32 width, height;
+    void *pixels;
+    b32 result;
+} TF_ThreadedReadPixelsCall;
+
+static void tf_threaded_read_pixels_call(TF_ThreadedData *threaded, void *data) {
+    TF_ThreadedReadPixelsCall *call = (TF_ThreadedReadPixelsCall *)data;
+    call->result = threaded->target->read_pixels(&threaded->backend, call->x, call->y, call->width, call->height,
+                                                 call->pixels);
+}
+
+static b32 tf_threaded_read_pixels(TF_RendererBackend *backend, i32 x, i32 y, u32 width, u32 height, void *pixels) {
+    TF_ThreadedReadPixelsCall call = {x, y, width, height, pixels, TF_FALSE};
+    tf_threaded_call(tf_threaded_data(backend), tf_threaded_read_pixels_call, &call);
+    return call.result;
+}
+
+typedef struct {
+    u32 *width, *height;
+    u32 ticket;
+    void *pixels;
+    b32 wait;
+    b32 result;
+} TF_ThreadedReadbackCall;
+
+static void tf_threaded_readback_begin_call(TF_ThreadedData *threaded, void *data) {
+    TF_ThreadedReadbackCall *call = (TF_ThreadedReadbackCall *)data;
+    call->ticket = threaded->target->readback_begin(&threaded->backend, call->width, call->height);
+}
+
+static void tf_threaded_readback_end_call(TF_ThreadedData *threaded, void *data) {
+    TF_ThreadedReadbackCall *call = (TF_ThreadedReadbackCall *)data;
+    call->result = threaded->target->readback_end(&threaded->backend, call->ticket, call->pixels, call->wait);
+}
+
+static u32 tf_threaded_readback_begin(TF_RendererBackend *backend, u32 *width, u32 *height) {
+    TF_ThreadedReadbackCall call = {width, height, 0, NULL, TF_FALSE, TF_FALSE};
+    tf_threaded_call(tf_threaded_data(backend), tf_threaded_readback_begin_call, &call);
+    return call.ticket;
+}
+
+static b32 tf_threaded_readback_end(TF_RendererBackend *backend, u32 ticket, void *pixels, b32 wait) {
+    TF_ThreadedReadbackCall call = {NULL, NULL, ticket, pixels, wait, TF_FALSE};
+    tf_threaded_call(tf_threaded_data(backend), tf_threaded_readback_end_call, &call);
+    return call.result;
+}
+
+typedef struct {
+    TF_APICallCount *calls;
+    u32 max_calls;
+    u32 result;
+} TF_ThreadedAPICallsCall;
+
+static void tf_threaded_get_api_calls_call(TF_ThreadedData *threaded, void *data) {
+    TF_ThreadedAPICallsCall *call = (TF_ThreadedAPICallsCall *)data;
+    call->result = threaded->target->get_api_calls(&threaded->backend, call->calls, call->max_calls);
+}
+
+static u32 tf_threaded_get_api_calls(TF_RendererBackend *backend, TF_APICallCount *calls, u32 max_calls) {
+    TF_ThreadedAPICallsCall call = {calls, max_calls, 0};
+    tf_threaded_call(tf_threaded_data(backend), tf_threaded_get_api_calls_call, &call);
+    return call.result;
+}
+
+// =============================================================================
+// Published results
+// =============================================================================
+
+static b32 tf_threaded_get_gpu_timings(TF_RendererBackend *backend, TF_GPUTimings *timings) {
+    TF_ThreadedData *threaded = tf_threaded_data(backend);
+
+    tf_mutex_lock(threaded->mutex);
+    b32 has_timings = threaded->has_gpu_timings;
+    if (has_timings) {
+        *timings = threaded->gpu_timings;
+    }
+    tf_mutex_unlock(threaded->mutex);
+    return has_timings;
+}
+
+static TF_RendererStats tf_threaded_get_stats(TF_RendererBackend *backend) {
+    TF_ThreadedData *threaded = tf_threaded_data(backend);
+
+    tf_mutex_lock(threaded->mutex);
+    TF_RendererStats stats = threaded->stats;
+    tf_mutex_unlock(threaded->mutex);
+    return stats;
+}
@@ -0,0 +1,103 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "tunafish/renderer/camera.h"
+#include "tunafish/core/log.h"
+#include <stdlib.h>
+
+// =============================================================================
+// Camera structure
+// =============================================================================
+
+struct TF_Camera {
+    TF_Vec3 position;
+    TF_Vec3 target;
+    TF_Vec3 up;
+
+    TF_Mat4 view;
+    TF_Mat4 projection;
+    TF_Frustum frustum; // Of projection * view
+};
+
+static void tf_camera_update_view(TF_Camera *camera) {
+    camera->view = tf_mat4_look_at(camera->position, camera->target, camera->up);
+    camera->frustum = tf_frustum_from_matrix(tf_mat4_multiply(camera->projection, camera->view));
+}
+
+// =============================================================================
+// Camera lifecycle
+// =============================================================================
+
+TF_API TF_Camera *tf_camera_create_perspective(f32 fov_degrees, f32 aspect_ratio, f32 near_plane, f32 far_plane) {
+    if (aspect_ratio <= 0.0f || near_plane <= 0.0f || far_plane <= near_plane) {
+        TF_ERROR("Invalid perspective parameters (aspect %.3f, near %.3f, far %.3f)",
+                 aspect_ratio, near_plane, far_plane);
+        return NULL;
+    }
+
+    TF_Camera *camera = malloc(sizeof(TF_Camera));
+    if (!camera) {
+        TF_ERROR("Failed to allocate camera");
+        return NULL;
+    }
+
+    // Default: at the origin looking down -Z
+    camera->position = tf_vec3_create(0.0f, 0.0f, 0.0f);
+    camera->target = tf_vec3_create(0.0f, 0.0f, -1.0f);
+    camera->up = tf_vec3_create(0.0f, 1.0f, 0.0f);
+    camera->projection = tf_mat4_perspective(fov_degrees * TF_DEG_TO_RAD, aspect_ratio, near_plane, far_plane);
+    tf_camera_update_view(camera);
+
+    return camera;
+}
+
+TF_API void tf_camera_destroy(TF_Camera *camera) {
+    free(camera);
+}
+
+// =============================================================================
+// Transform operations
+// =============================================================================
+
+TF_API void tf_camera_set_position(TF_Camera *camera, TF_Vec3 position) {
+    if (!camera) return;
+
+    // Keep the viewing direction, move the target along with the eye
+    TF_Vec3 direction = tf_vec3_sub(camera->target, camera->position);
+    camera->position = position;
+    camera->target = tf_vec3_add(position, direction);
+    tf_camera_update_view(camera);
+}
+
+TF_API void tf_camera_set_look_at(TF_Camera *camera, TF_Vec3 eye, TF_Vec3 target, TF_Vec3 up) {
+    if (!camera) return;
+
+    camera->position = eye;
+    camera->target = target;
+    camera->up = up;
+    tf_camera_update_view(camera);
+}
+
+// =============================================================================
+// Matrix access
+// =============================================================================
+
+TF_API TF_Mat4 tf_camera_get_view_matrix(const TF_Camera *camera) {
+    return camera ? camera->view : tf_mat4_identity();
+}
+
+TF_API TF_Mat4 tf_camera_get_projection_matrix(const TF_Camera *camera) {
+    return camera ? camera->projection : tf_mat4_identity();
+}
+
+TF_API TF_Vec3 tf_camera_get_position(const TF_Camera *camera) {
+    return camera ? camera->position : tf_vec3_create(0.0f, 0.0f, 0.0f);
+}
+
+TF_API TF_Frustum tf_camera_get_frustum(const TF_Camera *camera) {
+    if (!camera) {
+        // Identity view-projection: the clip cube itself
+        return tf_frustum_from_matrix(tf_mat4_identity());
+    }
+    return camera->frustum;
+}
@@ -0,0 +1,434 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "renderer/capture.h"
+#include "tunafish/core/log.h"
+#include "tunafish/platform/thread.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TF_CAPTURE_DEFAULT_FRAME_RATE 60
+#define TF_CAPTURE_PATH_MAX 1024
+
+struct TF_CaptureWriter {
+    TF_CaptureFormat format;
+    char *path;
+    u32 frame_rate;
+    FILE *file;         // Single output file (RAW/Y4M)
+    u32 width, height;  // Size of the first frame; RAW/Y4M streams can't change it
+    u32 frames_written;
+
+    // Frame pool: free frames are a stack, submitted frames a FIFO
+    TF_CaptureFrame frames[TF_CAPTURE_WRITER_FRAMES];
+    u32 free_frames[TF_CAPTURE_WRITER_FRAMES];
+    u32 free_count;
+    u32 queue[TF_CAPTURE_WRITER_FRAMES];
+    u32 queue_head;
+    u32 queue_count;
+    b32 stopping;
+
+    TF_Mutex *mutex;
+    TF_Condition *frame_submitted;
+    TF_Condition *frame_freed;
+    TF_Thread *thread;
+
+    // Encoding scratch, only touched by the writer thread
+    u8 *scratch;
+    usize scratch_capacity;
+};
+
+// =============================================================================
+// Encoding helpers
+// =============================================================================
+
+static u8 *tf_capture_scratch(TF_CaptureWriter *writer, usize size) {
+    if (size > writer->scratch_capacity) {
+        u8 *scratch = realloc(writer->scratch, size);
+        if (!scratch) {
+            TF_ERROR("Failed to allocate %llu bytes of capture scratch", (unsigned long long)size);
+            return NULL;
+        }
+        writer->scratch = scratch;
+        writer->scratch_capacity = size;
+    }
+    return writer->scratch;
+}
+
+static const u8 *tf_capture_row(const TF_CaptureFrame *frame, u32 top_down_row) {
+    return frame->pixels + (usize)(frame->height - 1 - top_down_row) * frame->width * 4;
+}
+
+static void tf_capture_write_raw(TF_CaptureWriter *writer, const TF_CaptureFrame *frame) {
+    for (u32 row = 0; row < frame->height; row++) {
+        fwrite(tf_capture_row(frame, row), 4, frame->width, writer->file);
+    }
+}
+
+// BT.601 limited range, full-resolution chroma (C444)
+static void tf_capture_write_y4m(TF_CaptureWriter *writer, const TF_CaptureFrame *frame) {
+    usize plane = (usize)frame->width * frame->height;
+    u8 *yuv = tf_capture_scratch(writer, plane * 3);
+    if (!yuv) return;
+
+    for (u32 row = 0; row < frame->height; row++) {
+        const u8 *rgba = tf_capture_row(frame, row);
+        usize base = (usize)row * frame->width;
+        for (u32 x = 0; x < frame->width; x++) {
+            i32 r = rgba[x * 4 + 0], g = rgba[x * 4 + 1], b = rgba[x * 4 + 2];
+            yuv[base + x] = (u8)(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+            yuv[plane + base + x] = (u8)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+            yuv[2 * plane + base + x] = (u8)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+        }
+    }
+
+    fputs("FRAME\n", writer->file);
+    fwrite(yuv, 1, plane * 3, writer->file);
+}
+
+static u32 tf_capture_crc32(u32 crc, const u8 *data, usize size) {
+    static u32 table[256];
+    static b32 table_ready = TF_FALSE;
+    if (!table_ready) {
+        for (u32 i = 0; i < 256; i++) {
+            u32 c = i;
+            for (u32 k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            table[i] = c;
+        }
+        table_ready = TF_TRUE;
+    }
+
+    crc = ~crc;
+    for (usize i = 0; i < size; i++) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+// Blocks of 5552 bytes are the most that can be summed before the modulo overflows
+static u32 tf_capture_adler32(u32 adler, const u8 *data, usize size) {
+    u32 a = adler & 0xFFFF, b = adler >> 16;
+    while (size > 0) {
+        usize block = size < 5552 ? size : 5552;
+        size -= block;
+        while (block--) {
+            a += *data++;
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    return (b << 16) | a;
+}
+
+static void tf_capture_put_u32_be(u8 *out, u32 value) {
+    out[0] = (u8)(value >> 24);
+    out[1] = (u8)(value >> 16);
+    out[2] = (u8)(value >> 8);
+    out[3] = (u8)value;
+}
+
+// Chunk payload must start 8 bytes into chunk (after length and type)
+static void tf_capture_write_png_chunk(FILE *file, const char *type, u8 *chunk, u32 length) {
+    tf_capture_put_u32_be(chunk, length);
+    memcpy(chunk + 4, type, 4);
+    tf_capture_put_u32_be(chunk + 8 + length, tf_capture_crc32(0, chunk + 4, (usize)length + 4));
+    fwrite(chunk, 1, (usize)length + 12, file);
+}
+
+// PNG with stored (uncompressed) deflate blocks. Bigger files, but no zlib
+// dependency, and encoding is a copy, so the writer keeps up with the frame rate.
+static void tf_capture_write_png(TF_CaptureWriter *writer, const TF_CaptureFrame *frame) {
+    char path[TF_CAPTURE_PATH_MAX];
+    snprintf(path, sizeof(path), writer->path, writer->frames_written);
+
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        TF_ERROR("Failed to open capture file %s", path);
+        return;
+    }
+
+    usize row_size = (usize)frame->width * 4 + 1;
+    usize raw_size = row_size * frame->height;
+    usize block_count = (raw_size + 65534) / 65535;
+    usize idat_size = 2 + raw_size + block_count * 5 + 4;
+    u8 *chunk = tf_capture_scratch(writer, idat_size + 12);
+    if (!chunk) {
+        fclose(file);
+        return;
+    }
+
+    static const u8 signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    fwrite(signature, 1, sizeof(signature), file);
+
+    u8 header[13 + 12];
+    tf_capture_put_u32_be(header + 8, frame->width);
+    tf_capture_put_u32_be(header + 12, frame->height);
+    header[16] = 8; // Bit depth
+    header[17] = 6; // RGBA
+    header[18] = 0; // Deflate
+    header[19] = 0; // Adaptive filtering
+    header[20] = 0; // No interlace
+    tf_capture_write_png_chunk(file, "IHDR", header, 13);
+
+    // zlib stream: header, stored blocks of filtered rows (filter 0), Adler-32
+    u8 *out = chunk + 8;
+    *out++ = 0x78;
+    *out++ = 0x01;
+    u32 adler = 1;
+    usize remaining = raw_size;
+    u32 row = 0;
+    usize row_offset = 0; // Position inside the current row, 0 = filter byte
+    while (remaining > 0) {
+        u16 block = remaining > 65535 ? 65535 : (u16)remaining;
+        u16 inverse = (u16)~block;
+        remaining -= block;
+        *out++ = remaining == 0 ? 1 : 0;
+        out[0] = (u8)block;
+        out[1] = (u8)(block >> 8);
+        out[2] = (u8)inverse;
+        out[3] = (u8)(inverse >> 8);
+        out += 4;
+
+        usize left = block;
+        while (left > 0) {
+            usize span = 1;
+            if (row_offset == 0) {
+                *out = 0;
+            } else {
+                span = row_size - row_offset < left ? row_size - row_offset : left;
+                memcpy(out, tf_capture_row(frame, row) + row_offset - 1, span);
+            }
+            adler = tf_capture_adler32(adler, out, span);
+            out += span;
+            left -= span;
+            row_offset += span;
+            if (row_offset == row_size) {
+                row_offset = 0;
+                row++;
+            }
+        }
+    }
+    tf_capture_put_u32_be(out, adler);
+    tf_capture_write_png_chunk(file, "IDAT", chunk, (u32)idat_size);
+
+    u8 end[12];
+    tf_capture_write_png_chunk(file, "IEND", end, 0);
+    fclose(file);
+}
+
+// PNG paths must hold exactly one %u conversion (flags/width allowed, %% escapes)
+static b32 tf_capture_pattern_valid(const char *pattern) {
+    u32 conversions = 0;
+    for (const char *c = pattern; *c; c++) {
+        if (*c != '%') continue;
+        c++;
+        if (*c == '%') continue;
+        while (*c == '0' || *c == '-') c++;
+        while (*c >= '0' && *c <= '9') c++;
+        if (*c != 'u') return TF_FALSE;
+        conversions++;
+    }
+    return conversions == 1;
+}
+
+// =============================================================================
+// Writer thread
+// =============================================================================
+
+static void tf_capture_write_frame(TF_CaptureWriter *writer, const TF_CaptureFrame *frame) {
+    if (writer->format == TF_CAPTURE_FORMAT_PNG) {
+        tf_capture_write_png(writer, frame);
+        writer->frames_written++;
+        return;
+    }
+
+    if (writer->frames_written == 0) {
+        writer->width = frame->width;
+        writer->height = frame->height;
+        if (writer->format == TF_CAPTURE_FORMAT_Y4M) {
+            fprintf(writer->file, "YUV4MPEG2 W%u H%u F%u:1 Ip A1:1 C444\n", frame->width, frame->height,
+                    writer->frame_rate);
+        }
+    } else if (frame->width != writer->width || frame->height != writer->height) {
+        TF_WARN("Dropping %ux%u capture frame, the stream is %ux%u", frame->width, frame->height,
+                writer->width, writer->height);
+        return;
+    }
+
+    if (writer->format == TF_CAPTURE_FORMAT_Y4M) {
+        tf_capture_write_y4m(writer, frame);
+    } else {
+        tf_capture_write_raw(writer, frame);
+    }
+    writer->frames_written++;
+}
+
+static void tf_capture_writer_thread(void *user_data) {
+    TF_CaptureWriter *writer = (TF_CaptureWriter *)user_data;
+
+    tf_mutex_lock(writer->mutex);
+    for (;;) {
+        while (writer->queue_count == 0 && !writer->stopping) {
+            tf_condition_wait(writer->frame_submitted, writer->mutex);
+        }
+        if (writer->queue_count == 0) {
+            break;
+        }
+
+        u32 index = writer->queue[writer->queue_head];
+        writer->queue_head = (writer->queue_head + 1) % TF_CAPTURE_WRITER_FRAMES;
+        writer->queue_count--;
+        tf_mutex_unlock(writer->mutex);
+
+        tf_capture_write_frame(writer, &writer->frames[index]);
+
+        tf_mutex_lock(writer->mutex);
+        writer->free_frames[writer->free_count++] = index;
+        tf_condition_signal(writer->frame_freed);
+    }
+    tf_mutex_unlock(writer->mutex);
+}
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+TF_CaptureWriter *tf_capture_writer_create(const TF_CaptureConfig *config) {
+    if (!config || !config->path) {
+        TF_ERROR("Capture needs an output path");
+        return NULL;
+    }
+    if (config->format == TF_CAPTURE_FORMAT_PNG && !tf_capture_pattern_valid(config->path)) {
+        TF_ERROR("PNG capture path '%s' needs exactly one %%u for the frame number", config->path);
+        return NULL;
+    }
+
+    TF_CaptureWriter *writer = calloc(1, sizeof(TF_CaptureWriter));
+    if (!writer) {
+        TF_ERROR("Failed to allocate capture writer");
+        return NULL;
+    }
+
+    // Build the CRC table here, before there is a thread to race with
+    tf_capture_crc32(0, NULL, 0);
+
+    writer->format = config->format;
+    writer->frame_rate = config->frame_rate ? config->frame_rate : TF_CAPTURE_DEFAULT_FRAME_RATE;
+    writer->path = malloc(strlen(config->path) + 1);
+    if (!writer->path) {
+        TF_ERROR("Failed to allocate capture path");
+        tf_capture_writer_destroy(writer);
+        return NULL;
+    }
+    strcpy(writer->path, config->path);
+
+    if (config->format != TF_CAPTURE_FORMAT_PNG) {
+        writer->file = fopen(config->path, "wb");
+        if (!writer->file) {
+            TF_ERROR("Failed to open capture file %s", config->path);
+            tf_capture_writer_destroy(writer);
+            return NULL;
+        }
+    }
+
+    for (u32 i = 0; i < TF_CAPTURE_WRITER_FRAMES; i++) {
+        writer->free_frames[i] = i;
+    }
+    writer->free_count = TF_CAPTURE_WRITER_FRAMES;
+
+    writer->mutex = tf_mutex_create();
+    writer->frame_submitted = tf_condition_create();
+    writer->frame_freed = tf_condition_create();
+    if (!writer->mutex || !writer->frame_submitted || !writer->frame_freed) {
+        tf_capture_writer_destroy(writer);
+        return NULL;
+    }
+
+    writer->thread = tf_thread_create(tf_capture_writer_thread, writer);
+    if (!writer->thread) {
+        tf_capture_writer_destroy(writer);
+        return NULL;
+    }
+
+    TF_INFO("Capturing to %s", config->path);
+    return writer;
+}
+
+// Also used to unwind a partially created writer
+void tf_capture_writer_destroy(TF_CaptureWriter *writer) {
+    if (!writer) return;
+
+    if (writer->thread) {
+        tf_mutex_lock(writer->mutex);
+        writer->stopping = TF_TRUE;
+        tf_condition_signal(writer->frame_submitted);
+        tf_mutex_unlock(writer->mutex);
+        tf_thread_join(writer->thread);
+        TF_INFO("Capture finished: %u frames written to %s", writer->frames_written, writer->path);
+    }
+
+    if (writer->file) {
+        fclose(writer->file);
+    }
+    for (u32 i = 0; i < TF_CAPTURE_WRITER_FRAMES; i++) {
+        free(writer->frames[i].pixels);
+    }
+    tf_condition_destroy(writer->frame_freed);
+    tf_condition_destroy(writer->frame_submitted);
+    tf_mutex_destroy(writer->mutex);
+    free(writer->scratch);
+    free(writer->path);
+    free(writer);
+}
+
+// =============================================================================
+// Frames
+// =============================================================================
+
+TF_CaptureFrame *tf_capture_writer_acquire(TF_CaptureWriter *writer, u32 width, u32 height) {
+    if (!writer) return NULL;
+
+    tf_mutex_lock(writer->mutex);
+    while (writer->free_count == 0) {
+        tf_condition_wait(writer->frame_freed, writer->mutex);
+    }
+    TF_CaptureFrame *frame = &writer->frames[writer->free_frames[--writer->free_count]];
+    tf_mutex_unlock(writer->mutex);
+
+    usize size = (usize)width * height * 4;
+    if (frame->capacity < size) {
+        u8 *pixels = realloc(frame->pixels, size);
+        if (!pixels) {
+            TF_ERROR("Failed to allocate %ux%u capture frame", width, height);
+            tf_capture_writer_release(writer, frame);
+            return NULL;
+        }
+        frame->pixels = pixels;
+        frame->capacity = size;
+    }
+    frame->width = width;
+    frame->height = height;
+    return frame;
+}
+
+void tf_capture_writer_release(TF_CaptureWriter *writer, TF_CaptureFrame *frame) {
+    if (!writer || !frame) return;
+
+    tf_mutex_lock(writer->mutex);
+    writer->free_frames[writer->free_count++] = (u32)(frame - writer->frames);
+    tf_mutex_unlock(writer->mutex);
+}
+
+void tf_capture_writer_submit(TF_CaptureWriter *writer, TF_CaptureFrame *frame) {
+    if (!writer || !frame) return;
+
+    tf_mutex_lock(writer->mutex);
+    u32 tail = (writer->queue_head + writer->queue_count) % TF_CAPTURE_WRITER_FRAMES;
+    writer->queue[tail] = (u32)(frame - writer->frames);
+    writer->queue_count++;
+    tf_condition_signal(writer->frame_submitted);
+    tf_mutex_unlock(writer->mutex);
+}
@@ -0,0 +1,46 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/renderer/renderer_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// Capture writer - encodes and writes captured frames on a background thread
+// =============================================================================
+
+// Frames move through a fixed pool: the renderer acquires a free frame, fills
+// it from a readback and submits it; the writer thread encodes it (rows are
+// flipped to top-down on the way out) and returns it to the pool. Acquire
+// only blocks when the writer has fallen a whole pool behind.
+
+#define TF_CAPTURE_WRITER_FRAMES 8
+
+typedef struct {
+    u8 *pixels; // RGBA8, bottom-up rows
+    usize capacity;
+    u32 width, height;
+} TF_CaptureFrame;
+
+typedef struct TF_CaptureWriter TF_CaptureWriter;
+
+// Opens the output (RAW/Y4M) or validates the file pattern (PNG) and starts the thread
+TF_CaptureWriter *tf_capture_writer_create(const TF_CaptureConfig *config);
+
+// Writes every submitted frame, then joins the thread and closes the output
+void tf_capture_writer_destroy(TF_CaptureWriter *writer);
+
+TF_CaptureFrame *tf_capture_writer_acquire(TF_CaptureWriter *writer, u32 width, u32 height);
+
+// Return a frame that was not filled
+void tf_capture_writer_release(TF_CaptureWriter *writer, TF_CaptureFrame *frame);
+
+void tf_capture_writer_submit(TF_CaptureWriter *writer, TF_CaptureFrame *frame);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,561 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "tunafish/renderer/cluster.h"
+#include "tunafish/renderer/camera.h"
+#include "tunafish/renderer/renderer.h"
+#include "renderer/backend/software/sw_workers.h"
+#include "renderer/mesh_internal.h"
+#include "tunafish/core/log.h"
+#include "tunafish/platform/thread.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Most recent candidates looked at when picking a cluster's next triangle
+#define TF_CLUSTER_CANDIDATE_WINDOW 128
+
+// Unclustered triangles looked at for the nearest one once a cluster has no
+// neighbours left to grow into
+#define TF_CLUSTER_SEED_WINDOW 64
+
+// Clusters whose triangle normals stray further from the average (cosine to
+// it) get no cone; a cone that wide would hardly ever cull
+#define TF_CLUSTER_CONE_MIN_DOT 0.1f
+
+// Clusters per worker task; meshes with fewer than two tasks' worth are
+// culled on the calling thread
+#define TF_CLUSTER_TASK_SIZE 256
+
+typedef enum {
+    TF_CLUSTER_VISIBLE = 0,
+    TF_CLUSTER_CULLED,
+    TF_CLUSTER_BACKFACING
+} TF_ClusterResult;
+
+// A camera seen from a mesh's object space, where the clusters live
+typedef struct {
+    TF_Frustum frustum; // Not normalized, which the box test does not need
+    TF_Vec3 eye;
+    b32 cones; // The transform could be inverted to find the eye
+} TF_ClusterView;
+
+struct TF_ClusterCuller {
+    TF_SWWorkers *workers;
+    u8 *results; // TF_ClusterResult per cluster
+    u32 result_capacity;
+
+    // The pass in flight, read by the tasks
+    const TF_Mesh *mesh;
+    TF_ClusterView view;
+};
+
+// =============================================================================
+// Building
+// =============================================================================
+
+typedef struct {
+    const u32 *indices;
+    TF_Vec3 *positions;        // Per vertex
+    TF_Vec3 *centroids;        // Per triangle
+    u32 *adjacency_offsets;    // Per vertex, into adjacency (vertex_count + 1)
+    u32 *adjacency;            // Triangles around each vertex
+    u32 *vertex_stamps;        // Cluster a vertex was last added to, plus one
+    u32 *candidate_stamps;     // Cluster a triangle was last a candidate for, plus one
+    u8 *emitted;
+    u32 *candidates;
+    u32 candidate_count;
+    u32 *order;                // Triangles in cluster order
+    u32 next_seed;             // No triangle before it is left
+} TF_ClusterBuilder;
+
+static void tf_cluster_builder_free(TF_ClusterBuilder *builder) {
+    free(builder->positions);
+    free(builder->centroids);
+    free(builder->adjacency_offsets);
+    free(builder->adjacency);
+    free(builder->vertex_stamps);
+    free(builder->candidate_stamps);
+    free(builder->emitted);
+    free(builder->candidates);
+    free(builder->order);
+}
+
+static u32 tf_cluster_new_vertices(const TF_ClusterBuilder *builder, u32 triangle, u32 stamp) {
+    const u32 *corners = builder->indices + (usize)triangle * 3;
+    return (builder->vertex_stamps[corners[0]] != stamp) + (builder->vertex_stamps[corners[1]] != stamp) +
+           (builder->vertex_stamps[corners[2]] != stamp);
+}
+
+static f32 tf_cluster_distance_squared(TF_Vec3 a, TF_Vec3 b) {
+    TF_Vec3 d = tf_vec3_sub(a, b);
+    return tf_vec3_dot(d, d);
+}
+
+// Best recent candidate: the fewest vertices new to the cluster, then the
+// nearest to its centroid; ~0u when there is none
+static u32 tf_cluster_pick_candidate(TF_ClusterBuilder *builder, u32 stamp, TF_Vec3 centroid) {
+    while (builder->candidate_count > 0 && builder->emitted[builder->candidates[builder->candidate_count - 1]]) {
+        builder->candidate_count--;
+    }
+
+    u32 best = ~0u;
+    u32 best_new = 4;
+    f32 best_distance = 0.0f;
+    u32 first = builder->candidate_count > TF_CLUSTER_CANDIDATE_WINDOW
+                    ? builder->candidate_count - TF_CLUSTER_CANDIDATE_WINDOW
+                    : 0;
+    for (u32 i = builder->candidate_count; i > first; i--) {
+        u32 triangle = builder->candidates[i - 1];
+        if (builder->emitted[triangle]) {
+            continue;
+        }
+
+        u32 new_vertices = tf_cluster_new_vertices(builder, triangle, stamp);
+        f32 distance = tf_cluster_distance_squared(builder->centroids[triangle], centroid);
+        if (new_vertices < best_new || (new_vertices == best_new && distance < best_distance)) {
+            best = triangle;
+            best_new = new_vertices;
+            best_distance = distance;
+        }
+    }
+    return best;
+}
+
+// Nearest of the next few triangles not in any cluster yet (~0u once all are)
+static u32 tf_cluster_pick_seed(TF_ClusterBuilder *builder, u32 triangle_count, TF_Vec3 centroid) {
+    while (builder->next_seed < triangle_count && builder->emitted[builder->next_seed]) {
+        builder->next_seed++;
+    }
+
+    u32 best = ~0u;
+    f32 best_distance = 0.0f;
+    u32 looked = 0;
+    for (u32 triangle = builder->next_seed; triangle < triangle_count && looked < TF_CLUSTER_SEED_WINDOW;
+         triangle++) {
+        if (builder->emitted[triangle]) {
+            continue;
+        }
+        f32 distance = tf_cluster_distance_squared(builder->centroids[triangle], centroid);
+        if (best == ~0u || distance < best_distance) {
+            best = triangle;
+            best_distance = distance;
+        }
+        looked++;
+    }
+    return best;
+}
+
+static void tf_cluster_add_triangle(TF_ClusterBuilder *builder, u32 triangle, u32 stamp, u32 emitted_count) {
+    builder->emitted[triangle] = 1;
+    builder->order[emitted_count] = triangle;
+
+    const u32 *corners = builder->indices + (usize)triangle * 3;
+    for (u32 i = 0; i < 3; i++) {
+        u32 vertex = corners[i];
+        if (builder->vertex_stamps[vertex] == stamp) {
+            continue;
+        }
+        builder->vertex_stamps[vertex] = stamp;
+
+        // Everything around a new vertex becomes a candidate
+        for (u32 j = builder->adjacency_offsets[vertex]; j < builder->adjacency_offsets[vertex + 1]; j++) {
+            u32 neighbour = builder->adjacency[j];
+            if (!builder->emitted[neighbour] && builder->candidate_stamps[neighbour] != stamp) {
+                builder->candidate_stamps[neighbour] = stamp;
+                builder->candidates[builder->candidate_count++] = neighbour;
+            }
+        }
+    }
+}
+
+// Box and normal cone of the triangles in a cluster
+static void tf_cluster_compute_bounds(TF_MeshCluster *cluster, const u32 *indices, const TF_Vec3 *positions,
+                                      b32 cones) {
+    TF_Vec3 min = positions[indices[cluster->first_index]];
+    TF_Vec3 max = min;
+    for (u32 i = cluster->first_index; i < cluster->first_index + cluster->index_count; i++) {
+        TF_Vec3 p = positions[indices[i]];
+        min = tf_vec3_create(fminf(min.x, p.x), fminf(min.y, p.y), fminf(min.z, p.z));
+        max = tf_vec3_create(fmaxf(max.x, p.x), fmaxf(max.y, p.y), fmaxf(max.z, p.z));
+    }
+    cluster->center = tf_vec3_scale(tf_vec3_add(min, max), 0.5f);
+    cluster->extents = tf_vec3_scale(tf_vec3_sub(max, min), 0.5f);
+    cluster->cone_apex = cluster->center;
+    cluster->cone_axis = tf_vec3_create(0.0f, 0.0f, 0.0f);
+    cluster->cone_cutoff = 2.0f;
+    if (!cones) {
+        return;
+    }
+
+    // Average of the unit normals (counter-clockwise fronts); degenerate
+    // triangles are never drawn, so they do not count
+    TF_Vec3 axis = tf_vec3_create(0.0f, 0.0f, 0.0f);
+    for (u32 i = cluster->first_index; i < cluster->first_index + cluster->index_count; i += 3) {
+        TF_Vec3 p0 = positions[indices[i]];
+        TF_Vec3 normal = tf_vec3_cross(tf_vec3_sub(positions[indices[i + 1]], p0),
+                                       tf_vec3_sub(positions[indices[i + 2]], p0));
+        f32 length = tf_vec3_length(normal);
+        if (length > 0.0f) {
+            axis = tf_vec3_add(axis, tf_vec3_scale(normal, 1.0f / length));
+        }
+    }
+    f32 axis_length = tf_vec3_length(axis);
+    if (axis_length <= 1e-6f) {
+        return;
+    }
+    axis = tf_vec3_scale(axis, 1.0f / axis_length);
+
+    // The cone opens as wide as the normal furthest from the axis, and its
+    // apex sits far enough back that every triangle plane passes in front
+    f32 min_dot = 1.0f;
+    f32 max_t = 0.0f;
+    for (u32 pass = 0; pass < 2; pass++) {
+        for (u32 i = cluster->first_index; i < cluster->first_index + cluster->index_count; i += 3) {
+            TF_Vec3 p0 = positions[indices[i]];
+            TF_Vec3 normal = tf_vec3_cross(tf_vec3_sub(positions[indices[i + 1]], p0),
+                                           tf_vec3_sub(positions[indices[i + 2]], p0));
+            f32 length = tf_vec3_length(normal);
+            if (length <= 0.0f) {
+                continue;
+            }
+            normal = tf_vec3_scale(normal, 1.0f / length);
+            f32 dot = tf_vec3_dot(normal, axis);
+            if (pass == 0) {
+                min_dot = fminf(min_dot, dot);
+            } else {
+                max_t = fmaxf(max_t, tf_vec3_dot(tf_vec3_sub(cluster->center, p0), normal) / dot);
+            }
+        }
+        if (min_dot <= TF_CLUSTER_CONE_MIN_DOT) {
+            return;
+        }
+    }
+
+    cluster->cone_apex = tf_vec3_sub(cluster->center, tf_vec3_scale(axis, max_t));
+    cluster->cone_axis = axis;
+    cluster->cone_cutoff = sqrtf(1.0f - min_dot * min_dot);
+}
+
+TF_API b32 tf_mesh_build_clusters(TF_Mesh *mesh, u32 max_triangles, b32 cull_backfaces) {
+    if (!mesh) {
+        return TF_FALSE;
+    }
+
+    if (max_triangles == 0) {
+        max_triangles = TF_MESH_CLUSTER_DEFAULT_TRIANGLES;
+    }
+    if (max_triangles > TF_MESH_CLUSTER_MAX_TRIANGLES) {
+        TF_ERROR("Clusters hold at most %d triangles, got %u", TF_MESH_CLUSTER_MAX_TRIANGLES, max_triangles);
+        return TF_FALSE;
+    }
+
+    // The GPU copy holds the old triangle order
+    if (mesh->gpu_owner || mesh->thread_owner) {
+        TF_ERROR("Mesh %u was already drawn; build its clusters before the first draw", mesh->id);
+        return TF_FALSE;
+    }
+
+    u32 triangle_count = mesh->index_count / 3;
+    u32 cluster_count = (triangle_count + max_triangles - 1) / max_triangles;
+
+    TF_ClusterBuilder builder = {0};
+    builder.indices = mesh->indices;
+    builder.positions = malloc(sizeof(TF_Vec3) * mesh->vertex_count);
+    builder.centroids = malloc(sizeof(TF_Vec3) * triangle_count);
+    builder.adjacency_offsets = calloc((usize)mesh->vertex_count + 1, sizeof(u32));
+    builder.adjacency = malloc(sizeof(u32) * mesh->index_count);
+    builder.vertex_stamps = calloc(mesh->vertex_count, sizeof(u32));
+    builder.candidate_stamps = calloc(triangle_count, sizeof(u32));
+    builder.emitted = calloc(triangle_count, sizeof(u8));
+    builder.candidates = malloc(sizeof(u32) * mesh->index_count);
+    builder.order = malloc(sizeof(u32) * triangle_count);
+    u32 *indices = malloc(sizeof(u32) * mesh->index_count);
+    TF_MeshCluster *clusters = malloc(sizeof(TF_MeshCluster) * cluster_count);
+    if (!builder.positions || !builder.centroids || !builder.adjacency_offsets || !builder.adjacency ||
+        !builder.vertex_stamps || !builder.candidate_stamps || !builder.emitted || !builder.candidates ||
+        !builder.order || !indices || !clusters) {
+        TF_ERROR("Failed to allocate cluster build data for mesh %u", mesh->id);
+        tf_cluster_builder_free(&builder);
+        free(indices);
+        free(clusters);
+        return TF_FALSE;
+    }
+
+    const TF_VertexElement *element = tf_mesh_find_position(mesh);
+    for (u32 i = 0; i < mesh->vertex_count; i++) {
+        builder.positions[i] = tf_mesh_read_position(mesh, element, i);
+    }
+    for (u32 i = 0; i < triangle_count; i++) {
+        const u32 *corners = mesh->indices + (usize)i * 3;
+        TF_Vec3 sum = tf_vec3_add(tf_vec3_add(builder.positions[corners[0]], builder.positions[corners[1]]),
+                                  builder.positions[corners[2]]);
+        builder.centroids[i] = tf_vec3_scale(sum, 1.0f / 3.0f);
+    }
+
+    // Triangles around each vertex, with vertex_stamps briefly as fill cursors
+    for (u32 i = 0; i < mesh->index_count; i++) {
+        builder.adjacency_offsets[mesh->indices[i] + 1]++;
+    }
+    for (u32 i = 0; i < mesh->vertex_count; i++) {
+        builder.adjacency_offsets[i + 1] += builder.adjacency_offsets[i];
+    }
+    for (u32 i = 0; i < mesh->index_count; i++) {
+        u32 vertex = mesh->indices[i];
+        builder.adjacency[builder.adjacency_offsets[vertex] + builder.vertex_stamps[vertex]++] = i / 3;
+    }
+    memset(builder.vertex_stamps, 0, sizeof(u32) * mesh->vertex_count);
+
+    // Grow each cluster from a seed, always into the neighbour that adds the
+    // fewest vertices, then the nearest. Each seed is the nearest leftover of
+    // the previous cluster, so consecutive clusters tend to touch and their
+    // ranges merge when both survive culling.
+    u32 emitted_count = 0;
+    TF_Vec3 centroid = builder.centroids[0];
+    for (u32 cluster = 0; cluster < cluster_count; cluster++) {
+        u32 stamp = cluster + 1;
+        u32 triangle = tf_cluster_pick_candidate(&builder, stamp, centroid);
+        builder.candidate_count = 0;
+
+        TF_Vec3 sum = tf_vec3_create(0.0f, 0.0f, 0.0f);
+        for (u32 size = 0; size < max_triangles && emitted_count < triangle_count; size++) {
+            if (triangle == ~0u) {
+                triangle = tf_cluster_pick_seed(&builder, triangle_count, centroid);
+            }
+            tf_cluster_add_triangle(&builder, triangle, stamp, emitted_count++);
+            sum = tf_vec3_add(sum, builder.centroids[triangle]);
+            centroid = tf_vec3_scale(sum, 1.0f / (f32)(size + 1));
+            triangle = tf_cluster_pick_candidate(&builder, stamp, centroid);
+        }
+    }
+
+    for (u32 i = 0; i < triangle_count; i++) {
+        memcpy(indices + (usize)i * 3, mesh->indices + (usize)builder.order[i] * 3, sizeof(u32) * 3);
+    }
+    for (u32 i = 0; i < cluster_count; i++) {
+        u32 first = i * max_triangles;
+        u32 count = triangle_count - first < max_triangles ? triangle_count - first : max_triangles;
+        clusters[i].first_index = first * 3;
+        clusters[i].index_count = count * 3;
+        tf_cluster_compute_bounds(&clusters[i], indices, builder.positions, cull_backfaces);
+    }
+    tf_cluster_builder_free(&builder);
+
+    free(mesh->indices);
+    free(mesh->clusters);
+    mesh->indices = indices;
+    mesh->clusters = clusters;
+    mesh->cluster_count = cluster_count;
+
+    TF_DEBUG("Mesh %u split into %u clusters of up to %u triangles", mesh->id, cluster_count, max_triangles);
+
+    // Clustering undid the vertex cache order. The clusters stand either way,
+    // so a failed reorder only costs speed.
+    if (mesh->optimized && !tf_mesh_optimize(mesh, NULL)) {
+        TF_WARN("Mesh %u could not be optimized again after clustering", mesh->id);
+    }
+    return TF_TRUE;
+}
+
+// =============================================================================
+// Culling
+// =============================================================================
+
+// Bring the frustum and eye into the object space of a 3x4 row-major
+// transform. A plane p transforms as p * M, which needs no inverse; the eye
+// does, and without one cones are skipped.
+static void tf_cluster_view_init(TF_ClusterView *view, const f32 *t, const TF_Frustum *frustum, TF_Vec3 eye) {
+    for (u32 i = 0; i < TF_FRUSTUM_PLANE_COUNT; i++) {
+        TF_Vec4 p = frustum->planes[i];
+        view->frustum.planes[i] = (TF_Vec4){p.x * t[0] + p.y * t[4] + p.z * t[8],
+                                            p.x * t[1] + p.y * t[5] + p.z * t[9],
+                                            p.x * t[2] + p.y * t[6] + p.z * t[10],
+                                            p.x * t[3] + p.y * t[7] + p.z * t[11] + p.w};
+    }
+
+    f32 c0 = t[5] * t[10] - t[6] * t[9];
+    f32 c1 = t[6] * t[8] - t[4] * t[10];
+    f32 c2 = t[4] * t[9] - t[5] * t[8];
+    f32 determinant = t[0] * c0 + t[1] * c1 + t[2] * c2;
+    view->cones = fabsf(determinant) > 1e-12f;
+    if (!view->cones) {
+        view->eye = eye;
+        return;
+    }
+
+    // Inverse through the adjugate
+    TF_Vec3 d = tf_vec3_create(eye.x - t[3], eye.y - t[7], eye.z - t[11]);
+    f32 inverse = 1.0f / determinant;
+    view->eye = tf_vec3_create((c0 * d.x + (t[2] * t[9] - t[1] * t[10]) * d.y + (t[1] * t[6] - t[2] * t[5]) * d.z) *
+                                   inverse,
+                               (c1 * d.x + (t[0] * t[10] - t[2] * t[8]) * d.y + (t[2] * t[4] - t[0] * t[6]) * d.z) *
+                                   inverse,
+                               (c2 * d.x + (t[1] * t[8] - t[0] * t[9]) * d.y + (t[0] * t[5] - t[1] * t[4]) * d.z) *
+                                   inverse);
+}
+
+static u8 tf_cluster_classify(const TF_MeshCluster *cluster, const TF_ClusterView *view) {
+    if (!tf_frustum_test_box(&view->frustum, cluster->center, cluster->extents)) {
+        return TF_CLUSTER_CULLED;
+    }
+
+    if (view->cones && cluster->cone_cutoff <= 1.0f) {
+        TF_Vec3 direction = tf_vec3_sub(cluster->cone_apex, view->eye);
+        if (tf_vec3_dot(direction, cluster->cone_axis) >= cluster->cone_cutoff * tf_vec3_length(direction)) {
+            return TF_CLUSTER_BACKFACING;
+        }
+    }
+    return TF_CLUSTER_VISIBLE;
+}
+
+// Append a visible cluster, extending the last range when they touch
+static u32 tf_cluster_emit(const TF_MeshCluster *cluster, TF_IndexRange *ranges, u32 range_count) {
+    if (range_count > 0) {
+        TF_IndexRange *last = &ranges[range_count - 1];
+        if (last->first_index + last->index_count == cluster->first_index) {
+            last->index_count += cluster->index_count;
+            return range_count;
+        }
+    }
+
+    ranges[range_count] = (TF_IndexRange){cluster->first_index, cluster->index_count};
+    return range_count + 1;
+}
+
+static void tf_cluster_cull_task(void *user_data, u32 task) {
+    TF_ClusterCuller *culler = (TF_ClusterCuller *)user_data;
+    u32 first = task * TF_CLUSTER_TASK_SIZE;
+    u32 end = first + TF_CLUSTER_TASK_SIZE;
+    if (end > culler->mesh->cluster_count) {
+        end = culler->mesh->cluster_count;
+    }
+
+    for (u32 i = first; i < end; i++) {
+        culler->results[i] = tf_cluster_classify(&culler->mesh->clusters[i], &culler->view);
+    }
+}
+
+static b32 tf_cluster_culler_reserve(TF_ClusterCuller *culler, u32 count) {
+    if (count <= culler->result_capacity) {
+        return TF_TRUE;
+    }
+
+    u8 *results = realloc(culler->results, count);
+    if (!results) {
+        TF_ERROR("Failed to grow cluster results to %u clusters", count);
+        return TF_FALSE;
+    }
+    culler->results = results;
+    culler->result_capacity = count;
+    return TF_TRUE;
+}
+
+u32 tf_mesh_cull_clusters(const TF_Mesh *mesh, const f32 *transform, const TF_Frustum *frustum, TF_Vec3 eye,
+                          TF_ClusterCuller *culler, TF_IndexRange *ranges, TF_ClusterCounts *counts) {
+    TF_ClusterView view;
+    tf_cluster_view_init(&view, transform, frustum, eye);
+    counts->tested += mesh->cluster_count;
+
+    u32 range_count = 0;
+    if (culler && tf_sw_workers_get_thread_count(culler->workers) > 0 &&
+        mesh->cluster_count >= TF_CLUSTER_TASK_SIZE * 2 && tf_cluster_culler_reserve(culler, mesh->cluster_count)) {
+        culler->mesh = mesh;
+        culler->view = view;
+        tf_sw_workers_run(culler->workers, tf_cluster_cull_task, culler,
+                          (mesh->cluster_count + TF_CLUSTER_TASK_SIZE - 1) / TF_CLUSTER_TASK_SIZE);
+
+        // Merged in order on this thread, so the ranges do not depend on scheduling
+        for (u32 i = 0; i < mesh->cluster_count; i++) {
+            switch (culler->results[i]) {
+                case TF_CLUSTER_VISIBLE:
+                    range_count = tf_cluster_emit(&mesh->clusters[i], ranges, range_count);
+                    break;
+                case TF_CLUSTER_CULLED:
+                    counts->culled++;
+                    break;
+                default:
+                    counts->backfacing++;
+                    break;
+            }
+        }
+        culler->mesh = NULL;
+        return range_count;
+    }
+
+    for (u32 i = 0; i < mesh->cluster_count; i++) {
+        switch (tf_cluster_classify(&mesh->clusters[i], &view)) {
+            case TF_CLUSTER_VISIBLE:
+                range_count = tf_cluster_emit(&mesh->clusters[i], ranges, range_count);
+                break;
+            case TF_CLUSTER_CULLED:
+                counts->culled++;
+                break;
+            default:
+                counts->backfacing++;
+                break;
+        }
+    }
+    return range_count;
+}
+
+// =============================================================================
+// Culler
+// =============================================================================
+
+TF_API TF_ClusterCuller *tf_cluster_culler_create(const TF_ClusterCullerConfig *config) {
+    TF_ClusterCullerConfig defaults = {0};
+    if (!config) {
+        config = &defaults;
+    }
+
+    TF_ClusterCuller *culler = calloc(1, sizeof(TF_ClusterCuller));
+    if (!culler) {
+        TF_ERROR("Failed to allocate cluster culler");
+        return NULL;
+    }
+
+    // The calling thread culls too, so one core is already covered
+    u32 thread_count = config->worker_threads;
+    if (thread_count == 0) {
+        thread_count = tf_thread_get_cpu_count() - 1;
+        if (thread_count > TF_CLUSTER_CULLER_MAX_WORKER_THREADS) {
+            thread_count = TF_CLUSTER_CULLER_MAX_WORKER_THREADS;
+        }
+    }
+    culler->workers = tf_sw_workers_create(thread_count);
+    if (!culler->workers) {
+        free(culler);
+        return NULL;
+    }
+
+    TF_DEBUG("Cluster culler created (%u worker threads)", tf_sw_workers_get_thread_count(culler->workers));
+    return culler;
+}
+
+TF_API void tf_cluster_culler_destroy(TF_ClusterCuller *culler) {
+    if (!culler) {
+        return;
+    }
+
+    tf_sw_workers_destroy(culler->workers);
+    free(culler->results);
+    free(culler);
+}
+
+TF_API u32 tf_cluster_culler_cull(TF_ClusterCuller *culler, const TF_Mesh *mesh, TF_Mat4 transform,
+                                  const TF_Camera *camera, TF_IndexRange *ranges) {
+    if (!mesh || !camera || !ranges) {
+        return 0;
+    }
+
+    if (mesh->cluster_count == 0) {
+        ranges[0] = (TF_IndexRange){0, mesh->index_count};
+        return 1;
+    }
+
+    TF_InstanceData instance = tf_instance_data_create(transform, TF_COLOR_WHITE);
+    TF_Frustum frustum = tf_camera_get_frustum(camera);
+    TF_ClusterCounts counts = {0};
+    return tf_mesh_cull_clusters(mesh, instance.transform, &frustum, tf_camera_get_position(camera), culler, ranges,
+                                 &counts);
+}
@@ -0,0 +1,548 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "renderer/command_buffer.h"
+#include "renderer/mesh_internal.h"
+#include "tunafish/renderer/camera.h"
+#include "tunafish/renderer/material.h"
+#include "tunafish/renderer/occlusion.h"
+#include "tunafish/renderer/renderer.h"
+#include "tunafish/core/log.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// =============================================================================
+// Sort keys
+// =============================================================================
+
+// Quantize a normalized [0, 1] depth into the key's depth field
+static u64 tf_render_key_depth(f32 depth) {
+    depth = tf_clamp(depth, 0.0f, 1.0f);
+    return (u64)(depth * (f32)TF_RENDER_KEY_DEPTH_MASK) & TF_RENDER_KEY_DEPTH_MASK;
+}
+
+static u64 tf_render_key_opaque(u8 layer, u32 shader, u32 material, u32 mesh, f32 depth) {
+    return ((u64)layer << TF_RENDER_KEY_LAYER_SHIFT) |
+           ((u64)TF_RENDER_PASS_OPAQUE << TF_RENDER_KEY_PASS_SHIFT) |
+           (((u64)shader & TF_RENDER_KEY_SHADER_MASK) << TF_RENDER_KEY_SHADER_SHIFT) |
+           (((u64)material & TF_RENDER_KEY_MATERIAL_MASK) << TF_RENDER_KEY_MATERIAL_SHIFT) |
+           (((u64)mesh & TF_RENDER_KEY_MESH_MASK) << TF_RENDER_KEY_MESH_SHIFT) |
+           tf_render_key_depth(depth);
+}
+
+static u64 tf_render_key_overlay(u8 layer, u64 sequence) {
+    return ((u64)layer << TF_RENDER_KEY_LAYER_SHIFT) |
+           ((u64)TF_RENDER_PASS_OVERLAY << TF_RENDER_KEY_PASS_SHIFT) |
+           (sequence & TF_RENDER_KEY_SEQUENCE_MASK);
+}
+
+// =============================================================================
+// Storage
+// =============================================================================
+
+b32 tf_command_buffer_grow(void **array, u32 *capacity, usize element_size, u32 required) {
+    if (required <= *capacity) {
+        return TF_TRUE;
+    }
+
+    u32 new_capacity = *capacity ? *capacity : TF_RENDER_COMMANDS_INITIAL_CAPACITY;
+    while (new_capacity < required) {
+        new_capacity *= 2;
+    }
+
+    void *new_array = realloc(*array, element_size * new_capacity);
+    if (!new_array) {
+        TF_ERROR("Failed to grow renderer command storage to %u entries", new_capacity);
+        return TF_FALSE;
+    }
+
+    *array = new_array;
+    *capacity = new_capacity;
+    return TF_TRUE;
+}
+
+void tf_command_buffer_free(TF_CommandBuffer *buffer) {
+    free(buffer->commands);
+    free(buffer->triangles);
+    free(buffer->meshes);
+    free(buffer->instances);
+    free(buffer->ranges);
+    free(buffer->cull_centers);
+    free(buffer->cull_extents);
+    free(buffer->cull_visible);
+    free(buffer->cull_levels);
+    free(buffer->cull_instances);
+    memset(buffer, 0, sizeof(TF_CommandBuffer));
+}
+
+void tf_command_buffer_clear(TF_CommandBuffer *buffer) {
+    buffer->command_count = 0;
+    buffer->triangle_count = 0;
+    buffer->mesh_count = 0;
+    buffer->instance_count = 0;
+    buffer->range_count = 0;
+}
+
+void tf_command_buffer_reset(TF_CommandBuffer *buffer) {
+    tf_command_buffer_clear(buffer);
+    buffer->sequence = 0;
+    buffer->instances_tested = 0;
+    buffer->instances_culled = 0;
+    buffer->instances_occluded = 0;
+    buffer->instances_lod = 0;
+    buffer->clusters_tested = 0;
+    buffer->clusters_culled = 0;
+    buffer->clusters_backfacing = 0;
+}
+
+// Grow every culling array to count entries. The growth policy is
+// deterministic, so all of them settle on the same capacity.
+static b32 tf_command_buffer_reserve_cull(TF_CommandBuffer *buffer, u32 count) {
+    if (count <= buffer->cull_capacity) {
+        return TF_TRUE;
+    }
+
+    u32 capacity = buffer->cull_capacity;
+    if (!tf_command_buffer_grow((void **)&buffer->cull_centers, &capacity, sizeof(TF_Vec3), count)) {
+        return TF_FALSE;
+    }
+    capacity = buffer->cull_capacity;
+    if (!tf_command_buffer_grow((void **)&buffer->cull_extents, &capacity, sizeof(TF_Vec3), count)) {
+        return TF_FALSE;
+    }
+    capacity = buffer->cull_capacity;
+    if (!tf_command_buffer_grow((void **)&buffer->cull_visible, &capacity, sizeof(u32), count)) {
+        return TF_FALSE;
+    }
+    capacity = buffer->cull_capacity;
+    if (!tf_command_buffer_grow((void **)&buffer->cull_levels, &capacity, sizeof(u8), count)) {
+        return TF_FALSE;
+    }
+    capacity = buffer->cull_capacity;
+    if (!tf_command_buffer_grow((void **)&buffer->cull_instances, &capacity, sizeof(TF_InstanceData), count)) {
+        return TF_FALSE;
+    }
+
+    buffer->cull_capacity = capacity;
+    return TF_TRUE;
+}
+
+// =============================================================================
+// Camera
+// =============================================================================
+
+void tf_command_view_init(TF_CommandView *view, const TF_Camera *camera) {
+    TF_Mat4 projection = tf_camera_get_projection_matrix(camera);
+    view->view = tf_camera_get_view_matrix(camera);
+    view->frustum = tf_camera_get_frustum(camera);
+    view->position = tf_camera_get_position(camera);
+
+    // A sphere of radius r at depth d spans r * m[5] / d of the half height
+    // in NDC, which is r * m[5] / d of the full height in viewport terms
+    view->lod_scale = projection.m[5];
+    view->perspective = projection.m[11] != 0.0f;
+    view->occlusion = NULL;
+    view->cluster_culler = NULL;
+}
+
+// Camera-space distance in front of the camera
+static f32 tf_command_view_distance(const TF_CommandView *view, TF_Vec3 position) {
+    const TF_Mat4 *m = &view->view;
+    return -(m->m[2] * position.x + m->m[6] * position.y + m->m[10] * position.z + m->m[14]);
+}
+
+// =============================================================================
+// Recording
+// =============================================================================
+
+static b32 tf_command_buffer_push(TF_CommandBuffer *buffer, u64 key, TF_RenderCommandType type, u32 index) {
+    if (!tf_command_buffer_grow((void **)&buffer->commands, &buffer->command_capacity,
+                                sizeof(TF_RenderCommand), buffer->command_count + 1)) {
+        return TF_FALSE;
+    }
+
+    buffer->commands[buffer->command_count++] = (TF_RenderCommand){key, type, index};
+    return TF_TRUE;
+}
+
+void tf_command_buffer_draw_triangle(TF_CommandBuffer *buffer, TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3, TF_Color color) {
+    if (!tf_command_buffer_grow((void **)&buffer->triangles, &buffer->triangle_capacity,
+                                sizeof(TF_TriangleCommand), buffer->triangle_count + 1)) {
+        return;
+    }
+
+    // Immediate triangles are drawn without depth testing, so they keep submission order
+    u32 index = buffer->triangle_count;
+    u64 key = tf_render_key_overlay(buffer->layer, buffer->sequence++);
+    if (!tf_command_buffer_push(buffer, key, TF_RENDER_COMMAND_TRIANGLE, index)) {
+        return;
+    }
+
+    buffer->triangles[index] = (TF_TriangleCommand){p1, p2, p3, color};
+    buffer->triangle_count++;
+}
+
+// Camera distance squashed into [0, 1) for the depth field of sort keys
+static f32 tf_command_buffer_view_depth(const TF_CommandView *view, TF_Vec3 position) {
+    if (!view) {
+        return 0.0f;
+    }
+
+    f32 distance = tf_command_view_distance(view, position);
+    if (distance <= 0.0f) {
+        return 0.0f;
+    }
+    return distance / (distance + 1.0f);
+}
+
+// Reserve count instances at the end of the pool (NULL on failure)
+static TF_InstanceData *tf_command_buffer_reserve_instances(TF_CommandBuffer *buffer, u32 count) {
+    if (!tf_command_buffer_grow((void **)&buffer->instances, &buffer->instance_capacity,
+                                sizeof(TF_InstanceData), buffer->instance_count + count)) {
+        return NULL;
+    }
+    return buffer->instances + buffer->instance_count;
+}
+
+// Record a mesh command for the count instances just written at the end of the
+// pool, drawing the range_count ranges just written at the end of the range
+// pool (0 = the whole mesh); the material color is folded in here so the
+// backend only sees instances. On failure nothing is recorded and the
+// instances stay unclaimed.
+static b32 tf_command_buffer_record_command(TF_CommandBuffer *buffer, TF_Mesh *mesh, u32 count,
+                                            const TF_CommandView *view, u32 range_count) {
+    if (!tf_command_buffer_grow((void **)&buffer->meshes, &buffer->mesh_capacity,
+                                sizeof(TF_MeshCommand), buffer->mesh_count + 1)) {
+        return TF_FALSE;
+    }
+
+    TF_InstanceData *instances = buffer->instances + buffer->instance_count;
+    if (buffer->material) {
+        TF_Color tint = tf_material_get_color(buffer->material);
+        for (u32 i = 0; i < count; i++) {
+            instances[i].color.r *= tint.r;
+            instances[i].color.g *= tint.g;
+            instances[i].color.b *= tint.b;
+            instances[i].color.a *= tint.a;
+        }
+    }
+
+    // The whole group shares one sort key, placed at the centroid
+    TF_Vec3 center = tf_vec3_create(0.0f, 0.0f, 0.0f);
+    if (view) {
+        for (u32 i = 0; i < count; i++) {
+            center.x += instances[i].transform[3];
+            center.y += instances[i].transform[7];
+            center.z += instances[i].transform[11];
+        }
+        center = tf_vec3_scale(center, 1.0f / (f32)count);
+    }
+
+    // Group by shader (the backend picks it from the vertex layout), material and mesh, then front-to-back
+    u32 index = buffer->mesh_count;
+    u32 shader = tf_vertex_layout_has(&mesh->layout, TF_VERTEX_ATTRIBUTE_COLOR) ? 1 : 0;
+    f32 depth = tf_command_buffer_view_depth(view, center);
+    u64 key = tf_render_key_opaque(buffer->layer, shader, tf_material_get_id(buffer->material), mesh->id, depth);
+    if (!tf_command_buffer_push(buffer, key, TF_RENDER_COMMAND_MESH, index)) {
+        return TF_FALSE;
+    }
+
+    buffer->meshes[index] = (TF_MeshCommand){mesh, buffer->material, buffer->instance_count, count,
+                                             buffer->range_count, range_count};
+    buffer->mesh_count++;
+    buffer->instance_count += count;
+    buffer->range_count += range_count;
+    return TF_TRUE;
+}
+
+// Cull the clusters of each of the count instances just written at the end of
+// the pool and record it alone with the ranges that survive. Instances with
+// no cluster left are dropped, and once a command fails to record the rest
+// are too.
+static void tf_command_buffer_record_clusters(TF_CommandBuffer *buffer, TF_Mesh *mesh, u32 count,
+                                              const TF_CommandView *view) {
+    for (u32 i = 0; i < count; i++) {
+        if (!tf_command_buffer_grow((void **)&buffer->ranges, &buffer->range_capacity, sizeof(TF_IndexRange),
+                                    buffer->range_count + mesh->cluster_count)) {
+            tf_command_buffer_record_command(buffer, mesh, count - i, view, 0);
+            return;
+        }
+
+        TF_InstanceData *instance = buffer->instances + buffer->instance_count;
+        TF_ClusterCounts counts = {0};
+        u32 range_count = tf_mesh_cull_clusters(mesh, instance->transform, &view->frustum, view->position,
+                                                view->cluster_culler, buffer->ranges + buffer->range_count, &counts);
+        buffer->clusters_tested += counts.tested;
+        buffer->clusters_culled += counts.culled;
+        buffer->clusters_backfacing += counts.backfacing;
+
+        if (range_count > 0) {
+            if (!tf_command_buffer_record_command(buffer, mesh, 1, view, range_count)) {
+                return;
+            }
+        } else {
+            memmove(instance, instance + 1, sizeof(TF_InstanceData) * (count - i - 1));
+        }
+    }
+}
+
+// Record the count instances just written at the end of the pool. The pool
+// only grows past the instances that were recorded, so anything written
+// after these count must be moved down by the caller once some are dropped.
+static void tf_command_buffer_record_mesh(TF_CommandBuffer *buffer, TF_Mesh *mesh, u32 count,
+                                          const TF_CommandView *view) {
+    if (view && mesh->cluster_count > 0) {
+        tf_command_buffer_record_clusters(buffer, mesh, count, view);
+    } else {
+        tf_command_buffer_record_command(buffer, mesh, count, view, 0);
+    }
+}
+
+// Level for an instance whose world-space bounding sphere has radius at center
+static u8 tf_command_buffer_select_lod(const TF_Mesh *mesh, const TF_CommandView *view, TF_Vec3 center,
+                                       f32 radius) {
+    f32 screen_size = radius * view->lod_scale;
+    if (view->perspective) {
+        f32 distance = tf_command_view_distance(view, center);
+        if (distance <= radius) {
+            return 0; // Around or behind the camera: always the full mesh
+        }
+        screen_size /= distance;
+    }
+
+    u8 level = 0;
+    while (level < mesh->lod_count && screen_size < mesh->lod_screen_sizes[level]) {
+        level++;
+    }
+    return level;
+}
+
+// Record the count visible instances at the end of the pool as one command per
+// level of detail, regrouping them by level (keeping their order within one)
+static void tf_command_buffer_record_lods(TF_CommandBuffer *buffer, TF_Mesh *mesh, u32 count,
+                                          const TF_CommandView *view) {
+    TF_InstanceData *instances = buffer->instances + buffer->instance_count;
+    u32 level_counts[TF_MESH_MAX_LODS + 1] = {0};
+    for (u32 i = 0; i < count; i++) {
+        const f32 *t = instances[i].transform;
+        TF_Vec3 center = tf_vec3_create(t[3], t[7], t[11]);
+        center.x += t[0] * mesh->bounds.center.x + t[1] * mesh->bounds.center.y + t[2] * mesh->bounds.center.z;
+        center.y += t[4] * mesh->bounds.center.x + t[5] * mesh->bounds.center.y + t[6] * mesh->bounds.center.z;
+        center.z += t[8] * mesh->bounds.center.x + t[9] * mesh->bounds.center.y + t[10] * mesh->bounds.center.z;
+
+        // The largest axis scale keeps the sphere enclosing under non-uniform scaling
+        f32 scale_x = t[0] * t[0] + t[4] * t[4] + t[8] * t[8];
+        f32 scale_y = t[1] * t[1] + t[5] * t[5] + t[9] * t[9];
+        f32 scale_z = t[2] * t[2] + t[6] * t[6] + t[10] * t[10];
+        f32 radius = mesh->bounds.radius * sqrtf(fmaxf(scale_x, fmaxf(scale_y, scale_z)));
+
+        u8 level = tf_command_buffer_select_lod(mesh, view, center, radius);
+        buffer->cull_levels[i] = level;
+        level_counts[level]++;
+    }
+    buffer->instances_lod += count - level_counts[0];
+
+    // Counting sort by level, unless every instance landed on the same one
+    if (level_counts[buffer->cull_levels[0]] != count) {
+        u32 offsets[TF_MESH_MAX_LODS + 1];
+        u32 offset = 0;
+        for (u32 level = 0; level <= mesh->lod_count; level++) {
+            offsets[level] = offset;
+            offset += level_counts[level];
+        }
+        for (u32 i = 0; i < count; i++) {
+            buffer->cull_instances[offsets[buffer->cull_levels[i]]++] = instances[i];
+        }
+        memcpy(instances, buffer->cull_instances, sizeof(TF_InstanceData) * count);
+    }
+
+    // Each level starts where the previous one's recorded instances end, which
+    // is short of where it was written whenever that level dropped some
+    u32 source = buffer->instance_count;
+    u32 remaining = count;
+    for (u32 level = 0; level <= mesh->lod_count; level++) {
+        if (level_counts[level] == 0) {
+            continue;
+        }
+        if (source != buffer->instance_count) {
+            memmove(buffer->instances + buffer->instance_count, buffer->instances + source,
+                    sizeof(TF_InstanceData) * remaining);
+        }
+        source = buffer->instance_count + level_counts[level];
+        remaining -= level_counts[level];
+        tf_command_buffer_record_mesh(buffer, level ? mesh->lods[level - 1] : mesh, level_counts[level], view);
+    }
+}
+
+// Cull the count instances just written at the end of the pool, then record
+// the survivors
+static void tf_command_buffer_record_instances(TF_CommandBuffer *buffer, TF_Mesh *mesh, u32 count,
+                                               const TF_CommandView *view) {
+    // Without scratch space everything is drawn, as without a camera
+    if (!view || !tf_command_buffer_reserve_cull(buffer, count)) {
+        tf_command_buffer_record_mesh(buffer, mesh, count, view);
+        return;
+    }
+
+    // World-space boxes: the transformed center, and the extents projected on
+    // each world axis through the absolute rotation-scale part
+    TF_InstanceData *instances = buffer->instances + buffer->instance_count;
+    TF_Vec3 c = mesh->bounds.center;
+    TF_Vec3 e = mesh->bounds.extents;
+    for (u32 i = 0; i < count; i++) {
+        const f32 *t = instances[i].transform;
+        buffer->cull_centers[i] = tf_vec3_create(t[0] * c.x + t[1] * c.y + t[2] * c.z + t[3],
+                                                 t[4] * c.x + t[5] * c.y + t[6] * c.z + t[7],
+                                                 t[8] * c.x + t[9] * c.y + t[10] * c.z + t[11]);
+        buffer->cull_extents[i] = tf_vec3_create(fabsf(t[0]) * e.x + fabsf(t[1]) * e.y + fabsf(t[2]) * e.z,
+                                                 fabsf(t[4]) * e.x + fabsf(t[5]) * e.y + fabsf(t[6]) * e.z,
+                                                 fabsf(t[8]) * e.x + fabsf(t[9]) * e.y + fabsf(t[10]) * e.z);
+    }
+
+    u32 visible = tf_frustum_cull_boxes(&view->frustum, buffer->cull_centers, buffer->cull_extents, count,
+                                        buffer->cull_visible);
+    buffer->instances_tested += count;
+    buffer->instances_culled += count - visible;
+
+    if (view->occlusion) {
+        u32 unoccluded = 0;
+        for (u32 i = 0; i < visible; i++) {
+            u32 index = buffer->cull_visible[i];
+            if (tf_occlusion_buffer_test_box(view->occlusion, buffer->cull_centers[index],
+                                             buffer->cull_extents[index])) {
+                buffer->cull_visible[unoccluded++] = index;
+            }
+        }
+        buffer->instances_occluded += visible - unoccluded;
+        visible = unoccluded;
+    }
+    if (visible == 0) {
+        return;
+    }
+
+    // Survivors move to the front in order; indices ascend, so none is
+    // overwritten before it has moved
+    if (visible < count) {
+        for (u32 i = 0; i < visible; i++) {
+            instances[i] = instances[buffer->cull_visible[i]];
+        }
+    }
+
+    if (mesh->lod_count > 0) {
+        tf_command_buffer_record_lods(buffer, mesh, visible, view);
+    } else {
+        tf_command_buffer_record_mesh(buffer, mesh, visible, view);
+    }
+}
+
+void tf_command_buffer_draw_mesh(TF_CommandBuffer *buffer, TF_Mesh *mesh, TF_Mat4 transform,
+                                 const TF_CommandView *view) {
+    TF_InstanceData *instance = tf_command_buffer_reserve_instances(buffer, 1);
+    if (!instance) {
+        return;
+    }
+
+    *instance = tf_instance_data_create(transform, TF_COLOR_WHITE);
+    tf_command_buffer_record_instances(buffer, mesh, 1, view);
+}
+
+void tf_command_buffer_draw_mesh_instanced(TF_CommandBuffer *buffer, TF_Mesh *mesh, const TF_Mat4 *transforms,
+                                           const TF_Color *colors, u32 count, const TF_CommandView *view) {
+    TF_InstanceData *instances = tf_command_buffer_reserve_instances(buffer, count);
+    if (!instances) {
+        return;
+    }
+
+    for (u32 i = 0; i < count; i++) {
+        instances[i] = tf_instance_data_create(transforms[i], colors ? colors[i] : TF_COLOR_WHITE);
+    }
+    tf_command_buffer_record_instances(buffer, mesh, count, view);
+}
+
+void tf_command_buffer_draw_mesh_instances(TF_CommandBuffer *buffer, TF_Mesh *mesh, const TF_InstanceData *instances,
+                                           u32 count, const TF_CommandView *view) {
+    TF_InstanceData *pool = tf_command_buffer_reserve_instances(buffer, count);
+    if (!pool) {
+        return;
+    }
+
+    memcpy(pool, instances, sizeof(TF_InstanceData) * count);
+    tf_command_buffer_record_instances(buffer, mesh, count, view);
+}
+
+// =============================================================================
+// Merging
+// =============================================================================
+
+b32 tf_command_buffer_append(TF_CommandBuffer *destination, const TF_CommandBuffer *source) {
+    if (source->command_count == 0) {
+        return TF_TRUE;
+    }
+
+    // Reserve everything first so a failure leaves destination untouched
+    if (!tf_command_buffer_grow((void **)&destination->commands, &destination->command_capacity,
+                                sizeof(TF_RenderCommand), destination->command_count + source->command_count) ||
+        !tf_command_buffer_grow((void **)&destination->triangles, &destination->triangle_capacity,
+                                sizeof(TF_TriangleCommand), destination->triangle_count + source->triangle_count) ||
+        !tf_command_buffer_grow((void **)&destination->meshes, &destination->mesh_capacity,
+                                sizeof(TF_MeshCommand), destination->mesh_count + source->mesh_count) ||
+        !tf_command_buffer_grow((void **)&destination->instances, &destination->instance_capacity,
+                                sizeof(TF_InstanceData), destination->instance_count + source->instance_count) ||
+        !tf_command_buffer_grow((void **)&destination->ranges, &destination->range_capacity,
+                                sizeof(TF_IndexRange), destination->range_count + source->range_count)) {
+        return TF_FALSE;
+    }
+
+    memcpy(destination->triangles + destination->triangle_count, source->triangles,
+           sizeof(TF_TriangleCommand) * source->triangle_count);
+    memcpy(destination->instances + destination->instance_count, source->instances,
+           sizeof(TF_InstanceData) * source->instance_count);
+    memcpy(destination->ranges + destination->range_count, source->ranges,
+           sizeof(TF_IndexRange) * source->range_count);
+
+    TF_MeshCommand *meshes = destination->meshes + destination->mesh_count;
+    for (u32 i = 0; i < source->mesh_count; i++) {
+        meshes[i] = source->meshes[i];
+        meshes[i].first_instance += destination->instance_count;
+        meshes[i].first_range += destination->range_count;
+    }
+
+    TF_RenderCommand *commands = destination->commands + destination->command_count;
+    for (u32 i = 0; i < source->command_count; i++) {
+        TF_RenderCommand command = source->commands[i];
+        switch (command.type) {
+            case TF_RENDER_COMMAND_TRIANGLE:
+                command.index += destination->triangle_count;
+                break;
+            case TF_RENDER_COMMAND_MESH:
+                command.index += destination->mesh_count;
+                break;
+            default:
+                break;
+        }
+
+        // Overlay draws carry on from the destination's sequence, keeping
+        // everything in submission order; other keys do not depend on it
+        if (((command.key >> TF_RENDER_KEY_PASS_SHIFT) & TF_RENDER_KEY_PASS_MASK) == TF_RENDER_PASS_OVERLAY) {
+            u64 sequence = (command.key + destination->sequence) & TF_RENDER_KEY_SEQUENCE_MASK;
+            command.key = (command.key & ~TF_RENDER_KEY_SEQUENCE_MASK) | sequence;
+        }
+        commands[i] = command;
+    }
+
+    destination->command_count += source->command_count;
+    destination->triangle_count += source->triangle_count;
+    destination->mesh_count += source->mesh_count;
+    destination->instance_count += source->instance_count;
+    destination->range_count += source->range_count;
+    destination->sequence += source->sequence;
+    destination->instances_tested += source->instances_tested;
+    destination->instances_culled += source->instances_culled;
+    destination->instances_occluded += source->instances_occluded;
+    destination->instances_lod += source->instances_lod;
+    destination->clusters_tested += source->clusters_tested;
+    destination->clusters_culled += source->clusters_culled;
+    destination->clusters_backfacing += source->clusters_backfacing;
+    return TF_TRUE;
+}
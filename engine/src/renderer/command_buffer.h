@@ -0,0 +1,202 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/core/types.h"
+#include "tunafish/core/math.h"
+#include "tunafish/renderer/renderer_types.h"
+#include "tunafish/renderer/frustum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Forward declarations
+typedef struct TF_Mesh TF_Mesh;
+typedef struct TF_Material TF_Material;
+typedef struct TF_Camera TF_Camera;
+typedef struct TF_OcclusionBuffer TF_OcclusionBuffer;
+typedef struct TF_ClusterCuller TF_ClusterCuller;
+
+// =============================================================================
+// Command buffer
+// =============================================================================
+
+// Draws are recorded as compact commands and replayed at end_frame (or before a
+// clear) in sort-key order, so state changes can be grouped regardless of the
+// order game code submits in.
+//
+// Sort key layout (most significant bits first):
+//
+//   opaque:      | layer (8) | pass (2) | shader (8) | material (14) | mesh (16) | depth (16) |
+//   overlay:     | layer (8) | pass (2) |                   sequence (54)                    |
+//
+// Opaque draws are grouped by state and then sorted front-to-back to cut
+// overdraw; overlay draws (immediate triangles, drawn without depth testing)
+// keep their submission order.
+// Because the mesh sits above depth, every draw of one mesh with one material
+// ends up adjacent after sorting and is replayed as a single instanced draw.
+// Material and mesh ids wrap at 16384 and 65536 in the key. Ids that alias
+// only interleave their draws and so cost merges; replay compares the mesh
+// and material themselves, so it never merges different ones.
+//
+// The renderer records into one buffer directly. Command lists are further
+// buffers filled on other threads and appended to the renderer's at submit;
+// recording touches nothing outside the buffer, so each needs no locking.
+//
+// With a camera, mesh instances are culled as they are recorded: each draw's
+// instances get world-space boxes, tested against the frustum in SIMD
+// batches, and the survivors are split by level of detail, one command per
+// level. Instances of clustered meshes then have their clusters culled and
+// are recorded one per command, with the index ranges that survived. Culling
+// thus runs on whichever thread records, workers included.
+
+#define TF_RENDER_KEY_LAYER_SHIFT    56
+#define TF_RENDER_KEY_PASS_SHIFT     54
+#define TF_RENDER_KEY_SHADER_SHIFT   46
+#define TF_RENDER_KEY_MATERIAL_SHIFT 32
+#define TF_RENDER_KEY_MESH_SHIFT     16
+#define TF_RENDER_KEY_PASS_MASK      0x3ull
+#define TF_RENDER_KEY_SHADER_MASK    0xFFull
+#define TF_RENDER_KEY_MATERIAL_MASK  0x3FFFull
+#define TF_RENDER_KEY_MESH_MASK      0xFFFFull
+#define TF_RENDER_KEY_DEPTH_MASK     0xFFFFull
+#define TF_RENDER_KEY_SEQUENCE_MASK  0x3FFFFFFFFFFFFFull
+
+#define TF_RENDER_COMMANDS_INITIAL_CAPACITY 1024
+
+typedef enum {
+    TF_RENDER_PASS_OPAQUE = 0,
+    TF_RENDER_PASS_OVERLAY = 1
+} TF_RenderPass;
+
+typedef enum {
+    TF_RENDER_COMMAND_TRIANGLE = 0,
+    TF_RENDER_COMMAND_MESH
+} TF_RenderCommandType;
+
+typedef struct {
+    u64 key;
+    u32 type;
+    u32 index; // Payload index for the command type
+} TF_RenderCommand;
+
+typedef struct {
+    TF_Vec3 p1, p2, p3;
+    TF_Color color;
+} TF_TriangleCommand;
+
+// Instances live in the buffer's instance pool, ranges in its range pool
+typedef struct {
+    TF_Mesh *mesh;
+    TF_Material *material;
+    u32 first_instance;
+    u32 instance_count;
+    u32 first_range;
+    u32 range_count; // 0 = the whole mesh
+} TF_MeshCommand;
+
+// What recording needs from the camera: the view for depth sort keys, the
+// frustum and position for culling and the projection's scale for picking LODs
+typedef struct {
+    TF_Mat4 view;
+    TF_Frustum frustum;
+    TF_Vec3 position;
+    f32 lod_scale;   // Viewport height fraction covered by a unit radius at unit depth
+    b32 perspective; // Screen size falls off with depth
+    const TF_OcclusionBuffer *occlusion; // Tested after the frustum (NULL = none)
+    TF_ClusterCuller *cluster_culler;    // Spreads cluster culling over workers (NULL = recording thread)
+} TF_CommandView;
+
+// Occlusion and the cluster culler start out unset
+void tf_command_view_init(TF_CommandView *view, const TF_Camera *camera);
+
+// Recorded commands, their payloads and the recording state. Storage grows to
+// the high-water mark and is kept across resets, so steady-state recording
+// does not allocate.
+typedef struct {
+    TF_RenderCommand *commands;
+    u32 command_count;
+    u32 command_capacity;
+
+    TF_TriangleCommand *triangles;
+    u32 triangle_count;
+    u32 triangle_capacity;
+    TF_MeshCommand *meshes;
+    u32 mesh_count;
+    u32 mesh_capacity;
+    TF_InstanceData *instances;
+    u32 instance_count;
+    u32 instance_capacity;
+    TF_IndexRange *ranges;
+    u32 range_count;
+    u32 range_capacity;
+
+    // Culling scratch, sized to the largest draw so far
+    TF_Vec3 *cull_centers;
+    TF_Vec3 *cull_extents;
+    u32 *cull_visible;
+    u8 *cull_levels;
+    TF_InstanceData *cull_instances; // Visible instances grouped by level
+    u32 cull_capacity;
+
+    TF_Material *material;
+    u8 layer;
+    u64 sequence; // Overlay draws recorded so far
+
+    // Culling results since the last reset
+    u32 instances_tested;
+    u32 instances_culled;
+    u32 instances_occluded;
+    u32 instances_lod; // Drawn with a coarser level than the mesh itself
+    u32 clusters_tested;
+    u32 clusters_culled;
+    u32 clusters_backfacing;
+} TF_CommandBuffer;
+
+// Grow array to hold at least required elements (doubling from the initial capacity)
+b32 tf_command_buffer_grow(void **array, u32 *capacity, usize element_size, u32 required);
+
+void tf_command_buffer_free(TF_CommandBuffer *buffer);
+
+// Drop recorded commands, keeping storage and the layer/material state
+void tf_command_buffer_clear(TF_CommandBuffer *buffer);
+
+// Clear, and restart the overlay sequence and culling counters for a new frame
+void tf_command_buffer_reset(TF_CommandBuffer *buffer);
+
+// Recording. view comes from the camera (NULL = no camera: unsorted, nothing culled).
+void tf_command_buffer_draw_triangle(TF_CommandBuffer *buffer, TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3, TF_Color color);
+
+void tf_command_buffer_draw_mesh(TF_CommandBuffer *buffer, TF_Mesh *mesh, TF_Mat4 transform,
+                                 const TF_CommandView *view);
+
+void tf_command_buffer_draw_mesh_instanced(TF_CommandBuffer *buffer, TF_Mesh *mesh, const TF_Mat4 *transforms,
+                                           const TF_Color *colors, u32 count, const TF_CommandView *view);
+
+void tf_command_buffer_draw_mesh_instances(TF_CommandBuffer *buffer, TF_Mesh *mesh, const TF_InstanceData *instances,
+                                           u32 count, const TF_CommandView *view);
+
+// Append everything recorded in source after what destination holds, as if it
+// had been recorded there: payload indices are rebased, overlay draws
+// continue destination's sequence and culling counters add up
+b32 tf_command_buffer_append(TF_CommandBuffer *destination, const TF_CommandBuffer *source);
+
+// =============================================================================
+// Command lists
+// =============================================================================
+
+// Public handle around a buffer, see tunafish/renderer/command_list.h
+struct TF_CommandList {
+    TF_CommandBuffer buffer;
+    TF_CommandView view; // Captured at begin for sorting and culling
+    b32 has_view;
+    const TF_OcclusionBuffer *occlusion; // Kept across begins
+    TF_ClusterCuller *cluster_culler;    // Kept across begins
+    TF_Frustum camera_frustum; // The begin camera's, restored by set_frustum(NULL)
+};
+
+#ifdef __cplusplus
+}
+#endif
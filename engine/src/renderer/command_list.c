@@ -0,0 +1,134 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "tunafish/renderer/command_list.h"
+#include "tunafish/renderer/camera.h"
+#include "renderer/command_buffer.h"
+#include "tunafish/core/log.h"
+#include <stdlib.h>
+
+// =============================================================================
+// Command list lifecycle
+// =============================================================================
+
+TF_CommandList *tf_command_list_create(void) {
+    TF_CommandList *list = calloc(1, sizeof(TF_CommandList));
+    if (!list) {
+        TF_ERROR("Failed to allocate command list");
+        return NULL;
+    }
+    return list;
+}
+
+void tf_command_list_destroy(TF_CommandList *list) {
+    if (!list) {
+        return;
+    }
+
+    tf_command_buffer_free(&list->buffer);
+    free(list);
+}
+
+void tf_command_list_begin(TF_CommandList *list, TF_Camera *camera) {
+    if (!list) {
+        return;
+    }
+
+    tf_command_buffer_reset(&list->buffer);
+    list->buffer.layer = 0;
+    list->buffer.material = NULL;
+
+    // Captured once so recording never touches the camera
+    list->has_view = camera != NULL;
+    if (camera) {
+        tf_command_view_init(&list->view, camera);
+        list->view.occlusion = list->occlusion;
+        list->view.cluster_culler = list->cluster_culler;
+        list->camera_frustum = list->view.frustum;
+    }
+}
+
+void tf_command_list_set_occlusion(TF_CommandList *list, const TF_OcclusionBuffer *occlusion) {
+    if (!list) {
+        return;
+    }
+
+    list->occlusion = occlusion;
+    list->view.occlusion = occlusion;
+}
+
+void tf_command_list_set_cluster_culler(TF_CommandList *list, TF_ClusterCuller *culler) {
+    if (!list) {
+        return;
+    }
+
+    list->cluster_culler = culler;
+    list->view.cluster_culler = culler;
+}
+
+void tf_command_list_set_frustum(TF_CommandList *list, const TF_Frustum *frustum) {
+    if (!list) {
+        return;
+    }
+
+    list->view.frustum = frustum ? *frustum : list->camera_frustum;
+}
+
+void tf_command_list_set_layer(TF_CommandList *list, u8 layer) {
+    if (!list) {
+        return;
+    }
+
+    list->buffer.layer = layer;
+}
+
+void tf_command_list_set_material(TF_CommandList *list, TF_Material *material) {
+    if (!list) {
+        return;
+    }
+
+    list->buffer.material = material;
+}
+
+// =============================================================================
+// Recording
+// =============================================================================
+
+void tf_command_list_draw_triangle(TF_CommandList *list, TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3, TF_Color color) {
+    if (!list) {
+        return;
+    }
+
+    tf_command_buffer_draw_triangle(&list->buffer, p1, p2, p3, color);
+}
+
+void tf_command_list_draw_mesh(TF_CommandList *list, TF_Mesh *mesh, TF_Mat4 transform) {
+    if (!list || !mesh) {
+        return;
+    }
+
+    tf_command_buffer_draw_mesh(&list->buffer, mesh, transform, list->has_view ? &list->view : NULL);
+}
+
+void tf_command_list_draw_mesh_instanced(TF_CommandList *list, TF_Mesh *mesh, const TF_Mat4 *transforms,
+                                         const TF_Color *colors, u32 count) {
+    if (!list || !mesh || !transforms || count == 0) {
+        return;
+    }
+
+    tf_command_buffer_draw_mesh_instanced(&list->buffer, mesh, transforms, colors, count,
+                                          list->has_view ? &list->view : NULL);
+}
+
+void tf_command_list_draw_mesh_instances(TF_CommandList *list, TF_Mesh *mesh, const TF_InstanceData *instances,
+                                         u32 count) {
+    if (!list || !mesh || !instances || count == 0) {
+        return;
+    }
+
+    tf_command_buffer_draw_mesh_instances(&list->buffer, mesh, instances, count, list->has_view ? &list->view : NULL);
+}
+
+u32 tf_command_list_get_command_count(const TF_CommandList *list) {
+    return list ? list->buffer.command_count : 0;
+}
@@ -0,0 +1,148 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "tunafish/renderer/frustum.h"
+#include <math.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define TF_FRUSTUM_SSE2 1
+#include <emmintrin.h>
+#else
+#define TF_FRUSTUM_SSE2 0
+#endif
+
+// =============================================================================
+// Plane extraction
+// =============================================================================
+
+// Row of a column-major matrix
+static TF_Vec4 tf_frustum_matrix_row(const TF_Mat4 *m, u32 row) {
+    return (TF_Vec4){m->m[row], m->m[4 + row], m->m[8 + row], m->m[12 + row]};
+}
+
+static TF_Vec4 tf_frustum_normalize(TF_Vec4 plane) {
+    f32 length = sqrtf(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+    return length > 0.0f ? tf_vec4_scale(plane, 1.0f / length) : plane;
+}
+
+// Gribb/Hartmann: a clip-space point is inside when -w <= x, y, z <= w, so
+// each plane is the w row plus or minus one of the others
+TF_API TF_Frustum tf_frustum_from_matrix(TF_Mat4 view_projection) {
+    TF_Vec4 x = tf_frustum_matrix_row(&view_projection, 0);
+    TF_Vec4 y = tf_frustum_matrix_row(&view_projection, 1);
+    TF_Vec4 z = tf_frustum_matrix_row(&view_projection, 2);
+    TF_Vec4 w = tf_frustum_matrix_row(&view_projection, 3);
+
+    TF_Frustum frustum;
+    frustum.planes[TF_FRUSTUM_LEFT] = tf_frustum_normalize(tf_vec4_add(w, x));
+    frustum.planes[TF_FRUSTUM_RIGHT] = tf_frustum_normalize(tf_vec4_sub(w, x));
+    frustum.planes[TF_FRUSTUM_BOTTOM] = tf_frustum_normalize(tf_vec4_add(w, y));
+    frustum.planes[TF_FRUSTUM_TOP] = tf_frustum_normalize(tf_vec4_sub(w, y));
+    frustum.planes[TF_FRUSTUM_NEAR] = tf_frustum_normalize(tf_vec4_add(w, z));
+    frustum.planes[TF_FRUSTUM_FAR] = tf_frustum_normalize(tf_vec4_sub(w, z));
+    return frustum;
+}
+
+// =============================================================================
+// Single tests
+// =============================================================================
+
+TF_API b32 tf_frustum_test_box(const TF_Frustum *frustum, TF_Vec3 center, TF_Vec3 extents) {
+    for (u32 i = 0; i < TF_FRUSTUM_PLANE_COUNT; i++) {
+        TF_Vec4 p = frustum->planes[i];
+        f32 distance = p.x * center.x + p.y * center.y + p.z * center.z + p.w;
+        f32 reach = fabsf(p.x) * extents.x + fabsf(p.y) * extents.y + fabsf(p.z) * extents.z;
+        if (distance + reach < 0.0f) {
+            return TF_FALSE;
+        }
+    }
+    return TF_TRUE;
+}
+
+TF_API b32 tf_frustum_test_sphere(const TF_Frustum *frustum, TF_Vec3 center, f32 radius) {
+    for (u32 i = 0; i < TF_FRUSTUM_PLANE_COUNT; i++) {
+        TF_Vec4 p = frustum->planes[i];
+        if (p.x * center.x + p.y * center.y + p.z * center.z + p.w < -radius) {
+            return TF_FALSE;
+        }
+    }
+    return TF_TRUE;
+}
+
+// =============================================================================
+// Batch culling
+// =============================================================================
+
+#if TF_FRUSTUM_SSE2
+
+// Four boxes per iteration in structure-of-arrays form, each plane splatted
+// across the lanes. A box is out once its center is further behind any plane
+// than the extents reach, so the six planes reduce to one mask.
+TF_API u32 tf_frustum_cull_boxes(const TF_Frustum *frustum, const TF_Vec3 *centers, const TF_Vec3 *extents,
+                                 u32 count, u32 *visible) {
+    __m128 plane_x[TF_FRUSTUM_PLANE_COUNT], plane_y[TF_FRUSTUM_PLANE_COUNT];
+    __m128 plane_z[TF_FRUSTUM_PLANE_COUNT], plane_w[TF_FRUSTUM_PLANE_COUNT];
+    __m128 abs_x[TF_FRUSTUM_PLANE_COUNT], abs_y[TF_FRUSTUM_PLANE_COUNT], abs_z[TF_FRUSTUM_PLANE_COUNT];
+    for (u32 i = 0; i < TF_FRUSTUM_PLANE_COUNT; i++) {
+        TF_Vec4 p = frustum->planes[i];
+        plane_x[i] = _mm_set1_ps(p.x);
+        plane_y[i] = _mm_set1_ps(p.y);
+        plane_z[i] = _mm_set1_ps(p.z);
+        plane_w[i] = _mm_set1_ps(p.w);
+        abs_x[i] = _mm_set1_ps(fabsf(p.x));
+        abs_y[i] = _mm_set1_ps(fabsf(p.y));
+        abs_z[i] = _mm_set1_ps(fabsf(p.z));
+    }
+
+    const __m128 zero = _mm_setzero_ps();
+    u32 visible_count = 0;
+    u32 i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const TF_Vec3 *c = centers + i;
+        const TF_Vec3 *e = extents + i;
+        __m128 cx = _mm_set_ps(c[3].x, c[2].x, c[1].x, c[0].x);
+        __m128 cy = _mm_set_ps(c[3].y, c[2].y, c[1].y, c[0].y);
+        __m128 cz = _mm_set_ps(c[3].z, c[2].z, c[1].z, c[0].z);
+        __m128 ex = _mm_set_ps(e[3].x, e[2].x, e[1].x, e[0].x);
+        __m128 ey = _mm_set_ps(e[3].y, e[2].y, e[1].y, e[0].y);
+        __m128 ez = _mm_set_ps(e[3].z, e[2].z, e[1].z, e[0].z);
+
+        __m128 outside = zero;
+        for (u32 p = 0; p < TF_FRUSTUM_PLANE_COUNT; p++) {
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(plane_x[p], cx), _mm_mul_ps(plane_y[p], cy)),
+                                         _mm_add_ps(_mm_mul_ps(plane_z[p], cz), plane_w[p]));
+            __m128 reach = _mm_add_ps(_mm_add_ps(_mm_mul_ps(abs_x[p], ex), _mm_mul_ps(abs_y[p], ey)),
+                                      _mm_mul_ps(abs_z[p], ez));
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, reach), zero));
+        }
+
+        u32 inside = (u32)~_mm_movemask_ps(outside) & 0xFu;
+        for (u32 lane = 0; inside; lane++, inside >>= 1) {
+            if (inside & 1u) {
+                visible[visible_count++] = i + lane;
+            }
+        }
+    }
+
+    for (; i < count; i++) {
+        if (tf_frustum_test_box(frustum, centers[i], extents[i])) {
+            visible[visible_count++] = i;
+        }
+    }
+    return visible_count;
+}
+
+#else
+
+TF_API u32 tf_frustum_cull_boxes(const TF_Frustum *frustum, const TF_Vec3 *centers, const TF_Vec3 *extents,
+                                 u32 count, u32 *visible) {
+    u32 visible_count = 0;
+    for (u32 i = 0; i < count; i++) {
+        if (tf_frustum_test_box(frustum, centers[i], extents[i])) {
+            visible[visible_count++] = i;
+        }
+    }
+    return visible_count;
+}
+
+#endif
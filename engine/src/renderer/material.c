@@ -0,0 +1,54 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "tunafish/renderer/material.h"
+#include "tunafish/core/log.h"
+#include <stdlib.h>
+
+// =============================================================================
+// Material structure
+// =============================================================================
+
+struct TF_Material {
+    u32 id; // Unique per material, used for sort keys
+    TF_Color color;
+};
+
+static u32 s_next_material_id = 1;
+
+// =============================================================================
+// Material lifecycle
+// =============================================================================
+
+TF_API TF_Material *tf_material_create_default(void) {
+    TF_Material *material = malloc(sizeof(TF_Material));
+    if (!material) {
+        TF_ERROR("Failed to allocate material");
+        return NULL;
+    }
+
+    material->id = s_next_material_id++;
+    material->color = TF_COLOR_WHITE;
+    return material;
+}
+
+TF_API void tf_material_destroy(TF_Material *material) {
+    free(material);
+}
+
+// =============================================================================
+// Property management
+// =============================================================================
+
+TF_API void tf_material_set_color(TF_Material *material, TF_Color color) {
+    if (!material) return;
+    material->color = color;
+}
+
+TF_API TF_Color tf_material_get_color(const TF_Material *material) {
+    return material ? material->color : TF_COLOR_WHITE;
+}
+
+TF_API u32 tf_material_get_id(const TF_Material *material) {
+    return material ? material->id : 0;
+}
@@ -0,0 +1,315 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "renderer/mesh_internal.h"
+#include "tunafish/renderer/backend/renderer_backend.h"
+#include "tunafish/core/log.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static u32 s_next_mesh_id = 1;
+
+// =============================================================================
+// Vertex layout
+// =============================================================================
+
+static u32 tf_vertex_format_size(TF_VertexFormat format) {
+    switch (format) {
+        case TF_VERTEX_FORMAT_FLOAT2: return 2 * sizeof(f32);
+        case TF_VERTEX_FORMAT_FLOAT3: return 3 * sizeof(f32);
+        case TF_VERTEX_FORMAT_FLOAT4: return 4 * sizeof(f32);
+        case TF_VERTEX_FORMAT_UBYTE4_NORM: return 4;
+        default: return 0;
+    }
+}
+
+TF_API b32 tf_vertex_layout_add(TF_VertexLayout *layout, TF_VertexAttribute attribute, TF_VertexFormat format) {
+    if (!layout || attribute >= TF_VERTEX_ATTRIBUTE_COUNT) return TF_FALSE;
+
+    if (layout->element_count == TF_VERTEX_LAYOUT_MAX_ELEMENTS) {
+        TF_ERROR("Vertex layout is full (%d elements)", TF_VERTEX_LAYOUT_MAX_ELEMENTS);
+        return TF_FALSE;
+    }
+
+    if (tf_vertex_layout_has(layout, attribute)) {
+        TF_ERROR("Vertex layout already has attribute %d", attribute);
+        return TF_FALSE;
+    }
+
+    layout->elements[layout->element_count++] = (TF_VertexElement){attribute, format, layout->stride};
+    layout->stride += tf_vertex_format_size(format);
+    return TF_TRUE;
+}
+
+TF_API b32 tf_vertex_layout_has(const TF_VertexLayout *layout, TF_VertexAttribute attribute) {
+    if (!layout) return TF_FALSE;
+
+    for (u32 i = 0; i < layout->element_count; i++) {
+        if (layout->elements[i].attribute == attribute) {
+            return TF_TRUE;
+        }
+    }
+    return TF_FALSE;
+}
+
+// =============================================================================
+// Mesh lifecycle
+// =============================================================================
+
+const TF_VertexElement *tf_mesh_find_position(const TF_Mesh *mesh) {
+    for (u32 i = 0; i < mesh->layout.element_count; i++) {
+        if (mesh->layout.elements[i].attribute == TF_VERTEX_ATTRIBUTE_POSITION) {
+            return &mesh->layout.elements[i];
+        }
+    }
+    return NULL;
+}
+
+// Decoded the way the backends feed the attribute to shaders, reading only the
+// element's own bytes
+TF_Vec3 tf_mesh_read_position(const TF_Mesh *mesh, const TF_VertexElement *element, u32 vertex) {
+    const u8 *data = (const u8 *)mesh->vertices + (usize)mesh->layout.stride * vertex + element->offset;
+    f32 position[3] = {0.0f, 0.0f, 0.0f};
+    switch (element->format) {
+        case TF_VERTEX_FORMAT_FLOAT4:
+        case TF_VERTEX_FORMAT_FLOAT3:
+            memcpy(position, data, sizeof(f32) * 3);
+            break;
+        case TF_VERTEX_FORMAT_FLOAT2:
+            memcpy(position, data, sizeof(f32) * 2);
+            break;
+        case TF_VERTEX_FORMAT_UBYTE4_NORM:
+            position[0] = data[0] / 255.0f;
+            position[1] = data[1] / 255.0f;
+            position[2] = data[2] / 255.0f;
+            break;
+    }
+    return tf_vec3_create(position[0], position[1], position[2]);
+}
+
+// Box first, then the sphere around its center, which is tighter than the
+// box's corners for most shapes
+static void tf_mesh_compute_bounds(TF_Mesh *mesh) {
+    const TF_VertexElement *element = tf_mesh_find_position(mesh);
+
+    TF_Vec3 min = tf_mesh_read_position(mesh, element, 0);
+    TF_Vec3 max = min;
+    for (u32 i = 1; i < mesh->vertex_count; i++) {
+        TF_Vec3 p = tf_mesh_read_position(mesh, element, i);
+        min = tf_vec3_create(fminf(min.x, p.x), fminf(min.y, p.y), fminf(min.z, p.z));
+        max = tf_vec3_create(fmaxf(max.x, p.x), fmaxf(max.y, p.y), fmaxf(max.z, p.z));
+    }
+
+    TF_Vec3 center = tf_vec3_scale(tf_vec3_add(min, max), 0.5f);
+    f32 radius_squared = 0.0f;
+    for (u32 i = 0; i < mesh->vertex_count; i++) {
+        TF_Vec3 offset = tf_vec3_sub(tf_mesh_read_position(mesh, element, i), center);
+        radius_squared = fmaxf(radius_squared, tf_vec3_dot(offset, offset));
+    }
+
+    mesh->bounds.center = center;
+    mesh->bounds.extents = tf_vec3_scale(tf_vec3_sub(max, min), 0.5f);
+    mesh->bounds.radius = sqrtf(radius_squared);
+}
+
+TF_API TF_Mesh *tf_mesh_create(const TF_MeshDesc *desc) {
+    if (!desc || !desc->layout || !desc->vertices || !desc->indices) {
+        TF_ERROR("Mesh description, layout and data cannot be null");
+        return NULL;
+    }
+
+    if (desc->vertex_count == 0 || desc->index_count == 0 || desc->index_count % 3 != 0) {
+        TF_ERROR("Invalid mesh size (%u vertices, %u indices)", desc->vertex_count, desc->index_count);
+        return NULL;
+    }
+
+    if (!tf_vertex_layout_has(desc->layout, TF_VERTEX_ATTRIBUTE_POSITION) || desc->layout->stride == 0) {
+        TF_ERROR("Mesh vertex layout must contain a position");
+        return NULL;
+    }
+
+    for (u32 i = 0; i < desc->index_count; i++) {
+        if (desc->indices[i] >= desc->vertex_count) {
+            TF_ERROR("Mesh index %u out of range (%u >= %u)", i, desc->indices[i], desc->vertex_count);
+            return NULL;
+        }
+    }
+
+    TF_Mesh *mesh = calloc(1, sizeof(TF_Mesh));
+    if (!mesh) {
+        TF_ERROR("Failed to allocate mesh");
+        return NULL;
+    }
+
+    usize vertex_bytes = (usize)desc->layout->stride * desc->vertex_count;
+    usize index_bytes = sizeof(u32) * desc->index_count;
+    mesh->vertices = malloc(vertex_bytes);
+    mesh->indices = malloc(index_bytes);
+    if (!mesh->vertices || !mesh->indices) {
+        TF_ERROR("Failed to allocate mesh data (%u vertices, %u indices)", desc->vertex_count, desc->index_count);
+        tf_mesh_destroy(mesh);
+        return NULL;
+    }
+
+    memcpy(mesh->vertices, desc->vertices, vertex_bytes);
+    memcpy(mesh->indices, desc->indices, index_bytes);
+    mesh->layout = *desc->layout;
+    mesh->vertex_count = desc->vertex_count;
+    mesh->index_count = desc->index_count;
+    mesh->id = s_next_mesh_id++;
+    tf_mesh_compute_bounds(mesh);
+
+    if (desc->optimize && !tf_mesh_optimize(mesh, NULL)) {
+        tf_mesh_destroy(mesh);
+        return NULL;
+    }
+
+    return mesh;
+}
+
+TF_API TF_Mesh *tf_mesh_create_triangle(TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3, TF_Color color) {
+    TF_VertexLayout layout = {0};
+    tf_vertex_layout_add(&layout, TF_VERTEX_ATTRIBUTE_POSITION, TF_VERTEX_FORMAT_FLOAT3);
+    tf_vertex_layout_add(&layout, TF_VERTEX_ATTRIBUTE_COLOR, TF_VERTEX_FORMAT_FLOAT4);
+
+    const f32 vertices[] = {
+        p1.x, p1.y, p1.z, color.r, color.g, color.b, color.a,
+        p2.x, p2.y, p2.z, color.r, color.g, color.b, color.a,
+        p3.x, p3.y, p3.z, color.r, color.g, color.b, color.a,
+    };
+    const u32 indices[] = {0, 1, 2};
+
+    TF_MeshDesc desc = {&layout, vertices, 3, indices, 3, TF_FALSE};
+    return tf_mesh_create(&desc);
+}
+
+TF_API TF_Mesh *tf_mesh_create_cube(f32 size) {
+    TF_VertexLayout layout = {0};
+    tf_vertex_layout_add(&layout, TF_VERTEX_ATTRIBUTE_POSITION, TF_VERTEX_FORMAT_FLOAT3);
+    tf_vertex_layout_add(&layout, TF_VERTEX_ATTRIBUTE_NORMAL, TF_VERTEX_FORMAT_FLOAT3);
+
+    // One quad per face so every face gets its own normal
+    static const f32 faces[6][3][3] = {
+        // normal, u axis, v axis (u x v == normal, so faces wind CCW from outside)
+        {{ 1, 0, 0}, {0, 0, -1}, {0, 1, 0}},
+        {{-1, 0, 0}, {0, 0, 1}, {0, 1, 0}},
+        {{ 0, 1, 0}, {1, 0, 0}, {0, 0, -1}},
+        {{ 0, -1, 0}, {1, 0, 0}, {0, 0, 1}},
+        {{ 0, 0, 1}, {1, 0, 0}, {0, 1, 0}},
+        {{ 0, 0, -1}, {-1, 0, 0}, {0, 1, 0}},
+    };
+    static const f32 corners[4][2] = {{-1, -1}, {1, -1}, {1, 1}, {-1, 1}};
+
+    f32 vertices[24 * 6];
+    u32 indices[36];
+    f32 half = size * 0.5f;
+
+    for (u32 face = 0; face < 6; face++) {
+        const f32 *n = faces[face][0];
+        const f32 *u = faces[face][1];
+        const f32 *v = faces[face][2];
+
+        for (u32 corner = 0; corner < 4; corner++) {
+            f32 *vertex = &vertices[(face * 4 + corner) * 6];
+            for (u32 axis = 0; axis < 3; axis++) {
+                vertex[axis] = half * (n[axis] + corners[corner][0] * u[axis] + corners[corner][1] * v[axis]);
+                vertex[3 + axis] = n[axis];
+            }
+        }
+
+        u32 base = face * 4;
+        u32 *quad = &indices[face * 6];
+        quad[0] = base; quad[1] = base + 1; quad[2] = base + 2;
+        quad[3] = base; quad[4] = base + 2; quad[5] = base + 3;
+    }
+
+    TF_MeshDesc desc = {&layout, vertices, 24, indices, 36, TF_FALSE};
+    return tf_mesh_create(&desc);
+}
+
+TF_API void tf_mesh_destroy(TF_Mesh *mesh) {
+    if (!mesh) return;
+
+    // A render thread releases the mesh after the draws it still has queued
+    if (mesh->thread_owner && mesh->thread_owner->vtable->release_mesh) {
+        mesh->thread_owner->vtable->release_mesh(mesh->thread_owner, mesh);
+    }
+
+    // Let the backend drop its GPU copy first
+    if (mesh->gpu_owner && mesh->gpu_owner->vtable->release_mesh) {
+        mesh->gpu_owner->vtable->release_mesh(mesh->gpu_owner, mesh);
+    }
+
+    free(mesh->vertices);
+    free(mesh->indices);
+    free(mesh->clusters);
+    free(mesh);
+}
+
+// =============================================================================
+// Level of detail
+// =============================================================================
+
+TF_API b32 tf_mesh_add_lod(TF_Mesh *mesh, TF_Mesh *lod, f32 screen_size) {
+    if (!mesh || !lod || lod == mesh || screen_size <= 0.0f) {
+        TF_ERROR("Invalid mesh LOD");
+        return TF_FALSE;
+    }
+
+    if (mesh->lod_count == TF_MESH_MAX_LODS) {
+        TF_ERROR("Mesh already has %d LODs", TF_MESH_MAX_LODS);
+        return TF_FALSE;
+    }
+
+    if (mesh->lod_count > 0 && screen_size >= mesh->lod_screen_sizes[mesh->lod_count - 1]) {
+        TF_ERROR("Mesh LOD screen sizes must decrease (%.3f after %.3f)", screen_size,
+                 mesh->lod_screen_sizes[mesh->lod_count - 1]);
+        return TF_FALSE;
+    }
+
+    mesh->lods[mesh->lod_count] = lod;
+    mesh->lod_screen_sizes[mesh->lod_count] = screen_size;
+    mesh->lod_count++;
+    return TF_TRUE;
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+TF_API const TF_VertexLayout *tf_mesh_get_layout(const TF_Mesh *mesh) {
+    return mesh ? &mesh->layout : NULL;
+}
+
+TF_API u32 tf_mesh_get_vertex_count(const TF_Mesh *mesh) {
+    return mesh ? mesh->vertex_count : 0;
+}
+
+TF_API const void *tf_mesh_get_vertices(const TF_Mesh *mesh) {
+    return mesh ? mesh->vertices : NULL;
+}
+
+TF_API u32 tf_mesh_get_index_count(const TF_Mesh *mesh) {
+    return mesh ? mesh->index_count : 0;
+}
+
+TF_API const u32 *tf_mesh_get_indices(const TF_Mesh *mesh) {
+    return mesh ? mesh->indices : NULL;
+}
+
+TF_API TF_MeshBounds tf_mesh_get_bounds(const TF_Mesh *mesh) {
+    return mesh ? mesh->bounds : (TF_MeshBounds){0};
+}
+
+TF_API u32 tf_mesh_get_lod_count(const TF_Mesh *mesh) {
+    return mesh ? mesh->lod_count : 0;
+}
+
+TF_API u32 tf_mesh_get_cluster_count(const TF_Mesh *mesh) {
+    return mesh ? mesh->cluster_count : 0;
+}
+
+TF_API const TF_MeshCluster *tf_mesh_get_clusters(const TF_Mesh *mesh) {
+    return mesh ? mesh->clusters : NULL;
+}
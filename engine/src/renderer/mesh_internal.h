@@ -0,0 +1,71 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#pragma once
+
+#include "tunafish/renderer/mesh.h"
+#include "tunafish/renderer/frustum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct TF_RendererBackend TF_RendererBackend;
+typedef struct TF_ClusterCuller TF_ClusterCuller;
+
+// Shared between the renderer front end and the backends
+struct TF_Mesh {
+    u32 id; // Unique per mesh, used for sort keys
+
+    TF_VertexLayout layout;
+    void *vertices;
+    u32 vertex_count;
+    u32 *indices;
+    u32 index_count;
+    TF_MeshBounds bounds;
+
+    // Coarser levels, finest first, each used below its screen size
+    TF_Mesh *lods[TF_MESH_MAX_LODS];
+    f32 lod_screen_sizes[TF_MESH_MAX_LODS];
+    u32 lod_count;
+
+    // Clusters in index order, see tf_mesh_build_clusters
+    TF_MeshCluster *clusters;
+    u32 cluster_count;
+
+    // Reordered by tf_mesh_optimize, which building clusters repeats
+    b32 optimized;
+
+    // GPU copy, created lazily by the backend that first draws the mesh
+    TF_RendererBackend *gpu_owner;
+    void *gpu_data;
+
+    // Renderer whose render thread may still have draws of the mesh in
+    // flight. Only touched by the recording thread; gpu_owner belongs to the
+    // render thread then.
+    TF_RendererBackend *thread_owner;
+};
+
+// Position element of the layout (every mesh has one once created)
+const TF_VertexElement *tf_mesh_find_position(const TF_Mesh *mesh);
+
+// Object-space position of a vertex in any vertex format (z = 0 for 2D positions)
+TF_Vec3 tf_mesh_read_position(const TF_Mesh *mesh, const TF_VertexElement *element, u32 vertex);
+
+// Clusters of one culling pass, by outcome
+typedef struct {
+    u32 tested;
+    u32 culled;     // Outside the frustum
+    u32 backfacing; // Inside it but facing away from the eye
+} TF_ClusterCounts;
+
+// Cull the clusters of a clustered mesh placed by transform (an instance's
+// 3x4 rows) against a world-space frustum and eye. Writes the surviving index
+// ranges, adjacent ones merged, to ranges (room for cluster_count) and returns
+// how many; adds to counts. culler may be NULL to cull on the calling thread.
+u32 tf_mesh_cull_clusters(const TF_Mesh *mesh, const f32 *transform, const TF_Frustum *frustum, TF_Vec3 eye,
+                          TF_ClusterCuller *culler, TF_IndexRange *ranges, TF_ClusterCounts *counts);
+
+#ifdef __cplusplus
+}
+#endif
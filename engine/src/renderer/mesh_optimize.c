@@ -0,0 +1,448 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "renderer/mesh_internal.h"
+#include "tunafish/core/log.h"
+#include "tunafish/core/time.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// A run of triangles is split for the overdraw sort wherever its cache miss
+// ratio so far is within this factor of the whole run's. Lower keeps more of
+// the vertex cache order, higher gives the sort more, smaller runs.
+#define TF_MESH_OVERDRAW_THRESHOLD 1.05f
+
+// =============================================================================
+// Vertex cache simulation
+// =============================================================================
+
+// FIFO cache as timestamps: a vertex stays cached until
+// TF_MESH_VERTEX_CACHE_SIZE misses after the one that loaded it
+typedef struct {
+    u32 *stamps; // Per vertex, the time it was loaded at (0 = never)
+    u32 time;    // Misses so far, plus the cache size
+} TF_VertexCache;
+
+static void tf_vertex_cache_flush(TF_VertexCache *cache) {
+    cache->time += TF_MESH_VERTEX_CACHE_SIZE + 1;
+}
+
+static b32 tf_vertex_cache_contains(const TF_VertexCache *cache, u32 vertex) {
+    return cache->time - cache->stamps[vertex] <= TF_MESH_VERTEX_CACHE_SIZE;
+}
+
+// Shade a triangle's corners; returns how many missed
+static u32 tf_vertex_cache_access(TF_VertexCache *cache, const u32 *corners) {
+    u32 misses = 0;
+    for (u32 i = 0; i < 3; i++) {
+        if (!tf_vertex_cache_contains(cache, corners[i])) {
+            cache->stamps[corners[i]] = cache->time++;
+            misses++;
+        }
+    }
+    return misses;
+}
+
+// stamps: vertex_count zeroed entries
+static TF_VertexCacheStats tf_mesh_simulate_cache(const u32 *indices, u32 index_count, u32 vertex_count,
+                                                  u32 *stamps) {
+    TF_VertexCache cache = {stamps, 0};
+    tf_vertex_cache_flush(&cache);
+
+    u32 misses = 0;
+    for (u32 i = 0; i < index_count; i += 3) {
+        misses += tf_vertex_cache_access(&cache, indices + i);
+    }
+
+    u32 referenced = 0;
+    for (u32 i = 0; i < vertex_count; i++) {
+        referenced += stamps[i] != 0;
+    }
+
+    TF_VertexCacheStats stats = {0};
+    stats.acmr = (f32)misses / (f32)(index_count / 3);
+    stats.atvr = referenced > 0 ? (f32)misses / (f32)referenced : 0.0f;
+    return stats;
+}
+
+TF_API TF_VertexCacheStats tf_mesh_analyze_vertex_cache(const TF_Mesh *mesh) {
+    if (!mesh) {
+        return (TF_VertexCacheStats){0};
+    }
+
+    u32 *stamps = calloc(mesh->vertex_count, sizeof(u32));
+    if (!stamps) {
+        TF_ERROR("Failed to allocate vertex cache simulation for mesh %u", mesh->id);
+        return (TF_VertexCacheStats){0};
+    }
+
+    TF_VertexCacheStats stats = tf_mesh_simulate_cache(mesh->indices, mesh->index_count, mesh->vertex_count, stamps);
+    free(stamps);
+    return stats;
+}
+
+// =============================================================================
+// Vertex cache order (Tipsify)
+// =============================================================================
+
+typedef struct {
+    const u32 *indices;
+    u32 *adjacency_offsets; // Per vertex, into adjacency (vertex_count + 1)
+    u32 *adjacency;         // Triangles around each vertex
+    u32 *live;              // Triangles around each vertex not emitted yet
+    u8 *emitted;
+    TF_VertexCache cache;
+    u32 *dead_ends;         // Stack of recently used vertices
+    u32 dead_end_count;
+    u32 *candidates;        // Vertices of the last fan
+    u32 candidate_count;
+    u32 *order;             // Triangles in output order
+} TF_MeshOptimizer;
+
+static void tf_mesh_optimizer_free(TF_MeshOptimizer *optimizer) {
+    free(optimizer->adjacency_offsets);
+    free(optimizer->adjacency);
+    free(optimizer->live);
+    free(optimizer->emitted);
+    free(optimizer->cache.stamps);
+    free(optimizer->dead_ends);
+    free(optimizer->candidates);
+    free(optimizer->order);
+}
+
+// Next vertex to fan around: the candidate used longest ago whose remaining
+// triangles still fit in the cache, else any candidate with triangles left,
+// else a dead end, else the next triangle left in the range; ~0u when done
+static u32 tf_mesh_next_fan(TF_MeshOptimizer *optimizer, u32 *cursor, u32 end) {
+    u32 best = ~0u;
+    i64 best_priority = -1;
+    for (u32 i = 0; i < optimizer->candidate_count; i++) {
+        u32 vertex = optimizer->candidates[i];
+        if (optimizer->live[vertex] == 0) {
+            continue;
+        }
+
+        i64 age = optimizer->cache.time - optimizer->cache.stamps[vertex];
+        i64 priority = age + 2 * (i64)optimizer->live[vertex] <= TF_MESH_VERTEX_CACHE_SIZE ? age : 0;
+        if (priority > best_priority) {
+            best = vertex;
+            best_priority = priority;
+        }
+    }
+    if (best != ~0u) {
+        return best;
+    }
+
+    while (optimizer->dead_end_count > 0) {
+        u32 vertex = optimizer->dead_ends[--optimizer->dead_end_count];
+        if (optimizer->live[vertex] > 0) {
+            return vertex;
+        }
+    }
+
+    while (*cursor < end) {
+        if (!optimizer->emitted[*cursor]) {
+            return optimizer->indices[(usize)*cursor * 3];
+        }
+        (*cursor)++;
+    }
+    return ~0u;
+}
+
+// Order the triangles first..end-1 into order[first..end-1] by emitting every
+// triangle around one vertex at a time (Sander, Nehab and Barczak, "Fast
+// Triangle Reordering for Vertex Locality and Reduced Overdraw", 2007)
+static void tf_mesh_tipsify(TF_MeshOptimizer *optimizer, u32 first, u32 end) {
+    for (u32 i = first * 3; i < end * 3; i++) {
+        optimizer->live[optimizer->indices[i]]++;
+    }
+
+    u32 emitted_count = first;
+    u32 cursor = first;
+    optimizer->dead_end_count = 0;
+    u32 fan = optimizer->indices[(usize)first * 3];
+    while (fan != ~0u) {
+        optimizer->candidate_count = 0;
+        for (u32 j = optimizer->adjacency_offsets[fan]; j < optimizer->adjacency_offsets[fan + 1]; j++) {
+            u32 triangle = optimizer->adjacency[j];
+            if (triangle < first || triangle >= end || optimizer->emitted[triangle]) {
+                continue;
+            }
+
+            const u32 *corners = optimizer->indices + (usize)triangle * 3;
+            for (u32 i = 0; i < 3; i++) {
+                optimizer->dead_ends[optimizer->dead_end_count++] = corners[i];
+                optimizer->candidates[optimizer->candidate_count++] = corners[i];
+                optimizer->live[corners[i]]--;
+            }
+            tf_vertex_cache_access(&optimizer->cache, corners);
+            optimizer->emitted[triangle] = 1;
+            optimizer->order[emitted_count++] = triangle;
+        }
+        fan = tf_mesh_next_fan(optimizer, &cursor, end);
+    }
+}
+
+// =============================================================================
+// Overdraw order
+// =============================================================================
+
+typedef struct {
+    f32 key; // Larger = drawn earlier
+    u32 first;
+    u32 count;
+} TF_TriangleRun;
+
+static int tf_triangle_run_compare(const void *a, const void *b) {
+    const TF_TriangleRun *x = a;
+    const TF_TriangleRun *y = b;
+    if (x->key != y->key) {
+        return x->key > y->key ? -1 : 1;
+    }
+    return x->first < y->first ? -1 : x->first > y->first;
+}
+
+static TF_Vec3 tf_mesh_triangle_cross(const TF_Mesh *mesh, const TF_VertexElement *element, const u32 *corners,
+                                      TF_Vec3 *centroid) {
+    TF_Vec3 p0 = tf_mesh_read_position(mesh, element, corners[0]);
+    TF_Vec3 p1 = tf_mesh_read_position(mesh, element, corners[1]);
+    TF_Vec3 p2 = tf_mesh_read_position(mesh, element, corners[2]);
+    *centroid = tf_vec3_scale(tf_vec3_add(tf_vec3_add(p0, p1), p2), 1.0f / 3.0f);
+    return tf_vec3_cross(tf_vec3_sub(p1, p0), tf_vec3_sub(p2, p0));
+}
+
+// Split cache-ordered triangles into runs, first where the cache order had
+// to start over, then wherever a run's cache misses are already low enough,
+// and draw the runs facing out from the mesh's center first: they are the
+// likeliest to hide the rest
+static b32 tf_mesh_sort_overdraw(const TF_Mesh *mesh, const u32 *indices, u32 *output, u32 *stamps) {
+    u32 triangle_count = mesh->index_count / 3;
+    TF_TriangleRun *runs = malloc(sizeof(TF_TriangleRun) * triangle_count);
+    u32 *hard_starts = malloc(sizeof(u32) * (triangle_count + 1));
+    if (!runs || !hard_starts) {
+        free(runs);
+        free(hard_starts);
+        return TF_FALSE;
+    }
+
+    memset(stamps, 0, sizeof(u32) * mesh->vertex_count);
+    TF_VertexCache cache = {stamps, 0};
+    tf_vertex_cache_flush(&cache);
+
+    u32 hard_count = 0;
+    for (u32 i = 0; i < triangle_count; i++) {
+        if (tf_vertex_cache_access(&cache, indices + (usize)i * 3) == 3 || i == 0) {
+            hard_starts[hard_count++] = i;
+        }
+    }
+    hard_starts[hard_count] = triangle_count;
+
+    u32 run_count = 0;
+    for (u32 hard = 0; hard < hard_count; hard++) {
+        u32 first = hard_starts[hard];
+        u32 end = hard_starts[hard + 1];
+
+        tf_vertex_cache_flush(&cache);
+        u32 misses = 0;
+        for (u32 i = first; i < end; i++) {
+            misses += tf_vertex_cache_access(&cache, indices + (usize)i * 3);
+        }
+        f32 threshold = TF_MESH_OVERDRAW_THRESHOLD * (f32)misses / (f32)(end - first);
+
+        tf_vertex_cache_flush(&cache);
+        u32 start = first;
+        misses = 0;
+        for (u32 i = first; i < end; i++) {
+            misses += tf_vertex_cache_access(&cache, indices + (usize)i * 3);
+            if (i + 1 == end || (f32)misses <= threshold * (f32)(i + 1 - start)) {
+                runs[run_count++] = (TF_TriangleRun){0.0f, start, i + 1 - start};
+                start = i + 1;
+                misses = 0;
+                tf_vertex_cache_flush(&cache);
+            }
+        }
+    }
+    free(hard_starts);
+
+    // Area-weighted centroids; a triangle's cross product is twice its area
+    const TF_VertexElement *element = tf_mesh_find_position(mesh);
+    TF_Vec3 mesh_sum = tf_vec3_create(0.0f, 0.0f, 0.0f);
+    f32 mesh_area = 0.0f;
+    for (u32 i = 0; i < triangle_count; i++) {
+        TF_Vec3 centroid;
+        f32 area = tf_vec3_length(tf_mesh_triangle_cross(mesh, element, indices + (usize)i * 3, &centroid));
+        mesh_sum = tf_vec3_add(mesh_sum, tf_vec3_scale(centroid, area));
+        mesh_area += area;
+    }
+    TF_Vec3 mesh_center = mesh_area > 0.0f ? tf_vec3_scale(mesh_sum, 1.0f / mesh_area) : mesh->bounds.center;
+
+    for (u32 run = 0; run < run_count; run++) {
+        TF_Vec3 sum = tf_vec3_create(0.0f, 0.0f, 0.0f);
+        TF_Vec3 normal = tf_vec3_create(0.0f, 0.0f, 0.0f);
+        f32 area = 0.0f;
+        for (u32 i = runs[run].first; i < runs[run].first + runs[run].count; i++) {
+            TF_Vec3 centroid;
+            TF_Vec3 cross = tf_mesh_triangle_cross(mesh, element, indices + (usize)i * 3, &centroid);
+            f32 triangle_area = tf_vec3_length(cross);
+            sum = tf_vec3_add(sum, tf_vec3_scale(centroid, triangle_area));
+            normal = tf_vec3_add(normal, cross);
+            area += triangle_area;
+        }
+
+        f32 normal_length = tf_vec3_length(normal);
+        if (area > 0.0f && normal_length > 0.0f) {
+            TF_Vec3 offset = tf_vec3_sub(tf_vec3_scale(sum, 1.0f / area), mesh_center);
+            runs[run].key = tf_vec3_dot(offset, normal) / normal_length;
+        }
+    }
+
+    qsort(runs, run_count, sizeof(TF_TriangleRun), tf_triangle_run_compare);
+
+    u32 written = 0;
+    for (u32 run = 0; run < run_count; run++) {
+        memcpy(output + written, indices + (usize)runs[run].first * 3, sizeof(u32) * 3 * runs[run].count);
+        written += runs[run].count * 3;
+    }
+    free(runs);
+    return TF_TRUE;
+}
+
+// =============================================================================
+// Vertex fetch order
+// =============================================================================
+
+// Store the vertices in the order the indices first use them, unused ones
+// last, so fetching them walks the buffer forwards
+static b32 tf_mesh_sort_vertices(TF_Mesh *mesh, u32 *remap) {
+    u32 stride = mesh->layout.stride;
+    u8 *vertices = malloc((usize)stride * mesh->vertex_count);
+    if (!vertices) {
+        return TF_FALSE;
+    }
+
+    memset(remap, 0xFF, sizeof(u32) * mesh->vertex_count);
+    u32 next = 0;
+    for (u32 i = 0; i < mesh->index_count; i++) {
+        if (remap[mesh->indices[i]] == ~0u) {
+            remap[mesh->indices[i]] = next++;
+        }
+        mesh->indices[i] = remap[mesh->indices[i]];
+    }
+    for (u32 i = 0; i < mesh->vertex_count; i++) {
+        if (remap[i] == ~0u) {
+            remap[i] = next++;
+        }
+        memcpy(vertices + (usize)stride * remap[i], (const u8 *)mesh->vertices + (usize)stride * i, stride);
+    }
+
+    free(mesh->vertices);
+    mesh->vertices = vertices;
+    return TF_TRUE;
+}
+
+// =============================================================================
+// Optimization
+// =============================================================================
+
+TF_API b32 tf_mesh_optimize(TF_Mesh *mesh, TF_MeshOptimizeStats *stats) {
+    if (!mesh) {
+        return TF_FALSE;
+    }
+
+    // The GPU copy holds the old order
+    if (mesh->gpu_owner || mesh->thread_owner) {
+        TF_ERROR("Mesh %u was already drawn; optimize it before the first draw", mesh->id);
+        return TF_FALSE;
+    }
+
+    f64 start = tf_time_get_current();
+    u32 triangle_count = mesh->index_count / 3;
+
+    TF_MeshOptimizer optimizer = {0};
+    optimizer.indices = mesh->indices;
+    optimizer.adjacency_offsets = calloc((usize)mesh->vertex_count + 1, sizeof(u32));
+    optimizer.adjacency = malloc(sizeof(u32) * mesh->index_count);
+    optimizer.live = calloc(mesh->vertex_count, sizeof(u32));
+    optimizer.emitted = calloc(triangle_count, sizeof(u8));
+    optimizer.cache.stamps = calloc(mesh->vertex_count, sizeof(u32));
+    optimizer.dead_ends = malloc(sizeof(u32) * mesh->index_count);
+    optimizer.candidates = malloc(sizeof(u32) * mesh->index_count);
+    optimizer.order = malloc(sizeof(u32) * triangle_count);
+    u32 *indices = malloc(sizeof(u32) * mesh->index_count);
+    u32 *sorted = mesh->clusters ? NULL : malloc(sizeof(u32) * mesh->index_count);
+    if (!optimizer.adjacency_offsets || !optimizer.adjacency || !optimizer.live || !optimizer.emitted ||
+        !optimizer.cache.stamps || !optimizer.dead_ends || !optimizer.candidates || !optimizer.order || !indices ||
+        (!mesh->clusters && !sorted)) {
+        TF_ERROR("Failed to allocate optimization data for mesh %u", mesh->id);
+        tf_mesh_optimizer_free(&optimizer);
+        free(indices);
+        free(sorted);
+        return TF_FALSE;
+    }
+
+    TF_MeshOptimizeStats result = {0};
+    result.before = tf_mesh_simulate_cache(mesh->indices, mesh->index_count, mesh->vertex_count,
+                                           optimizer.cache.stamps);
+
+    // Triangles around each vertex, with live briefly as fill cursors
+    for (u32 i = 0; i < mesh->index_count; i++) {
+        optimizer.adjacency_offsets[mesh->indices[i] + 1]++;
+    }
+    for (u32 i = 0; i < mesh->vertex_count; i++) {
+        optimizer.adjacency_offsets[i + 1] += optimizer.adjacency_offsets[i];
+    }
+    for (u32 i = 0; i < mesh->index_count; i++) {
+        u32 vertex = mesh->indices[i];
+        optimizer.adjacency[optimizer.adjacency_offsets[vertex] + optimizer.live[vertex]++] = i / 3;
+    }
+    memset(optimizer.live, 0, sizeof(u32) * mesh->vertex_count);
+    memset(optimizer.cache.stamps, 0, sizeof(u32) * mesh->vertex_count);
+    tf_vertex_cache_flush(&optimizer.cache);
+
+    // Clusters must stay contiguous, so only their insides are reordered, and
+    // they are too small for the overdraw sort to matter
+    if (mesh->clusters) {
+        for (u32 i = 0; i < mesh->cluster_count; i++) {
+            u32 first = mesh->clusters[i].first_index / 3;
+            tf_mesh_tipsify(&optimizer, first, first + mesh->clusters[i].index_count / 3);
+        }
+    } else {
+        tf_mesh_tipsify(&optimizer, 0, triangle_count);
+    }
+    for (u32 i = 0; i < triangle_count; i++) {
+        memcpy(indices + (usize)i * 3, mesh->indices + (usize)optimizer.order[i] * 3, sizeof(u32) * 3);
+    }
+
+    if (sorted) {
+        if (tf_mesh_sort_overdraw(mesh, indices, sorted, optimizer.cache.stamps)) {
+            u32 *swap = indices;
+            indices = sorted;
+            sorted = swap;
+        } else {
+            TF_WARN("Failed to sort mesh %u for overdraw; kept the vertex cache order", mesh->id);
+        }
+    }
+    free(sorted);
+    free(mesh->indices);
+    mesh->indices = indices;
+
+    // Vertices move, so the scratch stamps become the remap table
+    if (!tf_mesh_sort_vertices(mesh, optimizer.cache.stamps)) {
+        TF_WARN("Failed to reorder the vertices of mesh %u; kept their order", mesh->id);
+    }
+
+    memset(optimizer.cache.stamps, 0, sizeof(u32) * mesh->vertex_count);
+    result.after = tf_mesh_simulate_cache(mesh->indices, mesh->index_count, mesh->vertex_count,
+                                          optimizer.cache.stamps);
+    tf_mesh_optimizer_free(&optimizer);
+    mesh->optimized = TF_TRUE;
+
+    TF_DEBUG("Mesh %u optimized in %.2fms: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f", mesh->id,
+             (tf_time_get_current() - start) * 1000.0, result.before.acmr, result.after.acmr, result.before.atvr,
+             result.after.atvr);
+    if (stats) {
+        *stats = result;
+    }
+    return TF_TRUE;
+}
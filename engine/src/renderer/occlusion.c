@@ -0,0 +1,576 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "tunafish/renderer/occlusion.h"
+#include "tunafish/renderer/camera.h"
+#include "renderer/backend/software/sw_raster.h"
+#include "renderer/backend/software/sw_workers.h"
+#include "renderer/mesh_internal.h"
+#include "tunafish/core/log.h"
+#include "tunafish/core/time.h"
+#include "tunafish/platform/thread.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define TF_OCCLUSION_SSE2 1
+#include <emmintrin.h>
+#else
+#define TF_OCCLUSION_SSE2 0
+#endif
+
+#define TF_OCCLUSION_BLOCK_SIZE 8  // Pixels per side of the blocks that keep their farthest depth
+#define TF_OCCLUSION_TILE_SIZE 32  // Pixels per side of a raster task (multiple of the block size)
+
+// A pixel only hides a box that is this much further away, relative to its
+// distance, so an occluder never culls itself through rounding
+#define TF_OCCLUSION_DEPTH_BIAS 0.001f
+
+// Triangles binned to one tile, in any order (depth is max-combined)
+typedef struct {
+    u32 *triangles;
+    u32 count;
+    u32 capacity;
+} TF_OcclusionBin;
+
+struct TF_OcclusionBuffer {
+    u32 width, height;   // Multiples of TF_OCCLUSION_BLOCK_SIZE
+    f32 *depth;          // Nearest 1/w per pixel, 0 = empty
+    u32 blocks_x, blocks_y;
+    f32 *block_depth;    // Smallest (farthest) 1/w of each block
+
+    // Occluders set up and binned since begin
+    TF_SWTriangle *triangles;
+    u32 triangle_count;
+    u32 triangle_capacity;
+    TF_OcclusionBin *bins;
+    u32 tiles_x, tiles_y;
+    TF_SWWorkers *workers;
+
+    // Clip-space vertices of the occluder being added
+    TF_Vec4 *vertices;
+    u32 vertex_capacity;
+
+    TF_Mat4 view_projection;
+    TF_OcclusionStats stats;
+};
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+TF_API TF_OcclusionBuffer *tf_occlusion_buffer_create(const TF_OcclusionConfig *config) {
+    TF_OcclusionConfig defaults = {0};
+    if (!config) {
+        config = &defaults;
+    }
+
+    TF_OcclusionBuffer *buffer = calloc(1, sizeof(TF_OcclusionBuffer));
+    if (!buffer) {
+        TF_ERROR("Failed to allocate occlusion buffer");
+        return NULL;
+    }
+
+    u32 width = config->width ? config->width : TF_OCCLUSION_DEFAULT_WIDTH;
+    u32 height = config->height ? config->height : TF_OCCLUSION_DEFAULT_HEIGHT;
+    buffer->blocks_x = (width + TF_OCCLUSION_BLOCK_SIZE - 1) / TF_OCCLUSION_BLOCK_SIZE;
+    buffer->blocks_y = (height + TF_OCCLUSION_BLOCK_SIZE - 1) / TF_OCCLUSION_BLOCK_SIZE;
+    buffer->width = buffer->blocks_x * TF_OCCLUSION_BLOCK_SIZE;
+    buffer->height = buffer->blocks_y * TF_OCCLUSION_BLOCK_SIZE;
+    buffer->tiles_x = (buffer->width + TF_OCCLUSION_TILE_SIZE - 1) / TF_OCCLUSION_TILE_SIZE;
+    buffer->tiles_y = (buffer->height + TF_OCCLUSION_TILE_SIZE - 1) / TF_OCCLUSION_TILE_SIZE;
+
+    buffer->depth = calloc((usize)buffer->width * buffer->height, sizeof(f32));
+    buffer->block_depth = calloc((usize)buffer->blocks_x * buffer->blocks_y, sizeof(f32));
+    buffer->bins = calloc((usize)buffer->tiles_x * buffer->tiles_y, sizeof(TF_OcclusionBin));
+    if (!buffer->depth || !buffer->block_depth || !buffer->bins) {
+        TF_ERROR("Failed to allocate %ux%u occlusion buffer", buffer->width, buffer->height);
+        tf_occlusion_buffer_destroy(buffer);
+        return NULL;
+    }
+
+    // The calling thread rasterizes too, so one core is already covered
+    u32 thread_count = config->worker_threads;
+    if (thread_count == 0) {
+        thread_count = tf_thread_get_cpu_count() - 1;
+        if (thread_count > TF_OCCLUSION_MAX_WORKER_THREADS) {
+            thread_count = TF_OCCLUSION_MAX_WORKER_THREADS;
+        }
+    }
+    buffer->workers = tf_sw_workers_create(thread_count);
+    if (!buffer->workers) {
+        tf_occlusion_buffer_destroy(buffer);
+        return NULL;
+    }
+
+    buffer->view_projection = tf_mat4_identity();
+
+    TF_DEBUG("Occlusion buffer created (%ux%u, %u worker threads)", buffer->width, buffer->height,
+             tf_sw_workers_get_thread_count(buffer->workers));
+    return buffer;
+}
+
+// Also used to unwind a partially created buffer, so every member may be unset
+TF_API void tf_occlusion_buffer_destroy(TF_OcclusionBuffer *buffer) {
+    if (!buffer) {
+        return;
+    }
+
+    tf_sw_workers_destroy(buffer->workers);
+    if (buffer->bins) {
+        for (u32 i = 0; i < buffer->tiles_x * buffer->tiles_y; i++) {
+            free(buffer->bins[i].triangles);
+        }
+    }
+    free(buffer->bins);
+    free(buffer->triangles);
+    free(buffer->vertices);
+    free(buffer->block_depth);
+    free(buffer->depth);
+    free(buffer);
+}
+
+TF_API void tf_occlusion_buffer_begin(TF_OcclusionBuffer *buffer, const TF_Camera *camera) {
+    if (!buffer) {
+        return;
+    }
+
+    buffer->view_projection = tf_mat4_multiply(tf_camera_get_projection_matrix(camera),
+                                               tf_camera_get_view_matrix(camera));
+    for (u32 i = 0; i < buffer->tiles_x * buffer->tiles_y; i++) {
+        buffer->bins[i].count = 0;
+    }
+    buffer->triangle_count = 0;
+    buffer->stats.occluders = 0;
+    buffer->stats.occluder_triangles = 0;
+}
+
+// =============================================================================
+// Occluders
+// =============================================================================
+
+static b32 tf_occlusion_bin_push(TF_OcclusionBin *bin, u32 triangle) {
+    if (bin->count == bin->capacity) {
+        u32 capacity = bin->capacity ? bin->capacity * 2 : 64;
+        u32 *triangles = realloc(bin->triangles, sizeof(u32) * capacity);
+        if (!triangles) {
+            TF_ERROR("Failed to grow occlusion tile bin");
+            return TF_FALSE;
+        }
+        bin->triangles = triangles;
+        bin->capacity = capacity;
+    }
+
+    bin->triangles[bin->count++] = triangle;
+    return TF_TRUE;
+}
+
+// Set up a screen-space triangle and add it to every tile its bounds touch
+static void tf_occlusion_bin_triangle(TF_OcclusionBuffer *buffer, const TF_SWScreenVertex *v0,
+                                      const TF_SWScreenVertex *v1, const TF_SWScreenVertex *v2) {
+    if (buffer->triangle_count == buffer->triangle_capacity) {
+        u32 capacity = buffer->triangle_capacity ? buffer->triangle_capacity * 2 : 256;
+        TF_SWTriangle *triangles = realloc(buffer->triangles, sizeof(TF_SWTriangle) * capacity);
+        if (!triangles) {
+            TF_ERROR("Failed to grow occluder triangle storage");
+            return;
+        }
+        buffer->triangles = triangles;
+        buffer->triangle_capacity = capacity;
+    }
+
+    u32 index = buffer->triangle_count;
+    TF_SWTriangle *triangle = &buffer->triangles[index];
+    if (!tf_sw_triangle_setup(triangle, v0, v1, v2, 0, 0, (i32)buffer->width, (i32)buffer->height, 0)) {
+        return;
+    }
+    buffer->triangle_count++;
+    buffer->stats.occluder_triangles++;
+
+    u32 tile_min_x = (u32)triangle->min_x / TF_OCCLUSION_TILE_SIZE;
+    u32 tile_min_y = (u32)triangle->min_y / TF_OCCLUSION_TILE_SIZE;
+    u32 tile_max_x = (u32)(triangle->max_x - 1) / TF_OCCLUSION_TILE_SIZE;
+    u32 tile_max_y = (u32)(triangle->max_y - 1) / TF_OCCLUSION_TILE_SIZE;
+    for (u32 ty = tile_min_y; ty <= tile_max_y; ty++) {
+        for (u32 tx = tile_min_x; tx <= tile_max_x; tx++) {
+            tf_occlusion_bin_push(&buffer->bins[ty * buffer->tiles_x + tx], index);
+        }
+    }
+}
+
+static TF_SWScreenVertex tf_occlusion_to_screen(const TF_OcclusionBuffer *buffer, TF_Vec4 clip) {
+    f32 inv_w = 1.0f / clip.w;
+    TF_SWScreenVertex screen = {0};
+    screen.x = (clip.x * inv_w * 0.5f + 0.5f) * (f32)buffer->width;
+    screen.y = (clip.y * inv_w * 0.5f + 0.5f) * (f32)buffer->height;
+    screen.z = clip.z * inv_w * 0.5f + 0.5f;
+    screen.inv_w = inv_w;
+    return screen;
+}
+
+// Clip a clip-space triangle against the near plane and bin the result. Only
+// the near plane matters: x and y are bounded by the buffer, and occluders
+// past the far plane still hide what lies behind them.
+static void tf_occlusion_emit_triangle(TF_OcclusionBuffer *buffer, TF_Vec4 v0, TF_Vec4 v1, TF_Vec4 v2) {
+    if ((v0.x < -v0.w && v1.x < -v1.w && v2.x < -v2.w) || (v0.x > v0.w && v1.x > v1.w && v2.x > v2.w) ||
+        (v0.y < -v0.w && v1.y < -v1.w && v2.y < -v2.w) || (v0.y > v0.w && v1.y > v1.w && v2.y > v2.w)) {
+        return;
+    }
+
+    // Sutherland-Hodgman against z >= -w
+    const TF_Vec4 in[3] = {v0, v1, v2};
+    TF_Vec4 polygon[4];
+    u32 count = 0;
+    for (u32 i = 0; i < 3; i++) {
+        TF_Vec4 a = in[i];
+        TF_Vec4 b = in[(i + 1) % 3];
+        f32 da = a.w + a.z;
+        f32 db = b.w + b.z;
+        if (da >= 0.0f) {
+            polygon[count++] = a;
+        }
+        if ((da >= 0.0f) != (db >= 0.0f)) {
+            polygon[count++] = tf_vec4_add(a, tf_vec4_scale(tf_vec4_sub(b, a), da / (da - db)));
+        }
+    }
+    if (count < 3) {
+        return;
+    }
+
+    TF_SWScreenVertex screen[4];
+    for (u32 i = 0; i < count; i++) {
+        if (polygon[i].w <= 0.0f) {
+            return;
+        }
+        screen[i] = tf_occlusion_to_screen(buffer, polygon[i]);
+    }
+    for (u32 i = 1; i + 1 < count; i++) {
+        tf_occlusion_bin_triangle(buffer, &screen[0], &screen[i], &screen[i + 1]);
+    }
+}
+
+TF_API void tf_occlusion_buffer_add_occluder(TF_OcclusionBuffer *buffer, const TF_Mesh *mesh, TF_Mat4 transform) {
+    if (!buffer || !mesh) {
+        return;
+    }
+
+    if (mesh->vertex_count > buffer->vertex_capacity) {
+        TF_Vec4 *vertices = realloc(buffer->vertices, sizeof(TF_Vec4) * mesh->vertex_count);
+        if (!vertices) {
+            TF_ERROR("Failed to grow occluder vertex scratch to %u vertices", mesh->vertex_count);
+            return;
+        }
+        buffer->vertices = vertices;
+        buffer->vertex_capacity = mesh->vertex_count;
+    }
+
+    const TF_VertexElement *position = tf_mesh_find_position(mesh);
+    TF_Mat4 mvp = tf_mat4_multiply(buffer->view_projection, transform);
+    for (u32 i = 0; i < mesh->vertex_count; i++) {
+        TF_Vec3 p = tf_mesh_read_position(mesh, position, i);
+        buffer->vertices[i] = tf_mat4_multiply_vec4(mvp, (TF_Vec4){p.x, p.y, p.z, 1.0f});
+    }
+
+    for (u32 i = 0; i + 2 < mesh->index_count; i += 3) {
+        tf_occlusion_emit_triangle(buffer, buffer->vertices[mesh->indices[i]], buffer->vertices[mesh->indices[i + 1]],
+                                   buffer->vertices[mesh->indices[i + 2]]);
+    }
+    buffer->stats.occluders++;
+}
+
+// =============================================================================
+// Rasterization
+// =============================================================================
+
+#if TF_OCCLUSION_SSE2
+
+// Depth only, four pixels per step. Coverage and depth are both conservative:
+// each edge is tested at the pixel corner furthest inside it, so a pixel is
+// only covered when the whole of it is, and it takes the smallest (farthest)
+// 1/w over the pixel. Covered pixels keep the larger (nearer) value.
+static void tf_occlusion_rasterize_triangle(TF_OcclusionBuffer *buffer, const TF_SWTriangle *triangle,
+                                            i32 min_x, i32 min_y, i32 max_x, i32 max_y) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 lane_offsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+    const __m128 span_min = _mm_set1_ps((f32)min_x + 0.5f);
+    const __m128 span_max = _mm_set1_ps((f32)max_x);
+
+    __m128 edge_a[3], zero_ok[3];
+    for (u32 e = 0; e < 3; e++) {
+        edge_a[e] = _mm_set1_ps(triangle->edge_a[e]);
+        zero_ok[e] = (triangle->top_left & (1u << e)) ? _mm_castsi128_ps(_mm_set1_epi32(-1)) : zero;
+    }
+    const TF_SWPlane *plane = &triangle->planes[TF_SW_PLANE_INV_W];
+    const __m128 plane_dx = _mm_set1_ps(plane->dx);
+
+    // Distance from the pixel center to its worst corner, per edge and for depth
+    f32 edge_offset[3];
+    for (u32 e = 0; e < 3; e++) {
+        edge_offset[e] = 0.5f * (fabsf(triangle->edge_a[e]) + fabsf(triangle->edge_b[e]));
+    }
+    f32 plane_offset = 0.5f * (fabsf(plane->dx) + fabsf(plane->dy));
+
+    i32 start_x = min_x & ~3;
+    for (i32 y = min_y; y < max_y; y++) {
+        f32 py = (f32)y + 0.5f;
+        __m128 edge_row[3];
+        for (u32 e = 0; e < 3; e++) {
+            edge_row[e] = _mm_set1_ps(triangle->edge_b[e] * py + triangle->edge_c[e] - edge_offset[e]);
+        }
+        __m128 plane_row = _mm_set1_ps(plane->dy * py + plane->c - plane_offset);
+        f32 *depth_row = buffer->depth + (usize)y * buffer->width;
+
+        for (i32 x = start_x; x < max_x; x += 4) {
+            __m128 px = _mm_add_ps(_mm_set1_ps((f32)x), lane_offsets);
+
+            __m128 mask = _mm_and_ps(_mm_cmpge_ps(px, span_min), _mm_cmplt_ps(px, span_max));
+            for (u32 e = 0; e < 3; e++) {
+                __m128 value = _mm_add_ps(_mm_mul_ps(edge_a[e], px), edge_row[e]);
+                __m128 inside = _mm_or_ps(_mm_cmpgt_ps(value, zero),
+                                          _mm_and_ps(_mm_cmpeq_ps(value, zero), zero_ok[e]));
+                mask = _mm_and_ps(mask, inside);
+            }
+            if (_mm_movemask_ps(mask) == 0) {
+                continue;
+            }
+
+            __m128 inv_w = _mm_add_ps(_mm_mul_ps(plane_dx, px), plane_row);
+            __m128 old_depth = _mm_loadu_ps(depth_row + x);
+            __m128 nearest = _mm_max_ps(old_depth, inv_w);
+            _mm_storeu_ps(depth_row + x, _mm_or_ps(_mm_and_ps(mask, nearest), _mm_andnot_ps(mask, old_depth)));
+        }
+    }
+}
+
+#else
+
+static void tf_occlusion_rasterize_triangle(TF_OcclusionBuffer *buffer, const TF_SWTriangle *triangle,
+                                            i32 min_x, i32 min_y, i32 max_x, i32 max_y) {
+    const TF_SWPlane *plane = &triangle->planes[TF_SW_PLANE_INV_W];
+    f32 edge_offset[3];
+    for (u32 e = 0; e < 3; e++) {
+        edge_offset[e] = 0.5f * (fabsf(triangle->edge_a[e]) + fabsf(triangle->edge_b[e]));
+    }
+    f32 plane_offset = 0.5f * (fabsf(plane->dx) + fabsf(plane->dy));
+
+    for (i32 y = min_y; y < max_y; y++) {
+        f32 py = (f32)y + 0.5f;
+        f32 *depth_row = buffer->depth + (usize)y * buffer->width;
+
+        for (i32 x = min_x; x < max_x; x++) {
+            f32 px = (f32)x + 0.5f;
+
+            b32 inside = TF_TRUE;
+            for (u32 e = 0; e < 3 && inside; e++) {
+                f32 value = triangle->edge_a[e] * px + (triangle->edge_b[e] * py + triangle->edge_c[e]) -
+                            edge_offset[e];
+                inside = value > 0.0f || (value == 0.0f && (triangle->top_left & (1u << e)));
+            }
+            if (!inside) {
+                continue;
+            }
+
+            f32 inv_w = plane->dx * px + (plane->dy * py + plane->c) - plane_offset;
+            if (inv_w > depth_row[x]) {
+                depth_row[x] = inv_w;
+            }
+        }
+    }
+}
+
+#endif
+
+#if TF_OCCLUSION_SSE2
+
+static f32 tf_occlusion_block_farthest(const f32 *block, u32 pitch) {
+    __m128 farthest = _mm_loadu_ps(block);
+    for (u32 y = 0; y < TF_OCCLUSION_BLOCK_SIZE; y++) {
+        for (u32 x = 0; x < TF_OCCLUSION_BLOCK_SIZE; x += 4) {
+            farthest = _mm_min_ps(farthest, _mm_loadu_ps(block + (usize)y * pitch + x));
+        }
+    }
+    farthest = _mm_min_ps(farthest, _mm_shuffle_ps(farthest, farthest, _MM_SHUFFLE(1, 0, 3, 2)));
+    farthest = _mm_min_ps(farthest, _mm_shuffle_ps(farthest, farthest, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtss_f32(farthest);
+}
+
+#else
+
+static f32 tf_occlusion_block_farthest(const f32 *block, u32 pitch) {
+    f32 farthest = block[0];
+    for (u32 y = 0; y < TF_OCCLUSION_BLOCK_SIZE; y++) {
+        for (u32 x = 0; x < TF_OCCLUSION_BLOCK_SIZE; x++) {
+            f32 value = block[(usize)y * pitch + x];
+            farthest = value < farthest ? value : farthest;
+        }
+    }
+    return farthest;
+}
+
+#endif
+
+// Clear one tile, rasterize its bin, then refresh the farthest depth of its blocks
+static void tf_occlusion_raster_tile(void *user_data, u32 task) {
+    TF_OcclusionBuffer *buffer = (TF_OcclusionBuffer *)user_data;
+    i32 min_x = (i32)((task % buffer->tiles_x) * TF_OCCLUSION_TILE_SIZE);
+    i32 min_y = (i32)((task / buffer->tiles_x) * TF_OCCLUSION_TILE_SIZE);
+    i32 max_x = min_x + TF_OCCLUSION_TILE_SIZE;
+    i32 max_y = min_y + TF_OCCLUSION_TILE_SIZE;
+    if (max_x > (i32)buffer->width) max_x = (i32)buffer->width;
+    if (max_y > (i32)buffer->height) max_y = (i32)buffer->height;
+
+    for (i32 y = min_y; y < max_y; y++) {
+        memset(buffer->depth + (usize)y * buffer->width + min_x, 0, sizeof(f32) * (usize)(max_x - min_x));
+    }
+
+    const TF_OcclusionBin *bin = &buffer->bins[task];
+    for (u32 i = 0; i < bin->count; i++) {
+        const TF_SWTriangle *triangle = &buffer->triangles[bin->triangles[i]];
+        i32 x0 = triangle->min_x > min_x ? triangle->min_x : min_x;
+        i32 y0 = triangle->min_y > min_y ? triangle->min_y : min_y;
+        i32 x1 = triangle->max_x < max_x ? triangle->max_x : max_x;
+        i32 y1 = triangle->max_y < max_y ? triangle->max_y : max_y;
+        if (x0 < x1 && y0 < y1) {
+            tf_occlusion_rasterize_triangle(buffer, triangle, x0, y0, x1, y1);
+        }
+    }
+
+    for (i32 by = min_y / TF_OCCLUSION_BLOCK_SIZE; by < max_y / TF_OCCLUSION_BLOCK_SIZE; by++) {
+        for (i32 bx = min_x / TF_OCCLUSION_BLOCK_SIZE; bx < max_x / TF_OCCLUSION_BLOCK_SIZE; bx++) {
+            const f32 *block = buffer->depth + (usize)by * TF_OCCLUSION_BLOCK_SIZE * buffer->width +
+                               (usize)bx * TF_OCCLUSION_BLOCK_SIZE;
+            buffer->block_depth[by * (i32)buffer->blocks_x + bx] = tf_occlusion_block_farthest(block, buffer->width);
+        }
+    }
+}
+
+TF_API void tf_occlusion_buffer_rasterize(TF_OcclusionBuffer *buffer) {
+    if (!buffer) {
+        return;
+    }
+
+    f64 start = tf_time_get_current();
+    tf_sw_workers_run(buffer->workers, tf_occlusion_raster_tile, buffer, buffer->tiles_x * buffer->tiles_y);
+    buffer->stats.rasterize_ms = (f32)((tf_time_get_current() - start) * 1000.0);
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+// TF_TRUE when a pixel of the rectangle is no nearer than limit
+static b32 tf_occlusion_rect_visible(const TF_OcclusionBuffer *buffer, i32 min_x, i32 min_y, i32 max_x, i32 max_y,
+                                     f32 limit) {
+#if TF_OCCLUSION_SSE2
+    const __m128i lanes = _mm_set_epi32(3, 2, 1, 0);
+    const __m128i span_min = _mm_set1_epi32(min_x - 1);
+    const __m128i span_max = _mm_set1_epi32(max_x);
+    const __m128 limit4 = _mm_set1_ps(limit);
+    for (i32 y = min_y; y < max_y; y++) {
+        const f32 *depth_row = buffer->depth + (usize)y * buffer->width;
+        for (i32 x = min_x & ~3; x < max_x; x += 4) {
+            __m128i lane_x = _mm_add_epi32(_mm_set1_epi32(x), lanes);
+            __m128i in_span = _mm_and_si128(_mm_cmpgt_epi32(lane_x, span_min), _mm_cmplt_epi32(lane_x, span_max));
+            __m128 behind = _mm_cmple_ps(_mm_loadu_ps(depth_row + x), limit4);
+            if (_mm_movemask_ps(_mm_and_ps(behind, _mm_castsi128_ps(in_span)))) {
+                return TF_TRUE;
+            }
+        }
+    }
+#else
+    for (i32 y = min_y; y < max_y; y++) {
+        const f32 *depth_row = buffer->depth + (usize)y * buffer->width;
+        for (i32 x = min_x; x < max_x; x++) {
+            if (depth_row[x] <= limit) {
+                return TF_TRUE;
+            }
+        }
+    }
+#endif
+    return TF_FALSE;
+}
+
+TF_API b32 tf_occlusion_buffer_test_box(const TF_OcclusionBuffer *buffer, TF_Vec3 center, TF_Vec3 extents) {
+    if (!buffer) {
+        return TF_TRUE;
+    }
+
+    // Screen rectangle and nearest 1/w of the eight corners. The projection is
+    // linear, so corners are the projected center plus or minus each projected
+    // half axis.
+    const TF_Mat4 *m = &buffer->view_projection;
+    TF_Vec4 clip_center = tf_mat4_multiply_vec4(*m, (TF_Vec4){center.x, center.y, center.z, 1.0f});
+    TF_Vec4 axis_x = tf_vec4_scale((TF_Vec4){m->m[0], m->m[1], m->m[2], m->m[3]}, extents.x);
+    TF_Vec4 axis_y = tf_vec4_scale((TF_Vec4){m->m[4], m->m[5], m->m[6], m->m[7]}, extents.y);
+    TF_Vec4 axis_z = tf_vec4_scale((TF_Vec4){m->m[8], m->m[9], m->m[10], m->m[11]}, extents.z);
+
+    f32 min_x = INFINITY, min_y = INFINITY, max_x = -INFINITY, max_y = -INFINITY;
+    f32 nearest = 0.0f;
+    for (u32 corner = 0; corner < 8; corner++) {
+        TF_Vec4 clip = clip_center;
+        clip = (corner & 1) ? tf_vec4_add(clip, axis_x) : tf_vec4_sub(clip, axis_x);
+        clip = (corner & 2) ? tf_vec4_add(clip, axis_y) : tf_vec4_sub(clip, axis_y);
+        clip = (corner & 4) ? tf_vec4_add(clip, axis_z) : tf_vec4_sub(clip, axis_z);
+        if (clip.w <= 0.0f || clip.z < -clip.w) {
+            return TF_TRUE;
+        }
+
+        f32 inv_w = 1.0f / clip.w;
+        f32 screen_x = (clip.x * inv_w * 0.5f + 0.5f) * (f32)buffer->width;
+        f32 screen_y = (clip.y * inv_w * 0.5f + 0.5f) * (f32)buffer->height;
+        min_x = fminf(min_x, screen_x);
+        min_y = fminf(min_y, screen_y);
+        max_x = fmaxf(max_x, screen_x);
+        max_y = fmaxf(max_y, screen_y);
+        nearest = fmaxf(nearest, inv_w);
+    }
+
+    // Every pixel the box's projection touches, clamped to the buffer
+    i32 x0 = min_x > 0.0f ? (i32)floorf(min_x) : 0;
+    i32 y0 = min_y > 0.0f ? (i32)floorf(min_y) : 0;
+    i32 x1 = max_x < (f32)buffer->width ? (i32)ceilf(max_x) : (i32)buffer->width;
+    i32 y1 = max_y < (f32)buffer->height ? (i32)ceilf(max_y) : (i32)buffer->height;
+    if (x0 >= x1 || y0 >= y1) {
+        return TF_FALSE;
+    }
+
+    // Blocks entirely nearer than the box hide their part of it without
+    // looking at their pixels
+    f32 limit = nearest * (1.0f + TF_OCCLUSION_DEPTH_BIAS);
+    for (i32 by = y0 / TF_OCCLUSION_BLOCK_SIZE; by <= (y1 - 1) / TF_OCCLUSION_BLOCK_SIZE; by++) {
+        for (i32 bx = x0 / TF_OCCLUSION_BLOCK_SIZE; bx <= (x1 - 1) / TF_OCCLUSION_BLOCK_SIZE; bx++) {
+            if (buffer->block_depth[by * (i32)buffer->blocks_x + bx] > limit) {
+                continue;
+            }
+
+            i32 block_x0 = bx * TF_OCCLUSION_BLOCK_SIZE;
+            i32 block_y0 = by * TF_OCCLUSION_BLOCK_SIZE;
+            i32 rect_x0 = x0 > block_x0 ? x0 : block_x0;
+            i32 rect_y0 = y0 > block_y0 ? y0 : block_y0;
+            i32 rect_x1 = x1 < block_x0 + TF_OCCLUSION_BLOCK_SIZE ? x1 : block_x0 + TF_OCCLUSION_BLOCK_SIZE;
+            i32 rect_y1 = y1 < block_y0 + TF_OCCLUSION_BLOCK_SIZE ? y1 : block_y0 + TF_OCCLUSION_BLOCK_SIZE;
+            if (tf_occlusion_rect_visible(buffer, rect_x0, rect_y0, rect_x1, rect_y1, limit)) {
+                return TF_TRUE;
+            }
+        }
+    }
+    return TF_FALSE;
+}
+
+TF_API TF_OcclusionStats tf_occlusion_buffer_get_stats(const TF_OcclusionBuffer *buffer) {
+    if (!buffer) {
+        return (TF_OcclusionStats){0};
+    }
+    return buffer->stats;
+}
+
+TF_API const f32 *tf_occlusion_buffer_get_depth(const TF_OcclusionBuffer *buffer, u32 *width, u32 *height) {
+    if (!buffer) {
+        return NULL;
+    }
+
+    if (width) *width = buffer->width;
+    if (height) *height = buffer->height;
+    return buffer->depth;
+}
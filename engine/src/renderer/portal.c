@@ -0,0 +1,682 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "tunafish/renderer/portal.h"
+#include "tunafish/renderer/camera.h"
+#include "tunafish/core/log.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Vertices a portal can grow to while being clipped during baking
+#define TF_PORTAL_CLIP_VERTICES 32
+
+// Portal chains longer than this are not clipped any further while baking;
+// everything reachable past them counts as visible
+#define TF_PORTAL_MAX_CHAIN 64
+
+// Distances below this count as on a plane
+#define TF_PORTAL_EPSILON 0.0001f
+
+typedef struct {
+    TF_Vec3 min, max;
+    u32 *portals; // Portals touching the cell
+    u32 portal_count;
+    u32 portal_capacity;
+} TF_PortalCell;
+
+typedef struct {
+    u32 cells[2];
+    TF_Vec3 vertices[TF_PORTAL_MAX_VERTICES];
+    u32 vertex_count;
+    TF_Vec4 plane; // Facing from cells[0] into cells[1]
+} TF_Portal;
+
+// Convex polygon being clipped
+typedef struct {
+    TF_Vec3 vertices[TF_PORTAL_CLIP_VERTICES];
+    u32 count;
+} TF_PortalWinding;
+
+struct TF_PortalGraph {
+    TF_PortalCell *cells;
+    u32 cell_count;
+    u32 cell_capacity;
+    TF_Portal *portals;
+    u32 portal_count;
+    u32 portal_capacity;
+
+    // Potentially visible sets, pvs_words per cell
+    u32 *pvs;
+    u32 pvs_words;
+    b32 baked;
+
+    // Traversal scratch, one entry per cell
+    TF_Vec4 *rects; // Screen bounds each cell is seen through: min x, min y, max x, max y
+    u8 *reached;
+    u8 *queued;
+    u32 *stack;
+    u32 *order;
+    u32 scratch_capacity;
+
+    TF_PortalStats stats;
+};
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+TF_API TF_PortalGraph *tf_portal_graph_create(void) {
+    TF_PortalGraph *graph = calloc(1, sizeof(TF_PortalGraph));
+    if (!graph) {
+        TF_ERROR("Failed to allocate portal graph");
+        return NULL;
+    }
+    return graph;
+}
+
+TF_API void tf_portal_graph_destroy(TF_PortalGraph *graph) {
+    if (!graph) {
+        return;
+    }
+
+    for (u32 i = 0; i < graph->cell_count; i++) {
+        free(graph->cells[i].portals);
+    }
+    free(graph->cells);
+    free(graph->portals);
+    free(graph->pvs);
+    free(graph->rects);
+    free(graph->reached);
+    free(graph->queued);
+    free(graph->stack);
+    free(graph->order);
+    free(graph);
+}
+
+// =============================================================================
+// Building
+// =============================================================================
+
+static void tf_portal_graph_invalidate(TF_PortalGraph *graph) {
+    free(graph->pvs);
+    graph->pvs = NULL;
+    graph->pvs_words = 0;
+    graph->baked = TF_FALSE;
+}
+
+TF_API u32 tf_portal_graph_add_cell(TF_PortalGraph *graph, TF_Vec3 min, TF_Vec3 max) {
+    if (!graph) {
+        return TF_CELL_NONE;
+    }
+
+    if (min.x > max.x || min.y > max.y || min.z > max.z) {
+        TF_ERROR("Cell bounds are inverted");
+        return TF_CELL_NONE;
+    }
+
+    if (graph->cell_count == graph->cell_capacity) {
+        u32 capacity = graph->cell_capacity ? graph->cell_capacity * 2 : 16;
+        TF_PortalCell *cells = realloc(graph->cells, sizeof(TF_PortalCell) * capacity);
+        if (!cells) {
+            TF_ERROR("Failed to grow portal graph to %u cells", capacity);
+            return TF_CELL_NONE;
+        }
+        graph->cells = cells;
+        graph->cell_capacity = capacity;
+    }
+
+    tf_portal_graph_invalidate(graph);
+    u32 cell = graph->cell_count++;
+    graph->cells[cell] = (TF_PortalCell){min, max, NULL, 0, 0};
+    return cell;
+}
+
+static b32 tf_portal_cell_reserve(TF_PortalCell *cell) {
+    if (cell->portal_count == cell->portal_capacity) {
+        u32 capacity = cell->portal_capacity ? cell->portal_capacity * 2 : 4;
+        u32 *portals = realloc(cell->portals, sizeof(u32) * capacity);
+        if (!portals) {
+            TF_ERROR("Failed to grow cell portal list");
+            return TF_FALSE;
+        }
+        cell->portals = portals;
+        cell->portal_capacity = capacity;
+    }
+    return TF_TRUE;
+}
+
+static f32 tf_portal_plane_distance(TF_Vec4 plane, TF_Vec3 point) {
+    return plane.x * point.x + plane.y * point.y + plane.z * point.z + plane.w;
+}
+
+TF_API b32 tf_portal_graph_add_portal(TF_PortalGraph *graph, u32 cell_a, u32 cell_b, const TF_Vec3 *vertices,
+                                      u32 vertex_count) {
+    if (!graph || !vertices) {
+        return TF_FALSE;
+    }
+
+    if (cell_a >= graph->cell_count || cell_b >= graph->cell_count || cell_a == cell_b) {
+        TF_ERROR("Portal must join two different cells (%u, %u of %u)", cell_a, cell_b, graph->cell_count);
+        return TF_FALSE;
+    }
+
+    if (vertex_count < 3 || vertex_count > TF_PORTAL_MAX_VERTICES) {
+        TF_ERROR("Portal needs 3 to %u vertices, got %u", TF_PORTAL_MAX_VERTICES, vertex_count);
+        return TF_FALSE;
+    }
+
+    // Newell's method, which tolerates slightly non-planar input
+    TF_Vec3 normal = tf_vec3_create(0.0f, 0.0f, 0.0f);
+    TF_Vec3 centroid = tf_vec3_create(0.0f, 0.0f, 0.0f);
+    for (u32 i = 0; i < vertex_count; i++) {
+        TF_Vec3 a = vertices[i];
+        TF_Vec3 b = vertices[(i + 1) % vertex_count];
+        normal.x += (a.y - b.y) * (a.z + b.z);
+        normal.y += (a.z - b.z) * (a.x + b.x);
+        normal.z += (a.x - b.x) * (a.y + b.y);
+        centroid = tf_vec3_add(centroid, a);
+    }
+    f32 length = tf_vec3_length(normal);
+    if (length <= TF_PORTAL_EPSILON) {
+        TF_ERROR("Portal polygon is degenerate");
+        return TF_FALSE;
+    }
+    normal = tf_vec3_scale(normal, 1.0f / length);
+    centroid = tf_vec3_scale(centroid, 1.0f / (f32)vertex_count);
+
+    TF_PortalCell *a = &graph->cells[cell_a];
+    TF_PortalCell *b = &graph->cells[cell_b];
+    if (!tf_portal_cell_reserve(a) || !tf_portal_cell_reserve(b)) {
+        return TF_FALSE;
+    }
+
+    if (graph->portal_count == graph->portal_capacity) {
+        u32 capacity = graph->portal_capacity ? graph->portal_capacity * 2 : 16;
+        TF_Portal *portals = realloc(graph->portals, sizeof(TF_Portal) * capacity);
+        if (!portals) {
+            TF_ERROR("Failed to grow portal graph to %u portals", capacity);
+            return TF_FALSE;
+        }
+        graph->portals = portals;
+        graph->portal_capacity = capacity;
+    }
+
+    TF_Portal *portal = &graph->portals[graph->portal_count];
+    portal->cells[0] = cell_a;
+    portal->cells[1] = cell_b;
+    memcpy(portal->vertices, vertices, sizeof(TF_Vec3) * vertex_count);
+    portal->vertex_count = vertex_count;
+    portal->plane = (TF_Vec4){normal.x, normal.y, normal.z, -tf_vec3_dot(normal, centroid)};
+
+    // Face away from the first cell
+    if (tf_portal_plane_distance(portal->plane, tf_vec3_scale(tf_vec3_add(a->min, a->max), 0.5f)) > 0.0f) {
+        portal->plane = tf_vec4_scale(portal->plane, -1.0f);
+    }
+
+    a->portals[a->portal_count++] = graph->portal_count;
+    b->portals[b->portal_count++] = graph->portal_count;
+    graph->portal_count++;
+    tf_portal_graph_invalidate(graph);
+    return TF_TRUE;
+}
+
+TF_API u32 tf_portal_graph_get_cell_count(const TF_PortalGraph *graph) {
+    return graph ? graph->cell_count : 0;
+}
+
+TF_API u32 tf_portal_graph_find_cell(const TF_PortalGraph *graph, TF_Vec3 point) {
+    if (!graph) {
+        return TF_CELL_NONE;
+    }
+
+    for (u32 i = 0; i < graph->cell_count; i++) {
+        const TF_PortalCell *cell = &graph->cells[i];
+        if (point.x >= cell->min.x && point.x <= cell->max.x && point.y >= cell->min.y && point.y <= cell->max.y &&
+            point.z >= cell->min.z && point.z <= cell->max.z) {
+            return i;
+        }
+    }
+    return TF_CELL_NONE;
+}
+
+// The cell on the other side of portal, and its plane facing into that cell
+static u32 tf_portal_traverse(const TF_Portal *portal, u32 from, TF_Vec4 *plane) {
+    if (portal->cells[0] == from) {
+        *plane = portal->plane;
+        return portal->cells[1];
+    }
+    *plane = tf_vec4_scale(portal->plane, -1.0f);
+    return portal->cells[0];
+}
+
+// =============================================================================
+// Baking
+// =============================================================================
+
+// Keep the part of winding in front of plane (on it counts). Returns TF_FALSE
+// once nothing is left. A result with too many vertices is not clipped, which
+// keeps it conservative.
+static b32 tf_portal_winding_clip(TF_PortalWinding *winding, TF_Vec4 plane) {
+    f32 distances[TF_PORTAL_CLIP_VERTICES];
+    u32 front = 0, back = 0;
+    for (u32 i = 0; i < winding->count; i++) {
+        distances[i] = tf_portal_plane_distance(plane, winding->vertices[i]);
+        front += distances[i] > TF_PORTAL_EPSILON;
+        back += distances[i] < -TF_PORTAL_EPSILON;
+    }
+    if (back == 0) {
+        return TF_TRUE;
+    }
+    if (front == 0) {
+        winding->count = 0;
+        return TF_FALSE;
+    }
+
+    TF_PortalWinding clipped;
+    clipped.count = 0;
+    for (u32 i = 0; i < winding->count; i++) {
+        u32 j = (i + 1) % winding->count;
+        TF_Vec3 a = winding->vertices[i];
+        f32 da = distances[i];
+        f32 db = distances[j];
+        if (clipped.count + 2 > TF_PORTAL_CLIP_VERTICES) {
+            return TF_TRUE;
+        }
+        if (da >= -TF_PORTAL_EPSILON) {
+            clipped.vertices[clipped.count++] = a;
+        }
+        if ((da > TF_PORTAL_EPSILON && db < -TF_PORTAL_EPSILON) ||
+            (da < -TF_PORTAL_EPSILON && db > TF_PORTAL_EPSILON)) {
+            TF_Vec3 b = winding->vertices[j];
+            clipped.vertices[clipped.count++] = tf_vec3_add(a, tf_vec3_scale(tf_vec3_sub(b, a), da / (da - db)));
+        }
+    }
+
+    *winding = clipped;
+    return winding->count >= 3;
+}
+
+// Every line leaving source through pass stays in front of a plane through an
+// edge of one and a vertex of the other that puts source behind it and pass
+// in front. Clip target to each such plane.
+static b32 tf_portal_clip_to_separators(const TF_PortalWinding *source, const TF_PortalWinding *pass,
+                                        TF_PortalWinding *target) {
+    for (u32 flip = 0; flip < 2; flip++) {
+        const TF_PortalWinding *edges = flip ? pass : source;
+        const TF_PortalWinding *points = flip ? source : pass;
+
+        for (u32 i = 0; i < edges->count; i++) {
+            TF_Vec3 e0 = edges->vertices[i];
+            TF_Vec3 e1 = edges->vertices[(i + 1) % edges->count];
+            for (u32 j = 0; j < points->count; j++) {
+                TF_Vec3 normal = tf_vec3_cross(tf_vec3_sub(e1, e0), tf_vec3_sub(points->vertices[j], e0));
+                f32 length = tf_vec3_length(normal);
+                if (length <= TF_PORTAL_EPSILON) {
+                    continue;
+                }
+                normal = tf_vec3_scale(normal, 1.0f / length);
+                TF_Vec4 plane = {normal.x, normal.y, normal.z, -tf_vec3_dot(normal, e0)};
+
+                // Source entirely on one side...
+                b32 source_front = TF_FALSE, source_back = TF_FALSE;
+                for (u32 k = 0; k < source->count; k++) {
+                    f32 d = tf_portal_plane_distance(plane, source->vertices[k]);
+                    source_front |= d > TF_PORTAL_EPSILON;
+                    source_back |= d < -TF_PORTAL_EPSILON;
+                }
+                if (source_front == source_back) {
+                    continue;
+                }
+                if (source_front) {
+                    plane = tf_vec4_scale(plane, -1.0f);
+                }
+
+                // ...and pass entirely on the other
+                b32 separates = TF_TRUE;
+                for (u32 k = 0; k < pass->count && separates; k++) {
+                    separates = tf_portal_plane_distance(plane, pass->vertices[k]) >= -TF_PORTAL_EPSILON;
+                }
+                if (separates && !tf_portal_winding_clip(target, plane)) {
+                    return TF_FALSE;
+                }
+            }
+        }
+    }
+    return TF_TRUE;
+}
+
+static void tf_portal_pvs_set(TF_PortalGraph *graph, u32 from, u32 to) {
+    graph->pvs[from * graph->pvs_words + to / 32] |= 1u << (to % 32);
+}
+
+// Mark every cell reachable from cell at all, for chains too long to clip
+static void tf_portal_flood(TF_PortalGraph *graph, u32 source_cell, u32 cell) {
+    u32 *stack = graph->stack;
+    u32 count = 0;
+    memset(graph->reached, 0, graph->cell_count);
+    graph->reached[cell] = 1;
+    stack[count++] = cell;
+    while (count > 0) {
+        u32 current = stack[--count];
+        tf_portal_pvs_set(graph, source_cell, current);
+        const TF_PortalCell *c = &graph->cells[current];
+        for (u32 i = 0; i < c->portal_count; i++) {
+            TF_Vec4 plane;
+            u32 next = tf_portal_traverse(&graph->portals[c->portals[i]], current, &plane);
+            if (!graph->reached[next]) {
+                graph->reached[next] = 1;
+                stack[count++] = next;
+            }
+        }
+    }
+}
+
+typedef struct {
+    u32 source_cell;
+    TF_PortalWinding source;
+    TF_Vec4 source_plane;
+} TF_PortalFlow;
+
+// Follow every portal of cell that some line through the source and pass
+// windings can still reach, marking the cells behind them. Cells are convex,
+// so a line never enters one twice and cells already on the chain (flagged in
+// queued) are skipped.
+static void tf_portal_flow(TF_PortalGraph *graph, TF_PortalFlow *flow, u32 depth, u32 cell,
+                           const TF_PortalWinding *pass, TF_Vec4 pass_plane) {
+    const TF_PortalCell *c = &graph->cells[cell];
+    for (u32 i = 0; i < c->portal_count; i++) {
+        const TF_Portal *portal = &graph->portals[c->portals[i]];
+        TF_Vec4 target_plane;
+        u32 next = tf_portal_traverse(portal, cell, &target_plane);
+        if (graph->queued[next]) {
+            continue;
+        }
+
+        TF_PortalWinding target;
+        memcpy(target.vertices, portal->vertices, sizeof(TF_Vec3) * portal->vertex_count);
+        target.count = portal->vertex_count;
+        if (!tf_portal_winding_clip(&target, flow->source_plane) || !tf_portal_winding_clip(&target, pass_plane)) {
+            continue;
+        }
+        if (depth > 1 && !tf_portal_clip_to_separators(&flow->source, pass, &target)) {
+            continue;
+        }
+
+        if (depth == TF_PORTAL_MAX_CHAIN) {
+            tf_portal_flood(graph, flow->source_cell, next);
+            continue;
+        }
+
+        tf_portal_pvs_set(graph, flow->source_cell, next);
+        graph->queued[next] = 1;
+        tf_portal_flow(graph, flow, depth + 1, next, &target, target_plane);
+        graph->queued[next] = 0;
+    }
+}
+
+static b32 tf_portal_graph_reserve_scratch(TF_PortalGraph *graph) {
+    if (graph->scratch_capacity >= graph->cell_count) {
+        return TF_TRUE;
+    }
+
+    u32 capacity = graph->cell_capacity;
+    TF_Vec4 *rects = realloc(graph->rects, sizeof(TF_Vec4) * capacity);
+    if (rects) graph->rects = rects;
+    u8 *reached = realloc(graph->reached, capacity);
+    if (reached) graph->reached = reached;
+    u8 *queued = realloc(graph->queued, capacity);
+    if (queued) graph->queued = queued;
+    u32 *stack = realloc(graph->stack, sizeof(u32) * capacity);
+    if (stack) graph->stack = stack;
+    u32 *order = realloc(graph->order, sizeof(u32) * capacity);
+    if (order) graph->order = order;
+    if (!rects || !reached || !queued || !stack || !order) {
+        TF_ERROR("Failed to allocate portal traversal scratch for %u cells", capacity);
+        return TF_FALSE;
+    }
+
+    graph->scratch_capacity = capacity;
+    return TF_TRUE;
+}
+
+TF_API b32 tf_portal_graph_bake(TF_PortalGraph *graph) {
+    if (!graph) {
+        return TF_FALSE;
+    }
+
+    tf_portal_graph_invalidate(graph);
+    if (graph->cell_count == 0 || !tf_portal_graph_reserve_scratch(graph)) {
+        return graph->cell_count == 0;
+    }
+
+    graph->pvs_words = (graph->cell_count + 31) / 32;
+    graph->pvs = calloc((usize)graph->pvs_words * graph->cell_count, sizeof(u32));
+    if (!graph->pvs) {
+        TF_ERROR("Failed to allocate visibility sets for %u cells", graph->cell_count);
+        graph->pvs_words = 0;
+        return TF_FALSE;
+    }
+
+    // Anything seen from a cell is seen through one of its own portals, so
+    // flowing out through each of them in turn covers the whole set
+    TF_PortalFlow *flow = malloc(sizeof(TF_PortalFlow));
+    if (!flow) {
+        TF_ERROR("Failed to allocate portal flow state");
+        tf_portal_graph_invalidate(graph);
+        return TF_FALSE;
+    }
+
+    u64 visible_pairs = 0;
+    memset(graph->queued, 0, graph->cell_count);
+    for (u32 cell = 0; cell < graph->cell_count; cell++) {
+        tf_portal_pvs_set(graph, cell, cell);
+        graph->queued[cell] = 1;
+        const TF_PortalCell *c = &graph->cells[cell];
+        for (u32 i = 0; i < c->portal_count; i++) {
+            const TF_Portal *portal = &graph->portals[c->portals[i]];
+            u32 next = tf_portal_traverse(portal, cell, &flow->source_plane);
+            tf_portal_pvs_set(graph, cell, next);
+
+            flow->source_cell = cell;
+            memcpy(flow->source.vertices, portal->vertices, sizeof(TF_Vec3) * portal->vertex_count);
+            flow->source.count = portal->vertex_count;
+            graph->queued[next] = 1;
+            tf_portal_flow(graph, flow, 1, next, &flow->source, flow->source_plane);
+            graph->queued[next] = 0;
+        }
+        graph->queued[cell] = 0;
+
+        for (u32 other = 0; other < graph->cell_count; other++) {
+            visible_pairs += tf_portal_graph_can_see(graph, cell, other);
+        }
+    }
+    free(flow);
+
+    graph->baked = TF_TRUE;
+    TF_DEBUG("Baked visibility for %u cells and %u portals (%.1f visible cells per cell)", graph->cell_count,
+             graph->portal_count, (f64)visible_pairs / (f64)graph->cell_count);
+    return TF_TRUE;
+}
+
+TF_API b32 tf_portal_graph_is_baked(const TF_PortalGraph *graph) {
+    return graph && graph->baked;
+}
+
+TF_API b32 tf_portal_graph_can_see(const TF_PortalGraph *graph, u32 from, u32 to) {
+    if (!graph || from >= graph->cell_count || to >= graph->cell_count) {
+        return TF_FALSE;
+    }
+    if (!graph->pvs) {
+        return TF_TRUE;
+    }
+    return (graph->pvs[from * graph->pvs_words + to / 32] >> (to % 32)) & 1u;
+}
+
+// =============================================================================
+// Traversal
+// =============================================================================
+
+// Screen bounds of a portal in normalized device coordinates, clipped to the
+// part in front of the camera. Returns TF_FALSE when none of it is.
+static b32 tf_portal_project(const TF_Portal *portal, const TF_Mat4 *view_projection, TF_Vec4 *bounds) {
+    TF_Vec4 clip[TF_PORTAL_MAX_VERTICES];
+    for (u32 i = 0; i < portal->vertex_count; i++) {
+        TF_Vec3 p = portal->vertices[i];
+        clip[i] = tf_mat4_multiply_vec4(*view_projection, (TF_Vec4){p.x, p.y, p.z, 1.0f});
+    }
+
+    // Only what lies in front of the camera (w > 0) projects; the part
+    // between the camera and the near plane still leads into the next cell
+    f32 min_x = INFINITY, min_y = INFINITY, max_x = -INFINITY, max_y = -INFINITY;
+    b32 any = TF_FALSE;
+    for (u32 i = 0; i < portal->vertex_count; i++) {
+        TF_Vec4 a = clip[i];
+        TF_Vec4 b = clip[(i + 1) % portal->vertex_count];
+        f32 da = a.w - TF_PORTAL_EPSILON;
+        f32 db = b.w - TF_PORTAL_EPSILON;
+
+        TF_Vec4 points[2];
+        u32 count = 0;
+        if (da >= 0.0f) {
+            points[count++] = a;
+        }
+        if ((da >= 0.0f) != (db >= 0.0f)) {
+            points[count++] = tf_vec4_add(a, tf_vec4_scale(tf_vec4_sub(b, a), da / (da - db)));
+        }
+        for (u32 j = 0; j < count; j++) {
+            f32 x = points[j].x / points[j].w;
+            f32 y = points[j].y / points[j].w;
+            min_x = fminf(min_x, x);
+            min_y = fminf(min_y, y);
+            max_x = fmaxf(max_x, x);
+            max_y = fmaxf(max_y, y);
+            any = TF_TRUE;
+        }
+    }
+
+    *bounds = (TF_Vec4){min_x, min_y, max_x, max_y};
+    return any;
+}
+
+// The camera frustum narrowed to a rectangle of normalized device coordinates
+static TF_Frustum tf_portal_scissor_frustum(const TF_Mat4 *view_projection, TF_Vec4 rect) {
+    TF_Mat4 scissor = tf_mat4_identity();
+    scissor.m[0] = 2.0f / (rect.z - rect.x);
+    scissor.m[5] = 2.0f / (rect.w - rect.y);
+    scissor.m[12] = -(rect.x + rect.z) / (rect.z - rect.x);
+    scissor.m[13] = -(rect.y + rect.w) / (rect.w - rect.y);
+    return tf_frustum_from_matrix(tf_mat4_multiply(scissor, *view_projection));
+}
+
+TF_API u32 tf_portal_graph_find_visible(TF_PortalGraph *graph, const TF_Camera *camera, TF_VisibleCell *cells,
+                                        u32 max_cells) {
+    if (!graph || !camera) {
+        return 0;
+    }
+
+    graph->stats = (TF_PortalStats){0};
+    if (!tf_portal_graph_reserve_scratch(graph)) {
+        return 0;
+    }
+
+    TF_Mat4 view_projection = tf_mat4_multiply(tf_camera_get_projection_matrix(camera),
+                                               tf_camera_get_view_matrix(camera));
+    TF_Vec3 eye = tf_camera_get_position(camera);
+    const TF_Vec4 full = {-1.0f, -1.0f, 1.0f, 1.0f};
+
+    u32 start = tf_portal_graph_find_cell(graph, eye);
+    u32 visible = 0;
+    if (start == TF_CELL_NONE) {
+        for (u32 i = 0; i < graph->cell_count; i++) {
+            graph->order[visible++] = i;
+            graph->rects[i] = full;
+        }
+    } else {
+        memset(graph->reached, 0, graph->cell_count);
+        memset(graph->queued, 0, graph->cell_count);
+        graph->reached[start] = 1;
+        graph->rects[start] = full;
+        graph->order[visible++] = start;
+
+        // Rectangles only grow, and only ever take values from the portal
+        // bounds, so cells are queued again a bounded number of times
+        u32 stack_count = 0;
+        graph->stack[stack_count++] = start;
+        graph->queued[start] = 1;
+        while (stack_count > 0) {
+            u32 cell = graph->stack[--stack_count];
+            graph->queued[cell] = 0;
+            TF_Vec4 rect = graph->rects[cell];
+
+            const TF_PortalCell *c = &graph->cells[cell];
+            for (u32 i = 0; i < c->portal_count; i++) {
+                const TF_Portal *portal = &graph->portals[c->portals[i]];
+                TF_Vec4 plane;
+                u32 next = tf_portal_traverse(portal, cell, &plane);
+                if (graph->pvs && !tf_portal_graph_can_see(graph, start, next)) {
+                    graph->stats.portals_skipped++;
+                    continue;
+                }
+                graph->stats.portals_tested++;
+
+                // Seen from (almost) within its plane a portal projects to
+                // nothing, but looking along the doorway sees both sides
+                TF_Vec4 bounds = rect;
+                if (fabsf(tf_portal_plane_distance(plane, eye)) > TF_PORTAL_EPSILON) {
+                    if (tf_portal_plane_distance(plane, eye) > 0.0f ||
+                        !tf_portal_project(portal, &view_projection, &bounds)) {
+                        continue; // Behind the camera, or seen from the far side
+                    }
+                    bounds.x = fmaxf(bounds.x, rect.x);
+                    bounds.y = fmaxf(bounds.y, rect.y);
+                    bounds.z = fminf(bounds.z, rect.z);
+                    bounds.w = fminf(bounds.w, rect.w);
+                    if (bounds.x >= bounds.z || bounds.y >= bounds.w) {
+                        continue;
+                    }
+                }
+
+                TF_Vec4 *existing = &graph->rects[next];
+                if (!graph->reached[next]) {
+                    graph->reached[next] = 1;
+                    *existing = bounds;
+                    graph->order[visible++] = next;
+                } else if (bounds.x < existing->x || bounds.y < existing->y || bounds.z > existing->z ||
+                           bounds.w > existing->w) {
+                    existing->x = fminf(existing->x, bounds.x);
+                    existing->y = fminf(existing->y, bounds.y);
+                    existing->z = fmaxf(existing->z, bounds.z);
+                    existing->w = fmaxf(existing->w, bounds.w);
+                } else {
+                    continue;
+                }
+                if (!graph->queued[next]) {
+                    graph->queued[next] = 1;
+                    graph->stack[stack_count++] = next;
+                }
+            }
+        }
+    }
+
+    graph->stats.cells_visible = visible;
+    u32 written = visible < max_cells ? visible : max_cells;
+    for (u32 i = 0; i < written; i++) {
+        u32 cell = graph->order[i];
+        TF_Vec4 rect = graph->rects[cell];
+        cells[i].cell = cell;
+        cells[i].frustum = tf_portal_scissor_frustum(&view_projection, rect);
+        cells[i].min_x = rect.x;
+        cells[i].min_y = rect.y;
+        cells[i].max_x = rect.z;
+        cells[i].max_y = rect.w;
+    }
+    return visible;
+}
+
+TF_API TF_PortalStats tf_portal_graph_get_stats(const TF_PortalGraph *graph) {
+    if (!graph) {
+        return (TF_PortalStats){0};
+    }
+    return graph->stats;
+}
@@ -3,21 +3,346 @@
 //
 #include "tunafish/renderer/renderer.h"
 #include "tunafish/renderer/backend/renderer_backend.h"
+#include "tunafish/renderer/camera.h"
+#include "tunafish/renderer/command_list.h"
+#include "tunafish/renderer/material.h"
+#include "renderer/capture.h"
+#include "renderer/command_buffer.h"
+#include "renderer/mesh_internal.h"
 #include "tunafish/renderer/backend/opengl/gl_renderer.h"
+#include "tunafish/renderer/backend/null/null_renderer.h"
+#include "tunafish/renderer/backend/software/sw_renderer.h"
+#include "tunafish/renderer/backend/threaded/threaded_renderer.h"
 #include "tunafish/core/log.h"
 #include "tunafish/core/memory.h"
 #include "tunafish/platform/window.h"
 #include <stdlib.h>
+#include <string.h>
+
+// Frames a capture readback may stay in flight before end_frame waits for it
+#define TF_RENDERER_CAPTURE_LATENCY 3
 
 // Renderer structure
 struct TF_Renderer {
     TF_RendererBackend *backend;
     TF_Camera *current_camera;
+    const TF_OcclusionBuffer *occlusion;
+    TF_ClusterCuller *cluster_culler;
+    TF_Frustum cull_frustum; // Replaces the camera's when has_cull_frustum is set
+    b32 has_cull_frustum;
     TF_RendererConfig config;
+
+    // Recorded commands (sorted into commands_scratch and back)
+    TF_CommandBuffer buffer;
+    TF_RenderCommand *commands_scratch;
+    u32 commands_scratch_capacity;
+
+    // Gathers the instances of merged mesh commands that are not contiguous
+    TF_InstanceData *instance_scratch;
+    u32 instance_scratch_capacity;
+    TF_MeshDraw *mesh_draws;
+    u32 mesh_draw_capacity;
+
+    u32 commands_replayed;
+
+    // Frame capture: readbacks in flight, oldest first
+    TF_CaptureWriter *capture;
+    u32 capture_tickets[TF_RENDERER_CAPTURE_LATENCY];
+    u32 capture_widths[TF_RENDERER_CAPTURE_LATENCY];
+    u32 capture_heights[TF_RENDERER_CAPTURE_LATENCY];
+    u32 capture_pending;
+    u32 capture_remaining; // Frames still to start, unless capture_unlimited
+    b32 capture_unlimited;
 };
 
+// =============================================================================
+// Command replay
+// =============================================================================
+
+// Stable LSD radix sort on the 64-bit keys, one byte per pass. Passes where
+// every key shares the same byte (common for layer/pass bits) are skipped.
+static void tf_renderer_sort_commands(TF_Renderer *renderer) {
+    u32 count = renderer->buffer.command_count;
+    if (count < 2) {
+        return;
+    }
+
+    // The sort swaps the two arrays, so the scratch is grown to the full
+    // command capacity (not just count) to keep both capacities in step
+    if (!tf_command_buffer_grow((void **)&renderer->commands_scratch, &renderer->commands_scratch_capacity,
+                                sizeof(TF_RenderCommand), renderer->buffer.command_capacity)) {
+        TF_WARN("Replaying %u commands unsorted", count);
+        return;
+    }
+
+    TF_RenderCommand *src = renderer->buffer.commands;
+    TF_RenderCommand *dst = renderer->commands_scratch;
+
+    for (u32 shift = 0; shift < 64; shift += 8) {
+        u32 histogram[256] = {0};
+        for (u32 i = 0; i < count; i++) {
+            histogram[(src[i].key >> shift) & 0xFF]++;
+        }
+
+        if (histogram[(src[0].key >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        u32 offset = 0;
+        for (u32 b = 0; b < 256; b++) {
+            u32 bucket_count = histogram[b];
+            histogram[b] = offset;
+            offset += bucket_count;
+        }
+
+        for (u32 i = 0; i < count; i++) {
+            dst[histogram[(src[i].key >> shift) & 0xFF]++] = src[i];
+        }
+
+        TF_RenderCommand *temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    // Keep the sorted result in the primary array
+    if (src != renderer->buffer.commands) {
+        u32 capacity = renderer->commands_scratch_capacity;
+        renderer->commands_scratch = renderer->buffer.commands;
+        renderer->commands_scratch_capacity = renderer->buffer.command_capacity;
+        renderer->buffer.commands = src;
+        renderer->buffer.command_capacity = capacity;
+    }
+}
+
+// Upload the camera block once per flush instead of per shader; without a
+// camera, shaders see identity matrices (clip space == world space)
+static void tf_renderer_upload_camera(TF_Renderer *renderer) {
+    if (!renderer->backend->vtable->set_camera) {
+        return;
+    }
+
+    TF_CameraUniforms uniforms;
+    uniforms.view = tf_camera_get_view_matrix(renderer->current_camera);
+    uniforms.projection = tf_camera_get_projection_matrix(renderer->current_camera);
+    uniforms.view_projection = tf_mat4_multiply(uniforms.projection, uniforms.view);
+
+    TF_Vec3 position = tf_camera_get_position(renderer->current_camera);
+    uniforms.position = (TF_Vec4){position.x, position.y, position.z, 1.0f};
+
+    renderer->backend->vtable->set_camera(renderer->backend, &uniforms);
+}
+
+// Replay the run of mesh commands starting at first in one backend call.
+// Commands sharing a mesh and material become one instanced draw, unless they
+// draw only some index ranges (culled clusters); the backend may merge further
+// (e.g. different meshes that share buffers). Returns the number of commands
+// consumed.
+static u32 tf_renderer_replay_meshes(TF_Renderer *renderer, u32 first) {
+    u32 end = first;
+    u32 total = 0;
+    while (end < renderer->buffer.command_count && renderer->buffer.commands[end].type == TF_RENDER_COMMAND_MESH) {
+        total += renderer->buffer.meshes[renderer->buffer.commands[end].index].instance_count;
+        end++;
+    }
+
+    // Sized up front so pointers into the scratch stay valid for the whole run
+    if (!tf_command_buffer_grow((void **)&renderer->mesh_draws, &renderer->mesh_draw_capacity,
+                          sizeof(TF_MeshDraw), end - first) ||
+        !tf_command_buffer_grow((void **)&renderer->instance_scratch, &renderer->instance_scratch_capacity,
+                          sizeof(TF_InstanceData), total)) {
+        return end - first;
+    }
+
+    u32 draw_count = 0;
+    u32 scratch_used = 0;
+    u32 i = first;
+    while (i < end) {
+        const TF_MeshCommand *head = &renderer->buffer.meshes[renderer->buffer.commands[i].index];
+
+        u32 group_end = i + 1;
+        u32 group_total = head->instance_count;
+        b32 contiguous = TF_TRUE;
+        while (head->range_count == 0 && group_end < end) {
+            const TF_MeshCommand *next = &renderer->buffer.meshes[renderer->buffer.commands[group_end].index];
+            if (next->mesh != head->mesh || next->material != head->material || next->range_count != 0) {
+                break;
+            }
+            contiguous = contiguous && next->first_instance == head->first_instance + group_total;
+            group_total += next->instance_count;
+            group_end++;
+        }
+
+        // Draws recorded back to back are already laid out in order; otherwise
+        // (e.g. after depth sorting) gather them
+        const TF_InstanceData *instances = renderer->buffer.instances + head->first_instance;
+        if (!contiguous) {
+            instances = renderer->instance_scratch + scratch_used;
+            for (u32 j = i; j < group_end; j++) {
+                const TF_MeshCommand *command = &renderer->buffer.meshes[renderer->buffer.commands[j].index];
+                memcpy(renderer->instance_scratch + scratch_used, renderer->buffer.instances + command->first_instance,
+                       sizeof(TF_InstanceData) * command->instance_count);
+                scratch_used += command->instance_count;
+            }
+        }
+
+        renderer->mesh_draws[draw_count++] = (TF_MeshDraw){head->mesh, instances, group_total,
+                                                          renderer->buffer.ranges + head->first_range,
+                                                          head->range_count};
+        i = group_end;
+    }
+
+    renderer->backend->vtable->draw_meshes(renderer->backend, renderer->mesh_draws, draw_count);
+    return end - first;
+}
+
+// Sort and replay everything recorded so far through the backend
+static void tf_renderer_flush_commands(TF_Renderer *renderer) {
+    if (renderer->buffer.command_count == 0) {
+        return;
+    }
+
+    tf_renderer_sort_commands(renderer);
+    tf_renderer_upload_camera(renderer);
+
+    TF_RendererBackend *backend = renderer->backend;
+    u32 i = 0;
+    while (i < renderer->buffer.command_count) {
+        const TF_RenderCommand *command = &renderer->buffer.commands[i];
+        switch (command->type) {
+            case TF_RENDER_COMMAND_TRIANGLE: {
+                const TF_TriangleCommand *triangle = &renderer->buffer.triangles[command->index];
+                backend->vtable->draw_triangle(backend, triangle->p1, triangle->p2, triangle->p3, triangle->color);
+                i++;
+                break;
+            }
+            case TF_RENDER_COMMAND_MESH:
+                i += tf_renderer_replay_meshes(renderer, i);
+                break;
+            default:
+                TF_WARN("Unknown render command type: %u", command->type);
+                i++;
+                break;
+        }
+    }
+
+    renderer->commands_replayed += renderer->buffer.command_count;
+    tf_command_buffer_clear(&renderer->buffer);
+}
+
+// =============================================================================
+// Frame capture
+// =============================================================================
+
+static void tf_renderer_capture_pop(TF_Renderer *renderer) {
+    renderer->capture_pending--;
+    for (u32 i = 0; i < renderer->capture_pending; i++) {
+        renderer->capture_tickets[i] = renderer->capture_tickets[i + 1];
+        renderer->capture_widths[i] = renderer->capture_widths[i + 1];
+        renderer->capture_heights[i] = renderer->capture_heights[i + 1];
+    }
+}
+
+// Hand the oldest readback to the writer. Returns TF_FALSE while it is still in
+// flight; with wait set it blocks instead, and a failed readback is dropped.
+static b32 tf_renderer_capture_collect(TF_Renderer *renderer, b32 wait) {
+    TF_RendererBackend *backend = renderer->backend;
+    TF_CaptureFrame *frame = tf_capture_writer_acquire(renderer->capture, renderer->capture_widths[0],
+                                                       renderer->capture_heights[0]);
+    if (frame && backend->vtable->readback_end(backend, renderer->capture_tickets[0], frame->pixels, wait)) {
+        tf_capture_writer_submit(renderer->capture, frame);
+        tf_renderer_capture_pop(renderer);
+        return TF_TRUE;
+    }
+
+    tf_capture_writer_release(renderer->capture, frame);
+    if (wait) {
+        // Without a frame to copy into, the readback is dropped, but it must
+        // still end for the backend to free its buffer and fence
+        if (!frame) {
+            backend->vtable->readback_end(backend, renderer->capture_tickets[0], TF_NULL, TF_TRUE);
+        }
+        tf_renderer_capture_pop(renderer);
+    }
+    return TF_FALSE;
+}
+
+static void tf_renderer_capture_frame(TF_Renderer *renderer) {
+    // Collect whatever has landed; only block once the ring is full
+    while (renderer->capture_pending > 0 && tf_renderer_capture_collect(renderer, TF_FALSE)) {
+    }
+    if (renderer->capture_pending == TF_RENDERER_CAPTURE_LATENCY) {
+        tf_renderer_capture_collect(renderer, TF_TRUE);
+    }
+
+    if (!renderer->capture_unlimited && renderer->capture_remaining == 0) {
+        return;
+    }
+
+    // A zero ticket means the backend has nothing to read back; skip the frame
+    TF_RendererBackend *backend = renderer->backend;
+    u32 slot = renderer->capture_pending;
+    u32 ticket = backend->vtable->readback_begin(backend, &renderer->capture_widths[slot],
+                                                 &renderer->capture_heights[slot]);
+    if (ticket == 0) {
+        return;
+    }
+
+    renderer->capture_tickets[slot] = ticket;
+    renderer->capture_pending++;
+    if (!renderer->capture_unlimited) {
+        renderer->capture_remaining--;
+    }
+}
+
+b32 tf_renderer_capture_start(TF_Renderer *renderer, const TF_CaptureConfig *config) {
+    if (!renderer || !renderer->backend || !config) {
+        return TF_FALSE;
+    }
+
+    if (!renderer->backend->vtable->readback_begin || !renderer->backend->vtable->readback_end) {
+        TF_ERROR("Renderer backend does not support frame capture");
+        return TF_FALSE;
+    }
+
+    tf_renderer_capture_stop(renderer);
+
+    renderer->capture = tf_capture_writer_create(config);
+    if (!renderer->capture) {
+        return TF_FALSE;
+    }
+
+    renderer->capture_pending = 0;
+    renderer->capture_remaining = config->frame_count;
+    renderer->capture_unlimited = config->frame_count == 0;
+    return TF_TRUE;
+}
+
+void tf_renderer_capture_stop(TF_Renderer *renderer) {
+    if (!renderer || !renderer->capture) {
+        return;
+    }
+
+    while (renderer->capture_pending > 0) {
+        tf_renderer_capture_collect(renderer, TF_TRUE);
+    }
+
+    tf_capture_writer_destroy(renderer->capture);
+    renderer->capture = TF_NULL;
+    renderer->capture_remaining = 0;
+    renderer->capture_unlimited = TF_FALSE;
+}
+
+b32 tf_renderer_is_capturing(const TF_Renderer *renderer) {
+    if (!renderer || !renderer->capture) {
+        return TF_FALSE;
+    }
+
+    return renderer->capture_unlimited || renderer->capture_remaining > 0 || renderer->capture_pending > 0;
+}
+
 TF_Renderer *tf_renderer_create(TF_Window *window, const TF_RendererConfig *config) {
-    if (!window || !config) {
+    if (!config || (!window && config->backend != TF_RENDERER_BACKEND_SOFTWARE &&
+                    config->backend != TF_RENDERER_BACKEND_NULL)) {
         TF_ERROR("Invalid parameters for renderer creation");
         return TF_NULL;
     }
@@ -32,6 +357,7 @@ TF_Renderer *tf_renderer_create(TF_Window *window, const TF_RendererConfig *conf
     }
 
     // Store config
+    memset(renderer, 0, sizeof(TF_Renderer));
     renderer->config = *config;
     renderer->current_camera = TF_NULL;
 
@@ -40,6 +366,12 @@ TF_Renderer *tf_renderer_create(TF_Window *window, const TF_RendererConfig *conf
         case TF_RENDERER_BACKEND_OPENGL:
             renderer->backend = tf_renderer_backend_create_opengl();
             break;
+        case TF_RENDERER_BACKEND_SOFTWARE:
+            renderer->backend = tf_renderer_backend_create_software();
+            break;
+        case TF_RENDERER_BACKEND_NULL:
+            renderer->backend = tf_renderer_backend_create_null();
+            break;
         case TF_RENDERER_BACKEND_VULKAN:
             TF_ERROR("Vulkan backend not implemented yet");
             free(renderer);
@@ -50,6 +382,10 @@ TF_Renderer *tf_renderer_create(TF_Window *window, const TF_RendererConfig *conf
             return TF_NULL;
     }
 
+    if (renderer->backend && config->render_thread) {
+        renderer->backend = tf_renderer_backend_create_threaded(renderer->backend);
+    }
+
     if (!renderer->backend) {
         TF_ERROR("Failed to create renderer backend");
         free(renderer);
@@ -57,7 +393,7 @@ TF_Renderer *tf_renderer_create(TF_Window *window, const TF_RendererConfig *conf
     }
 
     // Initialize backend
-    if (!renderer->backend->vtable->create(renderer->backend, window)) {
+    if (!renderer->backend->vtable->create(renderer->backend, window, config)) {
         TF_ERROR("Failed to initialize renderer backend");
         free(renderer->backend);
         free(renderer);
@@ -78,11 +414,17 @@ void tf_renderer_destroy(TF_Renderer *renderer) {
 
     TF_DEBUG("Destroying renderer...");
 
+    tf_renderer_capture_stop(renderer);
+
     if (renderer->backend) {
         renderer->backend->vtable->destroy(renderer->backend);
         free(renderer->backend);
     }
 
+    tf_command_buffer_free(&renderer->buffer);
+    free(renderer->commands_scratch);
+    free(renderer->instance_scratch);
+    free(renderer->mesh_draws);
     free(renderer);
     TF_INFO("Renderer destroyed");
 }
@@ -92,6 +434,9 @@ void tf_renderer_begin_frame(TF_Renderer *renderer) {
         return;
     }
 
+    tf_command_buffer_reset(&renderer->buffer);
+    renderer->commands_replayed = 0;
+
     renderer->backend->vtable->begin_frame(renderer->backend);
 }
 
@@ -100,7 +445,17 @@ void tf_renderer_end_frame(TF_Renderer *renderer) {
         return;
     }
 
+    tf_renderer_flush_commands(renderer);
     renderer->backend->vtable->end_frame(renderer->backend);
+
+    if (renderer->capture) {
+        tf_renderer_capture_frame(renderer);
+    }
+
+    // After the capture, which reads the frame back before it is swapped away
+    if (renderer->backend->vtable->present) {
+        renderer->backend->vtable->present(renderer->backend);
+    }
 }
 
 void tf_renderer_clear(TF_Renderer *renderer, TF_ClearFlags flags) {
@@ -108,6 +463,8 @@ void tf_renderer_clear(TF_Renderer *renderer, TF_ClearFlags flags) {
         return;
     }
 
+    // Draws recorded before the clear must land before it
+    tf_renderer_flush_commands(renderer);
     renderer->backend->vtable->clear(renderer->backend, flags);
 }
 
@@ -119,12 +476,83 @@ void tf_renderer_set_camera(TF_Renderer *renderer, TF_Camera *camera) {
     renderer->current_camera = camera;
 }
 
+void tf_renderer_set_occlusion(TF_Renderer *renderer, const TF_OcclusionBuffer *occlusion) {
+    if (!renderer) {
+        return;
+    }
+
+    renderer->occlusion = occlusion;
+}
+
+void tf_renderer_set_cluster_culler(TF_Renderer *renderer, TF_ClusterCuller *culler) {
+    if (!renderer) {
+        return;
+    }
+
+    renderer->cluster_culler = culler;
+}
+
+void tf_renderer_set_cull_frustum(TF_Renderer *renderer, const TF_Frustum *frustum) {
+    if (!renderer) {
+        return;
+    }
+
+    renderer->has_cull_frustum = frustum != TF_NULL;
+    if (frustum) {
+        renderer->cull_frustum = *frustum;
+    }
+}
+
+void tf_renderer_set_layer(TF_Renderer *renderer, u8 layer) {
+    if (!renderer) {
+        return;
+    }
+
+    renderer->buffer.layer = layer;
+}
+
+void tf_renderer_set_material(TF_Renderer *renderer, TF_Material *material) {
+    if (!renderer) {
+        return;
+    }
+
+    renderer->buffer.material = material;
+}
+
 void tf_renderer_draw_triangle(TF_Renderer *renderer, TF_Vec3 p1, TF_Vec3 p2, TF_Vec3 p3, TF_Color color) {
     if (!renderer || !renderer->backend) {
         return;
     }
 
-    renderer->backend->vtable->draw_triangle(renderer->backend, p1, p2, p3, color);
+    tf_command_buffer_draw_triangle(&renderer->buffer, p1, p2, p3, color);
+}
+
+TF_InstanceData tf_instance_data_create(TF_Mat4 transform, TF_Color color) {
+    // Column-major source, row-major destination
+    TF_InstanceData instance;
+    for (u32 row = 0; row < 3; row++) {
+        for (u32 column = 0; column < 4; column++) {
+            instance.transform[row * 4 + column] = transform.m[column * 4 + row];
+        }
+    }
+    instance.color = color;
+    return instance;
+}
+
+// The camera may move between draws, so its view is read per draw. Returns
+// TF_NULL without a camera.
+static const TF_CommandView *tf_renderer_get_view(const TF_Renderer *renderer, TF_CommandView *view) {
+    if (!renderer->current_camera) {
+        return TF_NULL;
+    }
+
+    tf_command_view_init(view, renderer->current_camera);
+    view->occlusion = renderer->occlusion;
+    view->cluster_culler = renderer->cluster_culler;
+    if (renderer->has_cull_frustum) {
+        view->frustum = renderer->cull_frustum;
+    }
+    return view;
 }
 
 void tf_renderer_draw_mesh(TF_Renderer *renderer, TF_Mesh *mesh, TF_Mat4 transform) {
@@ -132,7 +560,106 @@ void tf_renderer_draw_mesh(TF_Renderer *renderer, TF_Mesh *mesh, TF_Mat4 transfo
         return;
     }
 
-    // For now, just log that we're drawing a mesh
-    // We'll implement actual mesh rendering later
-    TF_DEBUG_TRACE("Drawing mesh with transform");
+    TF_CommandView view;
+    tf_command_buffer_draw_mesh(&renderer->buffer, mesh, transform, tf_renderer_get_view(renderer, &view));
+}
+
+void tf_renderer_draw_mesh_instanced(TF_Renderer *renderer, TF_Mesh *mesh, const TF_Mat4 *transforms,
+                                     const TF_Color *colors, u32 count) {
+    if (!renderer || !renderer->backend || !mesh || !transforms || count == 0) {
+        return;
+    }
+
+    TF_CommandView view;
+    tf_command_buffer_draw_mesh_instanced(&renderer->buffer, mesh, transforms, colors, count,
+                                          tf_renderer_get_view(renderer, &view));
+}
+
+void tf_renderer_draw_mesh_instances(TF_Renderer *renderer, TF_Mesh *mesh, const TF_InstanceData *instances,
+                                     u32 count) {
+    if (!renderer || !renderer->backend || !mesh || !instances || count == 0) {
+        return;
+    }
+
+    TF_CommandView view;
+    tf_command_buffer_draw_mesh_instances(&renderer->buffer, mesh, instances, count,
+                                          tf_renderer_get_view(renderer, &view));
+}
+
+void tf_renderer_submit_command_lists(TF_Renderer *renderer, TF_CommandList *const *lists, u32 count) {
+    if (!renderer || !renderer->backend || !lists) {
+        return;
+    }
+
+    for (u32 i = 0; i < count; i++) {
+        if (lists[i] && !tf_command_buffer_append(&renderer->buffer, &lists[i]->buffer)) {
+            TF_ERROR("Failed to submit command list %u of %u", i, count);
+            return;
+        }
+    }
+}
+
+b32 tf_renderer_read_pixels(TF_Renderer *renderer, i32 x, i32 y, u32 width, u32 height, void *pixels) {
+    if (!renderer || !renderer->backend || !pixels || !renderer->backend->vtable->read_pixels) {
+        return TF_FALSE;
+    }
+
+    tf_renderer_flush_commands(renderer);
+    return renderer->backend->vtable->read_pixels(renderer->backend, x, y, width, height, pixels);
+}
+
+void tf_renderer_begin_pass(TF_Renderer *renderer, const char *name) {
+    if (!renderer || !renderer->backend) {
+        return;
+    }
+
+    // Pass boundaries are sort barriers, like clears
+    tf_renderer_flush_commands(renderer);
+    if (renderer->backend->vtable->begin_pass) {
+        renderer->backend->vtable->begin_pass(renderer->backend, name);
+    }
+}
+
+void tf_renderer_end_pass(TF_Renderer *renderer) {
+    if (!renderer || !renderer->backend) {
+        return;
+    }
+
+    tf_renderer_flush_commands(renderer);
+    if (renderer->backend->vtable->end_pass) {
+        renderer->backend->vtable->end_pass(renderer->backend);
+    }
+}
+
+b32 tf_renderer_get_gpu_timings(const TF_Renderer *renderer, TF_GPUTimings *timings) {
+    if (!renderer || !renderer->backend || !timings || !renderer->backend->vtable->get_gpu_timings) {
+        return TF_FALSE;
+    }
+
+    return renderer->backend->vtable->get_gpu_timings(renderer->backend, timings);
+}
+
+TF_RendererStats tf_renderer_get_stats(const TF_Renderer *renderer) {
+    if (!renderer || !renderer->backend) {
+        return (TF_RendererStats){0};
+    }
+
+    TF_RendererStats stats = renderer->backend->vtable->get_stats(renderer->backend);
+    stats.commands = renderer->commands_replayed + renderer->buffer.command_count;
+    stats.instances_tested = renderer->buffer.instances_tested;
+    stats.instances_culled = renderer->buffer.instances_culled;
+    stats.instances_occluded = renderer->buffer.instances_occluded;
+    stats.instances_lod = renderer->buffer.instances_lod;
+    stats.clusters_tested = renderer->buffer.clusters_tested;
+    stats.clusters_culled = renderer->buffer.clusters_culled;
+    stats.clusters_backfacing = renderer->buffer.clusters_backfacing;
+    return stats;
+}
+
+u32 tf_renderer_get_api_calls(const TF_Renderer *renderer, TF_APICallCount *calls, u32 max_calls) {
+    if (!renderer || !renderer->backend || !calls || !renderer->backend->vtable->get_api_calls) {
+        return 0;
+    }
+
+    return renderer->backend->vtable->get_api_calls(renderer->backend, calls, max_calls);
 }
@@ -2,7 +2,11 @@
 // Created by Preetiman Misra on 17/07/25.
 //
 #include "tunafish/renderer/shader.h"
+#include "renderer/backend/opengl/gl_extensions.h"
+#include "renderer/backend/opengl/gl_program_cache.h"
 #include "tunafish/core/log.h"
+#include "tunafish/core/time.h"
+#include "tunafish/platform/window.h"
 #include <glad/gl.h>
 #include <stdlib.h>
 #include <string.h>
@@ -11,21 +15,87 @@
 // Shader structure
 // =============================================================================
 
+#define TF_SHADER_NAME_MAX 64
+
+typedef struct {
+    char name[TF_SHADER_NAME_MAX]; // Array uniforms are stored without the "[0]" suffix
+    u32 hash;
+    i32 location;
+    GLenum type;
+    i32 size;
+} TF_ShaderUniformInfo;
+
+typedef struct {
+    char name[TF_SHADER_NAME_MAX];
+    u32 hash;
+    u32 index;
+    u32 binding;
+    i32 data_size;
+} TF_ShaderBlockInfo;
+
 struct TF_Shader {
     u32 program_id;
     b32 valid;
+    TF_ShaderStatus status;
+
+    // In-flight compilation; stage objects live until the program is finalized
+    u32 vertex_shader;
+    u32 fragment_shader;
+    u64 cache_key;
+    f64 compile_time_ms; // Main-thread time spent submitting and finalizing
+    TF_Shader *next_pending;
+
+    // Reflection, filled once at link time
+    TF_ShaderUniformInfo *uniforms;
+    u32 uniform_count;
+    TF_ShaderBlockInfo *blocks;
+    u32 block_count;
+
+    // Open-addressed name hash -> uniforms index + 1 (0 = empty slot)
+    u32 *uniform_table;
+    u32 uniform_table_mask;
 };
 
+// Shaders still compiling, and the shader drawn in their place
+static struct {
+    TF_Shader *pending;
+    u32 pending_count;
+    TF_Shader *fallback;
+} s_shader_state = {0};
+
 // =============================================================================
 // Internal helpers
 // =============================================================================
 
-static u32 compile_shader(GLenum type, const char *source) {
+// Shaders issue GL calls on the calling thread, so they need a context there;
+// a renderer with render_thread set has moved the window's away
+static b32 has_context(const char *function) {
+    if (tf_window_has_current_context()) {
+        return TF_TRUE;
+    }
+    TF_ERROR("%s needs a GL context current on this thread (none with render_thread)", function);
+    return TF_FALSE;
+}
+
+// Compile and link without querying any status, so the driver is free to
+// finish the work in the background
+static u32 submit_shader(GLenum type, const char *source) {
     u32 shader = glCreateShader(type);
     glShaderSource(shader, 1, &source, NULL);
     glCompileShader(shader);
+    return shader;
+}
 
-    // Check compilation status
+static u32 submit_program(u32 vertex_shader, u32 fragment_shader) {
+    u32 program = glCreateProgram();
+    glAttachShader(program, vertex_shader);
+    glAttachShader(program, fragment_shader);
+    tf_gl_program_cache_prepare(program);
+    glLinkProgram(program);
+    return program;
+}
+
+static b32 check_shader(u32 shader, GLenum type) {
     i32 success;
     glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
     if (!success) {
@@ -33,91 +103,306 @@ static u32 compile_shader(GLenum type, const char *source) {
         glGetShaderInfoLog(shader, sizeof(info_log), NULL, info_log);
         const char *type_str = (type == GL_VERTEX_SHADER) ? "vertex" : "fragment";
         TF_ERROR("Shader compilation failed (%s): %s", type_str, info_log);
-        glDeleteShader(shader);
-        return 0;
+        return TF_FALSE;
     }
 
-    return shader;
+    return TF_TRUE;
 }
 
-static u32 link_program(u32 vertex_shader, u32 fragment_shader) {
-    u32 program = glCreateProgram();
-    glAttachShader(program, vertex_shader);
-    glAttachShader(program, fragment_shader);
-    glLinkProgram(program);
-
-    // Check link status
+static b32 check_program(u32 program) {
     i32 success;
     glGetProgramiv(program, GL_LINK_STATUS, &success);
     if (!success) {
         char info_log[512];
         glGetProgramInfoLog(program, sizeof(info_log), NULL, info_log);
         TF_ERROR("Shader program linking failed: %s", info_log);
-        glDeleteProgram(program);
-        return 0;
+        return TF_FALSE;
     }
 
-    return program;
+    return TF_TRUE;
+}
+
+// FNV-1a over the first length bytes
+static u32 hash_name(const char *name, usize length) {
+    u32 hash = 2166136261u;
+    for (usize i = 0; i < length; i++) {
+        hash ^= (u8)name[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Length of a uniform name with a trailing "[0]" removed
+static usize uniform_name_length(const char *name) {
+    usize length = strlen(name);
+    if (length > 3 && strcmp(name + length - 3, "[0]") == 0) {
+        length -= 3;
+    }
+    return length;
+}
+
+static void insert_uniform(TF_Shader *shader, u32 uniform_index) {
+    u32 slot = shader->uniforms[uniform_index].hash & shader->uniform_table_mask;
+    while (shader->uniform_table[slot] != 0) {
+        slot = (slot + 1) & shader->uniform_table_mask;
+    }
+    shader->uniform_table[slot] = uniform_index + 1;
+}
+
+static b32 reflect_uniforms(TF_Shader *shader) {
+    u32 program = shader->program_id;
+
+    i32 active_count = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &active_count);
+
+    // Table stays at most half full so probes stay short
+    u32 table_size = 8;
+    while (table_size < (u32)active_count * 2) {
+        table_size <<= 1;
+    }
+
+    shader->uniforms = calloc(active_count > 0 ? (usize)active_count : 1, sizeof(TF_ShaderUniformInfo));
+    shader->uniform_table = calloc(table_size, sizeof(u32));
+    if (!shader->uniforms || !shader->uniform_table) {
+        TF_ERROR("Failed to allocate shader reflection data");
+        return TF_FALSE;
+    }
+    shader->uniform_table_mask = table_size - 1;
+
+    for (i32 i = 0; i < active_count; i++) {
+        char name[TF_SHADER_NAME_MAX];
+        GLsizei name_length = 0;
+        i32 size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(program, (GLuint)i, sizeof(name), &name_length, &size, &type, name);
+
+        // Members of uniform blocks have no location, they are fed through UBOs
+        GLuint uniform_index = (GLuint)i;
+        i32 block_index = -1;
+        glGetActiveUniformsiv(program, 1, &uniform_index, GL_UNIFORM_BLOCK_INDEX, &block_index);
+        if (block_index != -1) continue;
+
+        // The length reported here includes the terminator
+        i32 full_length = 0;
+        glGetActiveUniformsiv(program, 1, &uniform_index, GL_UNIFORM_NAME_LENGTH, &full_length);
+        if (full_length > (i32)sizeof(name)) {
+            TF_WARN("Uniform '%s...' in shader %u is longer than %d characters and cannot be looked up",
+                    name, program, TF_SHADER_NAME_MAX - 1);
+            continue;
+        }
+
+        i32 location = glGetUniformLocation(program, name);
+        if (location == -1) continue;
+
+        usize length = uniform_name_length(name);
+        TF_ShaderUniformInfo *info = &shader->uniforms[shader->uniform_count];
+        memcpy(info->name, name, length);
+        info->name[length] = '\0';
+        info->hash = hash_name(name, length);
+        info->location = location;
+        info->type = type;
+        info->size = size;
+
+        insert_uniform(shader, shader->uniform_count);
+        shader->uniform_count++;
+    }
+
+    return TF_TRUE;
+}
+
+static b32 reflect_uniform_blocks(TF_Shader *shader) {
+    u32 program = shader->program_id;
+
+    i32 active_count = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &active_count);
+    if (active_count == 0) return TF_TRUE;
+
+    shader->blocks = calloc((usize)active_count, sizeof(TF_ShaderBlockInfo));
+    if (!shader->blocks) {
+        TF_ERROR("Failed to allocate shader reflection data");
+        return TF_FALSE;
+    }
+
+    u32 user_binding = TF_SHADER_USER_BINDING;
+    for (i32 i = 0; i < active_count; i++) {
+        TF_ShaderBlockInfo *block = &shader->blocks[i];
+        glGetActiveUniformBlockName(program, (GLuint)i, sizeof(block->name), NULL, block->name);
+        glGetActiveUniformBlockiv(program, (GLuint)i, GL_UNIFORM_BLOCK_DATA_SIZE, &block->data_size);
+        block->hash = hash_name(block->name, strlen(block->name));
+        block->index = (u32)i;
+
+        i32 full_length = 0;
+        glGetActiveUniformBlockiv(program, (GLuint)i, GL_UNIFORM_BLOCK_NAME_LENGTH, &full_length);
+        if (full_length > (i32)sizeof(block->name)) {
+            TF_WARN("Uniform block '%s...' in shader %u is longer than %d characters and cannot be looked up",
+                    block->name, program, TF_SHADER_NAME_MAX - 1);
+        }
+
+        // Standard blocks are routed to their fixed binding points; user blocks
+        // get the following ones in block index order so none aliases them
+        if (strcmp(block->name, TF_SHADER_FRAME_BLOCK) == 0) {
+            block->binding = TF_SHADER_FRAME_BINDING;
+        } else if (strcmp(block->name, TF_SHADER_CAMERA_BLOCK) == 0) {
+            block->binding = TF_SHADER_CAMERA_BINDING;
+        } else {
+            block->binding = user_binding++;
+        }
+        glUniformBlockBinding(program, block->index, block->binding);
+    }
+    shader->block_count = (u32)active_count;
+
+    return TF_TRUE;
+}
+
+static void free_reflection(TF_Shader *shader) {
+    free(shader->uniforms);
+    free(shader->blocks);
+    free(shader->uniform_table);
+}
+
+static void release_stages(TF_Shader *shader) {
+    if (shader->vertex_shader) {
+        glDetachShader(shader->program_id, shader->vertex_shader);
+        glDeleteShader(shader->vertex_shader);
+        shader->vertex_shader = 0;
+    }
+    if (shader->fragment_shader) {
+        glDetachShader(shader->program_id, shader->fragment_shader);
+        glDeleteShader(shader->fragment_shader);
+        shader->fragment_shader = 0;
+    }
+}
+
+static void remove_pending(TF_Shader *shader) {
+    for (TF_Shader **link = &s_shader_state.pending; *link; link = &(*link)->next_pending) {
+        if (*link == shader) {
+            *link = shader->next_pending;
+            shader->next_pending = NULL;
+            s_shader_state.pending_count--;
+            return;
+        }
+    }
+}
+
+// Query the results of a submitted program; blocks if the driver is not done yet
+static void finalize_shader(TF_Shader *shader) {
+    f64 start = tf_time_get_current();
+
+    // Stage logs are only fetched on failure, the link status covers both
+    i32 linked = 0;
+    glGetProgramiv(shader->program_id, GL_LINK_STATUS, &linked);
+    if (!linked) {
+        if (check_shader(shader->vertex_shader, GL_VERTEX_SHADER) &&
+            check_shader(shader->fragment_shader, GL_FRAGMENT_SHADER)) {
+            check_program(shader->program_id);
+        }
+    }
+    release_stages(shader);
+
+    // Resolve every uniform once so setters never query the driver by name
+    if (linked && reflect_uniforms(shader) && reflect_uniform_blocks(shader)) {
+        if (shader->cache_key != 0) {
+            tf_gl_program_cache_store(shader->cache_key, shader->program_id);
+        }
+        shader->status = TF_SHADER_STATUS_READY;
+        shader->valid = TF_TRUE;
+    } else {
+        glDeleteProgram(shader->program_id);
+        shader->program_id = 0;
+        shader->status = TF_SHADER_STATUS_FAILED;
+    }
+
+    shader->compile_time_ms += (tf_time_get_current() - start) * 1000.0;
+    tf_gl_program_cache_record_compile(shader->compile_time_ms);
+}
+
+static b32 is_program_complete(const TF_Shader *shader) {
+    i32 complete = GL_FALSE;
+    glGetProgramiv(shader->program_id, GL_COMPLETION_STATUS_KHR, &complete);
+    return complete == GL_TRUE;
 }
 
 // =============================================================================
 // Shader lifecycle
 // =============================================================================
 
-TF_API TF_Shader *tf_shader_create(const char *vertex_source, const char *fragment_source) {
+TF_API TF_Shader *tf_shader_create_async(const char *vertex_source, const char *fragment_source) {
     if (!vertex_source || !fragment_source) {
         TF_ERROR("Shader source cannot be null");
         return NULL;
     }
+    if (!has_context(__func__)) {
+        return NULL;
+    }
 
-    TF_Shader *shader = (TF_Shader *)malloc(sizeof(TF_Shader));
+    TF_Shader *shader = (TF_Shader *)calloc(1, sizeof(TF_Shader));
     if (!shader) {
         TF_ERROR("Failed to allocate shader");
         return NULL;
     }
 
-    shader->program_id = 0;
-    shader->valid = TF_FALSE;
-
-    // Compile vertex shader
-    u32 vertex_shader = compile_shader(GL_VERTEX_SHADER, vertex_source);
-    if (vertex_shader == 0) {
-        free(shader);
-        return NULL;
+    // A cached binary is ready as soon as it is loaded
+    if (tf_gl_program_cache_enabled()) {
+        shader->cache_key = tf_gl_program_cache_key(vertex_source, fragment_source);
+        shader->program_id = tf_gl_program_cache_load(shader->cache_key);
+        if (shader->program_id != 0) {
+            shader->cache_key = 0;
+            if (!reflect_uniforms(shader) || !reflect_uniform_blocks(shader)) {
+                tf_shader_destroy(shader);
+                return NULL;
+            }
+            shader->status = TF_SHADER_STATUS_READY;
+            shader->valid = TF_TRUE;
+            return shader;
+        }
     }
 
-    // Compile fragment shader
-    u32 fragment_shader = compile_shader(GL_FRAGMENT_SHADER, fragment_source);
-    if (fragment_shader == 0) {
-        glDeleteShader(vertex_shader);
-        free(shader);
-        return NULL;
-    }
+    f64 start = tf_time_get_current();
+    shader->vertex_shader = submit_shader(GL_VERTEX_SHADER, vertex_source);
+    shader->fragment_shader = submit_shader(GL_FRAGMENT_SHADER, fragment_source);
+    shader->program_id = submit_program(shader->vertex_shader, shader->fragment_shader);
+    shader->status = TF_SHADER_STATUS_PENDING;
+    shader->compile_time_ms = (tf_time_get_current() - start) * 1000.0;
 
-    // Link program
-    shader->program_id = link_program(vertex_shader, fragment_shader);
+    shader->next_pending = s_shader_state.pending;
+    s_shader_state.pending = shader;
+    s_shader_state.pending_count++;
 
-    // Shaders are no longer needed after linking
-    glDeleteShader(vertex_shader);
-    glDeleteShader(fragment_shader);
+    return shader;
+}
+
+TF_API TF_Shader *tf_shader_create(const char *vertex_source, const char *fragment_source) {
+    TF_Shader *shader = tf_shader_create_async(vertex_source, fragment_source);
+    if (!shader) {
+        return NULL;
+    }
 
-    if (shader->program_id == 0) {
-        free(shader);
+    if (tf_shader_wait(shader) != TF_SHADER_STATUS_READY) {
+        tf_shader_destroy(shader);
         return NULL;
     }
 
-    shader->valid = TF_TRUE;
-    TF_DEBUG("Shader created successfully (program ID: %u)", shader->program_id);
+    TF_DEBUG("Shader created successfully (program ID: %u, %u uniforms, %u blocks)",
+             shader->program_id, shader->uniform_count, shader->block_count);
     return shader;
 }
 
 TF_API void tf_shader_destroy(TF_Shader *shader) {
-    if (!shader) return;
+    if (!shader || !has_context(__func__)) return;
+
+    if (shader->status == TF_SHADER_STATUS_PENDING) {
+        remove_pending(shader);
+        release_stages(shader);
+    }
+    if (s_shader_state.fallback == shader) {
+        s_shader_state.fallback = NULL;
+    }
 
     if (shader->program_id != 0) {
         glDeleteProgram(shader->program_id);
     }
 
+    free_reflection(shader);
     free(shader);
     TF_DEBUG("Shader destroyed");
 }
@@ -126,78 +411,169 @@ TF_API b32 tf_shader_is_valid(const TF_Shader *shader) {
     return shader && shader->valid;
 }
 
+// =============================================================================
+// Asynchronous compilation
+// =============================================================================
+
+TF_API TF_ShaderStatus tf_shader_get_status(const TF_Shader *shader) {
+    return shader ? shader->status : TF_SHADER_STATUS_FAILED;
+}
+
+TF_API TF_ShaderStatus tf_shader_wait(TF_Shader *shader) {
+    if (!shader) return TF_SHADER_STATUS_FAILED;
+
+    if (shader->status == TF_SHADER_STATUS_PENDING && has_context(__func__)) {
+        remove_pending(shader);
+        finalize_shader(shader);
+    }
+    return shader->status;
+}
+
+TF_API u32 tf_shader_poll_pending(void) {
+    // Without completion queries every status check can block, so only one
+    // program is finalized per poll to spread the cost over several frames
+    b32 can_poll = tf_gl_extensions_get()->parallel_shader_compile;
+    u32 budget = can_poll ? s_shader_state.pending_count : 1;
+
+    TF_Shader **link = &s_shader_state.pending;
+    while (*link && budget > 0) {
+        TF_Shader *shader = *link;
+        if (can_poll && !is_program_complete(shader)) {
+            link = &shader->next_pending;
+            continue;
+        }
+
+        *link = shader->next_pending;
+        shader->next_pending = NULL;
+        s_shader_state.pending_count--;
+        finalize_shader(shader);
+        budget--;
+    }
+
+    return s_shader_state.pending_count;
+}
+
+TF_API void tf_shader_set_fallback(TF_Shader *fallback) {
+    s_shader_state.fallback = fallback;
+}
+
+TF_API TF_Shader *tf_shader_get_fallback(void) {
+    return s_shader_state.fallback;
+}
+
+TF_API TF_Shader *tf_shader_resolve(TF_Shader *shader) {
+    if (shader && shader->valid) return shader;
+    return s_shader_state.fallback;
+}
+
 // =============================================================================
 // Shader binding
 // =============================================================================
 
 TF_API void tf_shader_bind(TF_Shader *shader) {
-    if (shader && shader->valid) {
+    shader = tf_shader_resolve(shader);
+    if (shader && has_context(__func__)) {
         glUseProgram(shader->program_id);
     }
 }
 
 TF_API void tf_shader_unbind(void) {
+    if (!has_context(__func__)) return;
     glUseProgram(0);
 }
 
 // =============================================================================
-// Uniform setters
+// Reflection
 // =============================================================================
 
-TF_API void tf_shader_set_int(TF_Shader *shader, const char *name, i32 value) {
-    if (!shader || !shader->valid || !name) return;
-    i32 location = glGetUniformLocation(shader->program_id, name);
-    if (location != -1) {
-        glUniform1i(location, value);
+TF_API TF_ShaderUniform tf_shader_get_uniform(const TF_Shader *shader, const char *name) {
+    if (!shader || !shader->valid || !name) return TF_SHADER_UNIFORM_INVALID;
+
+    usize length = uniform_name_length(name);
+    u32 hash = hash_name(name, length);
+    u32 slot = hash & shader->uniform_table_mask;
+
+    while (shader->uniform_table[slot] != 0) {
+        const TF_ShaderUniformInfo *info = &shader->uniforms[shader->uniform_table[slot] - 1];
+        if (info->hash == hash && strncmp(info->name, name, length) == 0 && info->name[length] == '\0') {
+            return info->location;
+        }
+        slot = (slot + 1) & shader->uniform_table_mask;
     }
+
+    return TF_SHADER_UNIFORM_INVALID;
 }
 
-TF_API void tf_shader_set_float(TF_Shader *shader, const char *name, f32 value) {
-    if (!shader || !shader->valid || !name) return;
-    i32 location = glGetUniformLocation(shader->program_id, name);
-    if (location != -1) {
-        glUniform1f(location, value);
-    }
+TF_API u32 tf_shader_get_uniform_count(const TF_Shader *shader) {
+    return shader ? shader->uniform_count : 0;
 }
 
-TF_API void tf_shader_set_vec2(TF_Shader *shader, const char *name, TF_Vec2 value) {
-    if (!shader || !shader->valid || !name) return;
-    i32 location = glGetUniformLocation(shader->program_id, name);
-    if (location != -1) {
-        glUniform2f(location, value.x, value.y);
-    }
+TF_API u32 tf_shader_get_uniform_block_count(const TF_Shader *shader) {
+    return shader ? shader->block_count : 0;
 }
 
-TF_API void tf_shader_set_vec3(TF_Shader *shader, const char *name, TF_Vec3 value) {
-    if (!shader || !shader->valid || !name) return;
-    i32 location = glGetUniformLocation(shader->program_id, name);
-    if (location != -1) {
-        glUniform3f(location, value.x, value.y, value.z);
+TF_API b32 tf_shader_set_uniform_block_binding(TF_Shader *shader, const char *block_name, u32 binding) {
+    if (!shader || !shader->valid || !block_name || !has_context(__func__)) return TF_FALSE;
+
+    u32 hash = hash_name(block_name, strlen(block_name));
+    for (u32 i = 0; i < shader->block_count; i++) {
+        TF_ShaderBlockInfo *block = &shader->blocks[i];
+        if (block->hash == hash && strcmp(block->name, block_name) == 0) {
+            glUniformBlockBinding(shader->program_id, block->index, binding);
+            block->binding = binding;
+            return TF_TRUE;
+        }
     }
+
+    TF_WARN("Uniform block '%s' is not active in shader %u", block_name, shader->program_id);
+    return TF_FALSE;
 }
 
-TF_API void tf_shader_set_vec4(TF_Shader *shader, const char *name, TF_Vec4 value) {
-    if (!shader || !shader->valid || !name) return;
-    i32 location = glGetUniformLocation(shader->program_id, name);
-    if (location != -1) {
-        glUniform4f(location, value.x, value.y, value.z, value.w);
-    }
+// =============================================================================
+// Uniform setters
+// =============================================================================
+
+TF_API void tf_shader_set_int(TF_Shader *shader, TF_ShaderUniform uniform, i32 value) {
+    if (!shader || !shader->valid || uniform < 0 || !has_context(__func__)) return;
+    glUniform1i(uniform, value);
 }
 
-TF_API void tf_shader_set_mat4(TF_Shader *shader, const char *name, const TF_Mat4 *value) {
-    if (!shader || !shader->valid || !name || !value) return;
-    i32 location = glGetUniformLocation(shader->program_id, name);
-    if (location != -1) {
-        glUniformMatrix4fv(location, 1, GL_FALSE, value->m);
-    }
+TF_API void tf_shader_set_float(TF_Shader *shader, TF_ShaderUniform uniform, f32 value) {
+    if (!shader || !shader->valid || uniform < 0 || !has_context(__func__)) return;
+    glUniform1f(uniform, value);
 }
 
-TF_API void tf_shader_set_color(TF_Shader *shader, const char *name, TF_Color value) {
-    if (!shader || !shader->valid || !name) return;
-    i32 location = glGetUniformLocation(shader->program_id, name);
-    if (location != -1) {
-        glUniform4f(location, value.r, value.g, value.b, value.a);
-    }
+TF_API void tf_shader_set_vec2(TF_Shader *shader, TF_ShaderUniform uniform, TF_Vec2 value) {
+    if (!shader || !shader->valid || uniform < 0 || !has_context(__func__)) return;
+    glUniform2f(uniform, value.x, value.y);
+}
+
+TF_API void tf_shader_set_vec3(TF_Shader *shader, TF_ShaderUniform uniform, TF_Vec3 value) {
+    if (!shader || !shader->valid || uniform < 0 || !has_context(__func__)) return;
+    glUniform3f(uniform, value.x, value.y, value.z);
+}
+
+TF_API void tf_shader_set_vec4(TF_Shader *shader, TF_ShaderUniform uniform, TF_Vec4 value) {
+    if (!shader || !shader->valid || uniform < 0 || !has_context(__func__)) return;
+    glUniform4f(uniform, value.x, value.y, value.z, value.w);
+}
+
+TF_API void tf_shader_set_mat4(TF_Shader *shader, TF_ShaderUniform uniform, const TF_Mat4 *value) {
+    if (!shader || !shader->valid || uniform < 0 || !value || !has_context(__func__)) return;
+    glUniformMatrix4fv(uniform, 1, GL_FALSE, value->m);
+}
+
+TF_API void tf_shader_set_color(TF_Shader *shader, TF_ShaderUniform uniform, TF_Color value) {
+    if (!shader || !shader->valid || uniform < 0 || !has_context(__func__)) return;
+    glUniform4f(uniform, value.r, value.g, value.b, value.a);
+}
+
+// =============================================================================
+// Program binary cache
+// =============================================================================
+
+TF_API TF_ShaderCacheStats tf_shader_get_cache_stats(void) {
+    return tf_gl_program_cache_get_stats();
 }
 
 // =============================================================================
@@ -0,0 +1,470 @@
+//
+// Created by Preetiman Misra on 17/07/25.
+//
+#include "tunafish/renderer/shader_variant.h"
+#include "tunafish/core/log.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TF_SHADER_INCLUDE_MAX_DEPTH 16
+
+// =============================================================================
+// Structures
+// =============================================================================
+
+typedef struct {
+    char *name;
+    char *source;
+} TF_ShaderInclude;
+
+// Feature set -> hash of its expanded sources, so repeat requests skip preprocessing
+typedef struct {
+    TF_ShaderFeatures features;
+    u64 hash;
+} TF_ShaderTemplateVariant;
+
+struct TF_ShaderTemplate {
+    char *vertex_source;
+    char *fragment_source;
+    char *features[TF_SHADER_MAX_FEATURES];
+    u32 feature_count;
+
+    TF_ShaderTemplateVariant *variants;
+    u32 variant_count;
+    u32 variant_capacity;
+};
+
+// A resident variant, shared by every template/feature set that expands to it
+typedef struct {
+    u64 hash;
+    TF_Shader *shader;
+    u32 references;
+} TF_ShaderVariantEntry;
+
+static struct {
+    TF_ShaderInclude *includes;
+    u32 include_count;
+    u32 include_capacity;
+
+    TF_ShaderVariantEntry *variants;
+    u32 variant_count;
+    u32 variant_capacity;
+
+    u32 users; // tf_shader_variants_init calls not yet matched by a shutdown
+} s_variant_state = {0};
+
+// Growable string for preprocessed sources
+typedef struct {
+    char *data;
+    usize length;
+    usize capacity;
+    b32 failed;
+} TF_SourceBuilder;
+
+// =============================================================================
+// Internal helpers
+// =============================================================================
+
+static char *tf_shader_strdup(const char *string) {
+    usize length = strlen(string) + 1;
+    char *copy = malloc(length);
+    if (copy) {
+        memcpy(copy, string, length);
+    }
+    return copy;
+}
+
+static b32 tf_shader_grow(void **array, u32 *capacity, usize element_size, u32 required) {
+    if (required <= *capacity) return TF_TRUE;
+
+    u32 new_capacity = *capacity ? *capacity * 2 : 16;
+    while (new_capacity < required) {
+        new_capacity *= 2;
+    }
+
+    void *grown = realloc(*array, element_size * new_capacity);
+    if (!grown) {
+        TF_ERROR("Failed to grow shader variant storage to %u entries", new_capacity);
+        return TF_FALSE;
+    }
+
+    *array = grown;
+    *capacity = new_capacity;
+    return TF_TRUE;
+}
+
+static void tf_source_append(TF_SourceBuilder *builder, const char *text, usize length) {
+    if (builder->failed) return;
+
+    if (builder->length + length + 1 > builder->capacity) {
+        usize capacity = builder->capacity ? builder->capacity : 1024;
+        while (builder->length + length + 1 > capacity) {
+            capacity *= 2;
+        }
+        char *data = realloc(builder->data, capacity);
+        if (!data) {
+            TF_ERROR("Failed to grow shader source buffer");
+            builder->failed = TF_TRUE;
+            return;
+        }
+        builder->data = data;
+        builder->capacity = capacity;
+    }
+
+    memcpy(builder->data + builder->length, text, length);
+    builder->length += length;
+    builder->data[builder->length] = '\0';
+}
+
+static void tf_source_append_string(TF_SourceBuilder *builder, const char *text) {
+    tf_source_append(builder, text, strlen(text));
+}
+
+static i32 tf_shader_find_include(const char *name, usize length) {
+    for (u32 i = 0; i < s_variant_state.include_count; i++) {
+        const char *include_name = s_variant_state.includes[i].name;
+        if (strncmp(include_name, name, length) == 0 && include_name[length] == '\0') {
+            return (i32)i;
+        }
+    }
+    return -1;
+}
+
+// Parse `#include "name"`; returns TF_FALSE if the line is not an include
+static b32 tf_shader_parse_include(const char *line, const char *end, const char **name, usize *length) {
+    while (line < end && (*line == ' ' || *line == '\t')) line++;
+    if (end - line < 8 || strncmp(line, "#include", 8) != 0) return TF_FALSE;
+
+    const char *open = memchr(line + 8, '"', (usize)(end - line - 8));
+    const char *close = open ? memchr(open + 1, '"', (usize)(end - open - 1)) : NULL;
+    if (!close) {
+        *name = NULL;
+        *length = 0;
+        return TF_TRUE;
+    }
+
+    *name = open + 1;
+    *length = (usize)(close - open - 1);
+    return TF_TRUE;
+}
+
+// Copy source into builder, expanding includes (each at most once per stage)
+static b32 tf_shader_expand(TF_SourceBuilder *builder, const char *source, u8 *included, u32 depth) {
+    if (depth > TF_SHADER_INCLUDE_MAX_DEPTH) {
+        TF_ERROR("Shader includes nested deeper than %d levels", TF_SHADER_INCLUDE_MAX_DEPTH);
+        return TF_FALSE;
+    }
+
+    const char *line = source;
+    while (*line) {
+        const char *end = strchr(line, '\n');
+        const char *next = end ? end + 1 : line + strlen(line);
+        if (!end) end = next;
+
+        const char *name;
+        usize length;
+        if (tf_shader_parse_include(line, end, &name, &length)) {
+            if (!name) {
+                TF_ERROR("Malformed shader include: %.*s", (int)(end - line), line);
+                return TF_FALSE;
+            }
+
+            i32 index = tf_shader_find_include(name, length);
+            if (index < 0) {
+                TF_ERROR("Unknown shader include \"%.*s\"", (int)length, name);
+                return TF_FALSE;
+            }
+
+            if (!included[index]) {
+                included[index] = 1;
+                if (!tf_shader_expand(builder, s_variant_state.includes[index].source, included, depth + 1)) {
+                    return TF_FALSE;
+                }
+                tf_source_append(builder, "\n", 1);
+            }
+        } else {
+            tf_source_append(builder, line, (usize)(next - line));
+        }
+
+        line = next;
+    }
+
+    return !builder->failed;
+}
+
+// #version line, feature defines, then the body with includes expanded
+static char *tf_shader_preprocess(const TF_ShaderTemplate *shader_template, const char *source,
+                                  TF_ShaderFeatures features) {
+    const char *version_end = strchr(source, '\n');
+    if (strncmp(source, "#version", 8) != 0 || !version_end) {
+        TF_ERROR("Shader template sources must start with a #version line");
+        return NULL;
+    }
+
+    TF_SourceBuilder builder = {0};
+    tf_source_append(&builder, source, (usize)(version_end - source + 1));
+
+    for (u32 i = 0; i < shader_template->feature_count; i++) {
+        if (features & ((TF_ShaderFeatures)1 << i)) {
+            tf_source_append_string(&builder, "#define ");
+            tf_source_append_string(&builder, shader_template->features[i]);
+            tf_source_append_string(&builder, " 1\n");
+        }
+    }
+
+    u8 *included = calloc(s_variant_state.include_count + 1, 1);
+    b32 ok = included && tf_shader_expand(&builder, version_end + 1, included, 0);
+    free(included);
+
+    if (!ok) {
+        free(builder.data);
+        return NULL;
+    }
+    return builder.data;
+}
+
+// 64-bit FNV-1a over both stages
+static u64 tf_shader_hash_sources(const char *vertex_source, const char *fragment_source) {
+    u64 hash = 14695981039346656037ull;
+    for (const u8 *c = (const u8 *)vertex_source; *c; c++) {
+        hash ^= *c;
+        hash *= 1099511628211ull;
+    }
+    hash ^= 0xFF;
+    hash *= 1099511628211ull;
+    for (const u8 *c = (const u8 *)fragment_source; *c; c++) {
+        hash ^= *c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+static TF_ShaderVariantEntry *tf_shader_find_variant(u64 hash) {
+    for (u32 i = 0; i < s_variant_state.variant_count; i++) {
+        if (s_variant_state.variants[i].hash == hash) {
+            return &s_variant_state.variants[i];
+        }
+    }
+    return NULL;
+}
+
+static const TF_ShaderTemplateVariant *tf_shader_template_find(const TF_ShaderTemplate *shader_template,
+                                                               TF_ShaderFeatures features) {
+    for (u32 i = 0; i < shader_template->variant_count; i++) {
+        if (shader_template->variants[i].features == features) {
+            return &shader_template->variants[i];
+        }
+    }
+    return NULL;
+}
+
+// =============================================================================
+// Include registry
+// =============================================================================
+
+TF_API b32 tf_shader_include_register(const char *name, const char *source) {
+    if (!name || !source) {
+        TF_ERROR("Shader include name and source cannot be null");
+        return TF_FALSE;
+    }
+
+    char *source_copy = tf_shader_strdup(source);
+    if (!source_copy) {
+        TF_ERROR("Failed to allocate shader include \"%s\"", name);
+        return TF_FALSE;
+    }
+
+    // Re-registering replaces the snippet; variants already compiled are unaffected
+    i32 index = tf_shader_find_include(name, strlen(name));
+    if (index >= 0) {
+        free(s_variant_state.includes[index].source);
+        s_variant_state.includes[index].source = source_copy;
+        return TF_TRUE;
+    }
+
+    char *name_copy = tf_shader_strdup(name);
+    if (!name_copy || !tf_shader_grow((void **)&s_variant_state.includes, &s_variant_state.include_capacity,
+                                      sizeof(TF_ShaderInclude), s_variant_state.include_count + 1)) {
+        free(name_copy);
+        free(source_copy);
+        return TF_FALSE;
+    }
+
+    s_variant_state.includes[s_variant_state.include_count++] = (TF_ShaderInclude){name_copy, source_copy};
+    return TF_TRUE;
+}
+
+// =============================================================================
+// Templates
+// =============================================================================
+
+TF_API TF_ShaderTemplate *tf_shader_template_create(const TF_ShaderTemplateDesc *desc) {
+    if (!desc || !desc->vertex_source || !desc->fragment_source) {
+        TF_ERROR("Shader template sources cannot be null");
+        return NULL;
+    }
+
+    if (desc->feature_count > TF_SHADER_MAX_FEATURES || (desc->feature_count > 0 && !desc->features)) {
+        TF_ERROR("Invalid shader template features (%u, max %d)", desc->feature_count, TF_SHADER_MAX_FEATURES);
+        return NULL;
+    }
+
+    TF_ShaderTemplate *shader_template = calloc(1, sizeof(TF_ShaderTemplate));
+    if (!shader_template) {
+        TF_ERROR("Failed to allocate shader template");
+        return NULL;
+    }
+
+    shader_template->vertex_source = tf_shader_strdup(desc->vertex_source);
+    shader_template->fragment_source = tf_shader_strdup(desc->fragment_source);
+    b32 ok = shader_template->vertex_source && shader_template->fragment_source;
+
+    for (u32 i = 0; ok && i < desc->feature_count; i++) {
+        shader_template->features[i] = tf_shader_strdup(desc->features[i]);
+        ok = shader_template->features[i] != NULL;
+        shader_template->feature_count = i + 1;
+    }
+
+    if (!ok) {
+        TF_ERROR("Failed to copy shader template");
+        tf_shader_template_destroy(shader_template);
+        return NULL;
+    }
+
+    return shader_template;
+}
+
+TF_API void tf_shader_template_destroy(TF_ShaderTemplate *shader_template) {
+    if (!shader_template) return;
+
+    for (u32 i = 0; i < shader_template->feature_count; i++) {
+        free(shader_template->features[i]);
+    }
+    free(shader_template->vertex_source);
+    free(shader_template->fragment_source);
+    free(shader_template->variants);
+    free(shader_template);
+}
+
+TF_API TF_ShaderFeatures tf_shader_template_feature(const TF_ShaderTemplate *shader_template, const char *name) {
+    if (!shader_template || !name) return 0;
+
+    for (u32 i = 0; i < shader_template->feature_count; i++) {
+        if (strcmp(shader_template->features[i], name) == 0) {
+            return (TF_ShaderFeatures)1 << i;
+        }
+    }
+    return 0;
+}
+
+// =============================================================================
+// Variants
+// =============================================================================
+
+TF_API TF_Shader *tf_shader_variant_acquire(TF_ShaderTemplate *shader_template, TF_ShaderFeatures features) {
+    if (!shader_template) return NULL;
+
+    // Bits without a feature would only create duplicate keys
+    if (shader_template->feature_count < TF_SHADER_MAX_FEATURES) {
+        features &= ((TF_ShaderFeatures)1 << shader_template->feature_count) - 1;
+    }
+
+    // Known feature set whose variant is still resident: no preprocessing needed
+    const TF_ShaderTemplateVariant *known = tf_shader_template_find(shader_template, features);
+    TF_ShaderVariantEntry *entry = known ? tf_shader_find_variant(known->hash) : NULL;
+    if (entry) {
+        entry->references++;
+        return entry->shader;
+    }
+
+    char *vertex_source = tf_shader_preprocess(shader_template, shader_template->vertex_source, features);
+    char *fragment_source = tf_shader_preprocess(shader_template, shader_template->fragment_source, features);
+    if (!vertex_source || !fragment_source) {
+        free(vertex_source);
+        free(fragment_source);
+        return NULL;
+    }
+
+    u64 hash = tf_shader_hash_sources(vertex_source, fragment_source);
+    if (!known && tf_shader_grow((void **)&shader_template->variants, &shader_template->variant_capacity,
+                                 sizeof(TF_ShaderTemplateVariant), shader_template->variant_count + 1)) {
+        shader_template->variants[shader_template->variant_count++] = (TF_ShaderTemplateVariant){features, hash};
+    }
+
+    // Another template or feature set may already have produced identical sources
+    entry = tf_shader_find_variant(hash);
+    if (entry) {
+        free(vertex_source);
+        free(fragment_source);
+        entry->references++;
+        return entry->shader;
+    }
+
+    TF_Shader *shader = NULL;
+    if (tf_shader_grow((void **)&s_variant_state.variants, &s_variant_state.variant_capacity,
+                       sizeof(TF_ShaderVariantEntry), s_variant_state.variant_count + 1)) {
+        shader = tf_shader_create_async(vertex_source, fragment_source);
+    }
+    free(vertex_source);
+    free(fragment_source);
+
+    if (!shader) return NULL;
+
+    s_variant_state.variants[s_variant_state.variant_count++] = (TF_ShaderVariantEntry){hash, shader, 1};
+    TF_DEBUG("Shader variant %016llx compiling (features 0x%llx, %u resident)",
+             (unsigned long long)hash, (unsigned long long)features, s_variant_state.variant_count);
+    return shader;
+}
+
+TF_API void tf_shader_variant_release(TF_Shader *shader) {
+    if (!shader) return;
+
+    for (u32 i = 0; i < s_variant_state.variant_count; i++) {
+        TF_ShaderVariantEntry *entry = &s_variant_state.variants[i];
+        if (entry->shader != shader) continue;
+
+        if (--entry->references == 0) {
+            tf_shader_destroy(entry->shader);
+            *entry = s_variant_state.variants[--s_variant_state.variant_count];
+        }
+        return;
+    }
+
+    TF_WARN("Released a shader that is not a shader variant");
+}
+
+TF_API u32 tf_shader_variant_count(void) {
+    return s_variant_state.variant_count;
+}
+
+TF_API void tf_shader_variants_init(void) {
+    s_variant_state.users++;
+}
+
+TF_API void tf_shader_variants_shutdown(void) {
+    if (s_variant_state.users == 0) {
+        TF_WARN("Shader variants shut down more often than initialized");
+        return;
+    }
+
+    // Other renderers still draw with their variants
+    if (--s_variant_state.users > 0) return;
+
+    for (u32 i = 0; i < s_variant_state.variant_count; i++) {
+        TF_ShaderVariantEntry *entry = &s_variant_state.variants[i];
+        if (entry->references > 0) {
+            TF_WARN("Shader variant %016llx still has %u references at shutdown",
+                    (unsigned long long)entry->hash, entry->references);
+        }
+        tf_shader_destroy(entry->shader);
+    }
+
+    for (u32 i = 0; i < s_variant_state.include_count; i++) {
+        free(s_variant_state.includes[i].name);
+        free(s_variant_state.includes[i].source);
+    }
+
+    free(s_variant_state.variants);
+    free(s_variant_state.includes);
+    memset(&s_variant_state, 0, sizeof(s_variant_state));
+}
@@ -2,7 +2,11 @@
 // Created by Preetiman Misra on 17/07/25.
 //
 #include <tunafish/tunafish.h>
+#include <tunafish/renderer/camera.h>
+#include <tunafish/renderer/mesh.h>
+#include <tunafish/renderer/shader_variant.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 void test_math_library(void) {
     TF_INFO("Testing math library...");
@@ -249,13 +253,924 @@ void test_renderer_system(TF_Window *window) {
     tf_renderer_begin_frame(renderer);
     tf_renderer_clear(renderer, TF_CLEAR_ALL);
     tf_renderer_end_frame(renderer);
-    tf_window_swap_buffers(window);
 
     // Cleanup
     tf_renderer_destroy(renderer);
     TF_INFO("Renderer system tests complete.");
 }
 
+// =============================================================================
+// Helpers
+// =============================================================================
+
+// Failed checks are counted and turn the exit code non-zero
+static u32 s_test_failures = 0;
+
+#define TEST_CHECK(condition, ...)     \
+    do {                               \
+        if (!(condition)) {            \
+            TF_ERROR(__VA_ARGS__);     \
+            s_test_failures++;         \
+        }                              \
+    } while (0)
+
+// What most renderer tests start from: a null-backend renderer, which makes
+// no graphics API calls and so runs anywhere, a camera and a unit cube
+typedef struct {
+    TF_Renderer *renderer;
+    TF_Camera *camera;
+    TF_Mesh *cube;
+} TestScene;
+
+static void test_scene_destroy(TestScene *scene) {
+    if (scene->renderer) {
+        tf_renderer_set_camera(scene->renderer, TF_NULL);
+    }
+    tf_mesh_destroy(scene->cube);
+    tf_camera_destroy(scene->camera);
+    tf_renderer_destroy(scene->renderer);
+    *scene = (TestScene){0};
+}
+
+static b32 test_scene_create(TestScene *scene, const char *name) {
+    const TF_RendererConfig config = {
+        .backend = TF_RENDERER_BACKEND_NULL,
+        .enable_depth_test = TF_TRUE,
+        .clear_color = TF_COLOR_BLUE
+    };
+
+    scene->renderer = tf_renderer_create(TF_NULL, &config);
+    scene->camera = tf_camera_create_perspective(60.0f, 4.0f / 3.0f, 0.1f, 200.0f);
+    scene->cube = tf_mesh_create_cube(1.0f);
+    if (!scene->renderer || !scene->camera || !scene->cube) {
+        TEST_CHECK(TF_FALSE, "Failed to create %s test resources", name);
+        test_scene_destroy(scene);
+        return TF_FALSE;
+    }
+    return TF_TRUE;
+}
+
+typedef void (*TestDrawFn)(TF_Renderer *renderer, void *user_data);
+
+// Run frames frames that each clear and call draw; returns milliseconds per frame
+static f64 test_run_frames(TF_Renderer *renderer, u32 frames, TestDrawFn draw, void *user_data) {
+    const f64 start = tf_time_get_current();
+    for (u32 frame = 0; frame < frames; frame++) {
+        tf_renderer_begin_frame(renderer);
+        tf_renderer_clear(renderer, TF_CLEAR_ALL);
+        draw(renderer, user_data);
+        tf_renderer_end_frame(renderer);
+    }
+    return (tf_time_get_current() - start) * 1000.0 / (f64)frames;
+}
+
+// A quads x quads grid of unit squares on the ground, two triangles each,
+// counter-clockwise seen from above. Bumpy grids get heights in a repeating
+// pattern. positions needs (quads + 1)^2 * 3 floats and indices quads^2 * 6;
+// returns the index count.
+static u32 test_build_grid(u32 quads, b32 bumpy, f32 *positions, u32 *indices) {
+    const u32 side = quads + 1;
+    for (u32 i = 0; i < side * side; i++) {
+        const u32 x = i % side;
+        const u32 z = i / side;
+        positions[i * 3 + 0] = (f32)x;
+        positions[i * 3 + 1] = bumpy ? (f32)((x * 7 + z * 13) % 5) * 0.2f : 0.0f;
+        positions[i * 3 + 2] = (f32)z;
+    }
+
+    u32 index_count = 0;
+    for (u32 z = 0; z < quads; z++) {
+        for (u32 x = 0; x < quads; x++) {
+            const u32 corner = z * side + x;
+            const u32 quad[6] = { corner, corner + side, corner + 1, corner + 1, corner + side, corner + side + 1 };
+            for (u32 i = 0; i < 6; i++) {
+                indices[index_count++] = quad[i];
+            }
+        }
+    }
+    return index_count;
+}
+
+// Shuffle whole triangles with a fixed seed, as an exporter that ignores the
+// vertex cache might leave them
+static void test_shuffle_triangles(u32 *indices, u32 index_count) {
+    u32 seed = 12345;
+    for (u32 i = index_count / 3 - 1; i > 0; i--) {
+        seed = seed * 1664525u + 1013904223u;
+        const u32 j = (seed >> 8) % (i + 1);
+        for (u32 k = 0; k < 3; k++) {
+            const u32 swap = indices[i * 3 + k];
+            indices[i * 3 + k] = indices[j * 3 + k];
+            indices[j * 3 + k] = swap;
+        }
+    }
+}
+
+static int test_compare_triangles(const void *a, const void *b) {
+    const u32 *x = a;
+    const u32 *y = b;
+    for (u32 i = 0; i < 3; i++) {
+        if (x[i] != y[i]) {
+            return x[i] < y[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+// Put triangles in a canonical order: each rotated to start at its smallest
+// index, which keeps the winding, then sorted
+static void test_sort_triangles(u32 *indices, u32 index_count) {
+    for (u32 i = 0; i < index_count; i += 3) {
+        u32 *t = indices + i;
+        while (t[0] > t[1] || t[0] > t[2]) {
+            const u32 first = t[0];
+            t[0] = t[1];
+            t[1] = t[2];
+            t[2] = first;
+        }
+    }
+    qsort(indices, index_count / 3, sizeof(u32) * 3, test_compare_triangles);
+}
+
+// Position-only mesh over a grid from test_build_grid
+static TF_Mesh *test_create_grid_mesh(u32 quads, const f32 *positions, const u32 *indices, u32 index_count,
+                                      b32 optimize) {
+    TF_VertexLayout layout = {0};
+    tf_vertex_layout_add(&layout, TF_VERTEX_ATTRIBUTE_POSITION, TF_VERTEX_FORMAT_FLOAT3);
+    const TF_MeshDesc desc = { &layout, positions, (quads + 1) * (quads + 1), indices, index_count, optimize };
+    return tf_mesh_create(&desc);
+}
+
+// =============================================================================
+// Renderer tests
+// =============================================================================
+
+#define TEST_SUBMISSION_DRAWS 10000
+
+static void test_draw_cubes(TF_Renderer *renderer, void *user_data) {
+    TF_Mesh *cube = user_data;
+    for (u32 i = 0; i < TEST_SUBMISSION_DRAWS; i++) {
+        tf_renderer_draw_mesh(renderer, cube, tf_mat4_translate(tf_vec3_create((f32)(i % 100), (f32)(i / 100), 0.0f)));
+    }
+}
+
+void test_renderer_submission(void) {
+    TF_INFO("Testing renderer submission cost...");
+
+    // The null backend makes no graphics API calls, so this times the front end only
+    TestScene scene;
+    if (!test_scene_create(&scene, "submission")) {
+        return;
+    }
+
+    const u32 frames = 100;
+    const f64 frame_ms = test_run_frames(scene.renderer, frames, test_draw_cubes, scene.cube);
+
+    const TF_RendererStats stats = tf_renderer_get_stats(scene.renderer);
+    TF_DEBUG("Submitted %u draws in %.1fms (%.2f M draws/s)", frames * TEST_SUBMISSION_DRAWS, frame_ms * frames,
+             TEST_SUBMISSION_DRAWS / frame_ms / 1000.0);
+    TF_DEBUG("Last frame: %u commands, %u backend calls, %u draw calls, %u instances, %llu bytes uploaded",
+             stats.commands, stats.backend_calls, stats.draw_calls, stats.instances,
+             (unsigned long long)stats.bytes_uploaded);
+    TEST_CHECK(stats.instances == TEST_SUBMISSION_DRAWS, "Drew %u of %u cubes", stats.instances,
+               TEST_SUBMISSION_DRAWS);
+
+    test_scene_destroy(&scene);
+    TF_INFO("Renderer submission tests complete.");
+}
+
+#define TEST_COMMAND_LIST_WORKERS 4
+
+typedef struct {
+    TF_CommandList *list;
+    TF_Mesh *mesh;
+    const TF_Mat4 *transforms; // Per draw, with colors; NULL for the submission grid
+    const TF_Color *colors;
+    u32 first;
+    u32 count;
+} TestRecordJob;
+
+static void test_record_slice(void *user_data) {
+    TestRecordJob *job = user_data;
+    tf_command_list_begin(job->list, TF_NULL);
+    for (u32 i = job->first; i < job->first + job->count; i++) {
+        if (job->transforms) {
+            tf_command_list_draw_mesh_instanced(job->list, job->mesh, &job->transforms[i], &job->colors[i], 1);
+        } else {
+            tf_command_list_draw_mesh(job->list, job->mesh,
+                                      tf_mat4_translate(tf_vec3_create((f32)(i % 100), (f32)(i / 100), 0.0f)));
+        }
+    }
+}
+
+// Record count draws split into one slice per list, each on its own thread
+static void test_record_lists(TF_CommandList *const *lists, TF_Mesh *mesh, const TF_Mat4 *transforms,
+                              const TF_Color *colors, u32 count) {
+    const u32 slice = count / TEST_COMMAND_LIST_WORKERS;
+    TestRecordJob jobs[TEST_COMMAND_LIST_WORKERS];
+    TF_Thread *threads[TEST_COMMAND_LIST_WORKERS];
+    for (u32 i = 0; i < TEST_COMMAND_LIST_WORKERS; i++) {
+        jobs[i] = (TestRecordJob){lists[i], mesh, transforms, colors, i * slice, slice};
+        threads[i] = tf_thread_create(test_record_slice, &jobs[i]);
+    }
+    for (u32 i = 0; i < TEST_COMMAND_LIST_WORKERS; i++) {
+        if (threads[i]) {
+            tf_thread_join(threads[i]);
+        } else {
+            test_record_slice(&jobs[i]);
+        }
+    }
+}
+
+typedef struct {
+    TF_CommandList *lists[TEST_COMMAND_LIST_WORKERS];
+    TF_Mesh *mesh;
+} TestCommandLists;
+
+// Same scene as test_renderer_submission, split into one slice per worker
+static void test_draw_command_lists(TF_Renderer *renderer, void *user_data) {
+    TestCommandLists *test = user_data;
+    test_record_lists(test->lists, test->mesh, TF_NULL, TF_NULL, TEST_SUBMISSION_DRAWS);
+    tf_renderer_submit_command_lists(renderer, test->lists, TEST_COMMAND_LIST_WORKERS);
+}
+
+#define TEST_DETERMINISM_DRAWS 256
+#define TEST_DETERMINISM_SIZE 64
+
+// Overlapping cubes of different colors, drawn without depth testing so the
+// image shows the order they reached the backend in. Recorded directly on the
+// renderer, or through lists when given. Returns TF_FALSE if it could not draw.
+static b32 test_draw_overlapping(TF_CommandList *const *lists, u8 *pixels, TF_RendererStats *stats) {
+    const TF_RendererConfig config = {
+        .backend = TF_RENDERER_BACKEND_SOFTWARE,
+        .enable_depth_test = TF_FALSE,
+        .clear_color = TF_COLOR_BLUE,
+        .width = TEST_DETERMINISM_SIZE,
+        .height = TEST_DETERMINISM_SIZE,
+        .worker_threads = 1
+    };
+
+    static TF_Mat4 transforms[TEST_DETERMINISM_DRAWS];
+    static TF_Color colors[TEST_DETERMINISM_DRAWS];
+    for (u32 i = 0; i < TEST_DETERMINISM_DRAWS; i++) {
+        const TF_Vec3 position = tf_vec3_create((f32)(i % 16) * 0.1f - 0.8f, (f32)(i / 16) * 0.1f - 0.8f, 0.0f);
+        transforms[i] = tf_mat4_multiply(tf_mat4_translate(position), tf_mat4_scale(tf_vec3_create(0.3f, 0.3f, 0.3f)));
+        colors[i] = (TF_Color){(f32)(i * 37 % 256) / 255.0f, (f32)(i * 91 % 256) / 255.0f,
+                               (f32)(i * 53 % 256) / 255.0f, 1.0f};
+    }
+
+    TF_Renderer *renderer = tf_renderer_create(TF_NULL, &config);
+    TF_Mesh *cube = tf_mesh_create_cube(1.0f);
+    b32 drawn = renderer && cube;
+    if (drawn) {
+        tf_renderer_begin_frame(renderer);
+        tf_renderer_clear(renderer, TF_CLEAR_ALL);
+        if (lists) {
+            test_record_lists(lists, cube, transforms, colors, TEST_DETERMINISM_DRAWS);
+            tf_renderer_submit_command_lists(renderer, lists, TEST_COMMAND_LIST_WORKERS);
+        } else {
+            for (u32 i = 0; i < TEST_DETERMINISM_DRAWS; i++) {
+                tf_renderer_draw_mesh_instanced(renderer, cube, &transforms[i], &colors[i], 1);
+            }
+        }
+        tf_renderer_end_frame(renderer);
+
+        *stats = tf_renderer_get_stats(renderer);
+        drawn = tf_renderer_read_pixels(renderer, 0, 0, TEST_DETERMINISM_SIZE, TEST_DETERMINISM_SIZE, pixels);
+    }
+
+    tf_mesh_destroy(cube);
+    tf_renderer_destroy(renderer);
+    return drawn;
+}
+
+void test_command_lists(void) {
+    TF_INFO("Testing parallel command list recording...");
+
+    TestScene scene;
+    if (!test_scene_create(&scene, "command list")) {
+        return;
+    }
+
+    TestCommandLists test = { .mesh = scene.cube };
+    b32 created = TF_TRUE;
+    for (u32 i = 0; i < TEST_COMMAND_LIST_WORKERS; i++) {
+        test.lists[i] = tf_command_list_create();
+        created = created && test.lists[i];
+    }
+    TEST_CHECK(created, "Failed to create command lists");
+
+    if (created) {
+        const u32 frames = 100;
+        const f64 frame_ms = test_run_frames(scene.renderer, frames, test_draw_command_lists, &test);
+
+        const TF_RendererStats stats = tf_renderer_get_stats(scene.renderer);
+        TF_DEBUG("Recorded %u draws on %u threads in %.1fms (%.2f M draws/s)", frames * TEST_SUBMISSION_DRAWS,
+                 TEST_COMMAND_LIST_WORKERS, frame_ms * frames, TEST_SUBMISSION_DRAWS / frame_ms / 1000.0);
+        TF_DEBUG("Last frame: %u commands, %u backend calls, %u draw calls, %u instances",
+                 stats.commands, stats.backend_calls, stats.draw_calls, stats.instances);
+        TEST_CHECK(stats.instances == TEST_SUBMISSION_DRAWS, "Drew %u of %u cubes", stats.instances,
+                   TEST_SUBMISSION_DRAWS);
+
+        // Recording on worker threads must not change the frame
+        static u8 pixels[2][TEST_DETERMINISM_SIZE * TEST_DETERMINISM_SIZE * 4];
+        TF_RendererStats draw_stats[2] = {0};
+        const b32 drawn = test_draw_overlapping(TF_NULL, pixels[0], &draw_stats[0]) &&
+                          test_draw_overlapping(test.lists, pixels[1], &draw_stats[1]);
+        TEST_CHECK(drawn, "Failed to draw the overlapping cubes");
+        if (drawn) {
+            u32 differing = 0;
+            for (u32 i = 0; i < TEST_DETERMINISM_SIZE * TEST_DETERMINISM_SIZE * 4; i++) {
+                differing += pixels[0][i] != pixels[1][i] ? 1 : 0;
+            }
+            TF_DEBUG("Direct and command list recording: %u and %u commands, %u and %u draw calls, "
+                     "%u bytes differ", draw_stats[0].commands, draw_stats[1].commands, draw_stats[0].draw_calls,
+                     draw_stats[1].draw_calls, differing);
+            TEST_CHECK(differing == 0 && draw_stats[0].commands == draw_stats[1].commands &&
+                       draw_stats[0].draw_calls == draw_stats[1].draw_calls &&
+                       draw_stats[0].instances == draw_stats[1].instances,
+                       "Command lists drew a different frame (%u bytes differ)", differing);
+        }
+    }
+
+    for (u32 i = 0; i < TEST_COMMAND_LIST_WORKERS; i++) {
+        tf_command_list_destroy(test.lists[i]);
+    }
+    test_scene_destroy(&scene);
+    TF_INFO("Command list tests complete.");
+}
+
+#define TEST_CULLING_GRID 100
+#define TEST_PORTAL_ROOMS 8
+#define TEST_TERRAIN_QUADS 128
+#define TEST_OPTIMIZE_QUADS 64
+
+typedef struct {
+    TF_Mesh *mesh;
+    const TF_Mat4 *transforms;
+    u32 count;
+} TestInstances;
+
+static void test_draw_instances(TF_Renderer *renderer, void *user_data) {
+    const TestInstances *instances = user_data;
+    tf_renderer_draw_mesh_instanced(renderer, instances->mesh, instances->transforms, TF_NULL, instances->count);
+}
+
+void test_culling(void) {
+    TF_INFO("Testing frustum culling and level of detail...");
+
+    TestScene scene;
+    if (!test_scene_create(&scene, "culling")) {
+        return;
+    }
+    TF_Mesh *far_cube = tf_mesh_create_cube(1.0f);
+    if (!far_cube || !tf_mesh_add_lod(scene.cube, far_cube, 0.05f)) {
+        TEST_CHECK(TF_FALSE, "Failed to create the reduced cube");
+        tf_mesh_destroy(far_cube);
+        test_scene_destroy(&scene);
+        return;
+    }
+
+    // A 100x100 grid on the ground, seen from one corner: most of it lies
+    // outside the view, and the far rows are small enough for the LOD
+    tf_camera_set_look_at(scene.camera, tf_vec3_create(-5.0f, 10.0f, -5.0f), tf_vec3_create(20.0f, 0.0f, 20.0f),
+                          tf_vec3_create(0.0f, 1.0f, 0.0f));
+    tf_renderer_set_camera(scene.renderer, scene.camera);
+
+    static TF_Mat4 transforms[TEST_CULLING_GRID * TEST_CULLING_GRID];
+    u32 expected = 0;
+    const TF_Frustum frustum = tf_camera_get_frustum(scene.camera);
+    for (u32 i = 0; i < TEST_CULLING_GRID * TEST_CULLING_GRID; i++) {
+        const f32 x = (f32)(i % TEST_CULLING_GRID) * 2.0f;
+        const f32 z = (f32)(i / TEST_CULLING_GRID) * 2.0f;
+        TF_Vec3 position = tf_vec3_create(x, 0.0f, z);
+        transforms[i] = tf_mat4_translate(position);
+        expected += tf_frustum_test_box(&frustum, position, tf_vec3_create(0.5f, 0.5f, 0.5f)) ? 1 : 0;
+    }
+
+    TestInstances grid = { scene.cube, transforms, TEST_CULLING_GRID * TEST_CULLING_GRID };
+    const f64 frame_ms = test_run_frames(scene.renderer, 100, test_draw_instances, &grid);
+
+    const TF_RendererStats stats = tf_renderer_get_stats(scene.renderer);
+    TF_DEBUG("Culled %u of %u instances in %.3fms per frame (%u expected visible)", stats.instances_culled,
+             stats.instances_tested, frame_ms, expected);
+    TF_DEBUG("Drew %u instances in %u draw calls, %u with the reduced mesh", stats.instances, stats.draw_calls,
+             stats.instances_lod);
+    TEST_CHECK(stats.instances_tested - stats.instances_culled == expected && stats.instances == expected,
+               "Drew %u instances, %u passed the frustum, expected %u", stats.instances,
+               stats.instances_tested - stats.instances_culled, expected);
+    TEST_CHECK(stats.instances_lod > 0 && stats.instances_lod < expected, "%u of %u instances used the LOD",
+               stats.instances_lod, expected);
+
+    tf_mesh_destroy(far_cube);
+    test_scene_destroy(&scene);
+    TF_INFO("Culling tests complete.");
+}
+
+void test_occlusion(void) {
+    TF_INFO("Testing occlusion culling...");
+
+    TestScene scene;
+    if (!test_scene_create(&scene, "occlusion")) {
+        return;
+    }
+    TF_OcclusionBuffer *occlusion = tf_occlusion_buffer_create(TF_NULL);
+    if (!occlusion) {
+        TEST_CHECK(TF_FALSE, "Failed to create the occlusion buffer");
+        test_scene_destroy(&scene);
+        return;
+    }
+
+    // Two buildings in front of the same grid as test_culling, with a street
+    // between them that the grid stays visible through
+    tf_camera_set_look_at(scene.camera, tf_vec3_create(0.0f, 3.0f, -10.0f), tf_vec3_create(0.0f, 2.0f, 20.0f),
+                          tf_vec3_create(0.0f, 1.0f, 0.0f));
+    tf_renderer_set_camera(scene.renderer, scene.camera);
+    const TF_Mat4 buildings[2] = {
+        tf_mat4_multiply(tf_mat4_translate(tf_vec3_create(-9.0f, 5.0f, 5.0f)),
+                         tf_mat4_scale(tf_vec3_create(16.0f, 10.0f, 1.0f))),
+        tf_mat4_multiply(tf_mat4_translate(tf_vec3_create(9.0f, 5.0f, 5.0f)),
+                         tf_mat4_scale(tf_vec3_create(16.0f, 10.0f, 1.0f)))
+    };
+
+    static TF_Mat4 transforms[TEST_CULLING_GRID * TEST_CULLING_GRID];
+    for (u32 i = 0; i < TEST_CULLING_GRID * TEST_CULLING_GRID; i++) {
+        const f32 x = (f32)(i % TEST_CULLING_GRID) * 2.0f - (f32)TEST_CULLING_GRID;
+        const f32 z = (f32)(i / TEST_CULLING_GRID) * 2.0f + 7.0f;
+        transforms[i] = tf_mat4_translate(tf_vec3_create(x, 0.5f, z));
+    }
+
+    TF_RendererStats pass_stats[2];
+    for (u32 pass = 0; pass < 2; pass++) {
+        tf_occlusion_buffer_begin(occlusion, scene.camera);
+        for (u32 i = 0; i < 2; i++) {
+            tf_occlusion_buffer_add_occluder(occlusion, scene.cube, buildings[i]);
+        }
+        tf_occlusion_buffer_rasterize(occlusion);
+        tf_renderer_set_occlusion(scene.renderer, pass ? occlusion : TF_NULL);
+
+        tf_renderer_begin_frame(scene.renderer);
+        tf_renderer_clear(scene.renderer, TF_CLEAR_ALL);
+        tf_renderer_draw_mesh_instanced(scene.renderer, scene.cube, buildings, TF_NULL, 2);
+        tf_renderer_draw_mesh_instanced(scene.renderer, scene.cube, transforms, TF_NULL,
+                                        TEST_CULLING_GRID * TEST_CULLING_GRID);
+        tf_renderer_end_frame(scene.renderer);
+
+        pass_stats[pass] = tf_renderer_get_stats(scene.renderer);
+        TF_DEBUG("Occlusion %s: %u instances drawn, %u outside the frustum, %u occluded", pass ? "on" : "off",
+                 pass_stats[pass].instances, pass_stats[pass].instances_culled, pass_stats[pass].instances_occluded);
+    }
+    TEST_CHECK(pass_stats[1].instances_occluded > 0 &&
+               pass_stats[1].instances + pass_stats[1].instances_occluded == pass_stats[0].instances,
+               "Occlusion drew %u and hid %u of the %u instances drawn without it", pass_stats[1].instances,
+               pass_stats[1].instances_occluded, pass_stats[0].instances);
+
+    const TF_OcclusionStats stats = tf_occlusion_buffer_get_stats(occlusion);
+    TF_DEBUG("Rasterized %u occluders (%u triangles) in %.3fms", stats.occluders, stats.occluder_triangles,
+             stats.rasterize_ms);
+
+    // The buildings never hide themselves, and the street stays open
+    const b32 building = tf_occlusion_buffer_test_box(occlusion, tf_vec3_create(-9.0f, 5.0f, 5.0f),
+                                                      tf_vec3_create(8.0f, 5.0f, 0.5f));
+    const b32 behind = tf_occlusion_buffer_test_box(occlusion, tf_vec3_create(-9.0f, 2.0f, 20.0f),
+                                                    tf_vec3_create(1.0f, 1.0f, 1.0f));
+    const b32 street = tf_occlusion_buffer_test_box(occlusion, tf_vec3_create(0.0f, 2.0f, 30.0f),
+                                                    tf_vec3_create(0.5f, 0.5f, 0.5f));
+    TF_DEBUG("Visible: building %s, box behind it %s, box down the street %s", building ? "yes" : "no",
+             behind ? "yes" : "no", street ? "yes" : "no");
+    TEST_CHECK(building && !behind && street, "Wrong occlusion results (building %d, behind %d, street %d)",
+               building, behind, street);
+
+    tf_renderer_set_occlusion(scene.renderer, TF_NULL);
+    tf_occlusion_buffer_destroy(occlusion);
+    test_scene_destroy(&scene);
+    TF_INFO("Occlusion tests complete.");
+}
+
+void test_portals(void) {
+    TF_INFO("Testing portal visibility...");
+
+    TestScene scene;
+    if (!test_scene_create(&scene, "portal")) {
+        return;
+    }
+    TF_PortalGraph *graph = tf_portal_graph_create();
+    if (!graph) {
+        TEST_CHECK(TF_FALSE, "Failed to create the portal graph");
+        test_scene_destroy(&scene);
+        return;
+    }
+
+    // A corridor of rooms whose doorways alternate sides, so sight lines
+    // along it are soon blocked, each room with a side room off to the east
+    for (u32 i = 0; i < TEST_PORTAL_ROOMS; i++) {
+        const f32 z = (f32)i * 10.0f;
+        tf_portal_graph_add_cell(graph, tf_vec3_create(-5.0f, 0.0f, z), tf_vec3_create(5.0f, 4.0f, z + 10.0f));
+        tf_portal_graph_add_cell(graph, tf_vec3_create(5.0f, 0.0f, z), tf_vec3_create(15.0f, 4.0f, z + 10.0f));
+    }
+    for (u32 i = 0; i < TEST_PORTAL_ROOMS; i++) {
+        const f32 z = (f32)i * 10.0f;
+        const TF_Vec3 side_door[4] = {
+            tf_vec3_create(5.0f, 0.0f, z + 4.0f), tf_vec3_create(5.0f, 0.0f, z + 6.0f),
+            tf_vec3_create(5.0f, 3.0f, z + 6.0f), tf_vec3_create(5.0f, 3.0f, z + 4.0f)
+        };
+        tf_portal_graph_add_portal(graph, i * 2, i * 2 + 1, side_door, 4);
+
+        if (i + 1 < TEST_PORTAL_ROOMS) {
+            const f32 x = i % 2 ? 3.0f : -3.0f;
+            const TF_Vec3 door[4] = {
+                tf_vec3_create(x - 1.0f, 0.0f, z + 10.0f), tf_vec3_create(x + 1.0f, 0.0f, z + 10.0f),
+                tf_vec3_create(x + 1.0f, 3.0f, z + 10.0f), tf_vec3_create(x - 1.0f, 3.0f, z + 10.0f)
+            };
+            tf_portal_graph_add_portal(graph, i * 2, (i + 1) * 2, door, 4);
+        }
+    }
+
+    const f64 bake_start = tf_time_get_current();
+    tf_portal_graph_bake(graph);
+    const f64 bake_seconds = tf_time_get_current() - bake_start;
+
+    const u32 cell_count = tf_portal_graph_get_cell_count(graph);
+    u32 visible_pairs = 0;
+    for (u32 from = 0; from < cell_count; from++) {
+        for (u32 to = 0; to < cell_count; to++) {
+            visible_pairs += tf_portal_graph_can_see(graph, from, to) ? 1 : 0;
+        }
+    }
+    TF_DEBUG("Baked %u cells in %.3fms, %.1f potentially visible cells each", cell_count, bake_seconds * 1000.0,
+             (f64)visible_pairs / (f64)cell_count);
+
+    // Neighbours and the rooms off them see each other; the staggered doors
+    // hide the far end of the corridor and the side rooms along it
+    const struct { u32 from, to; b32 visible; } pairs[] = {
+        {0, 1, TF_TRUE}, {0, 2, TF_TRUE}, {2, 6, TF_TRUE}, {15, 12, TF_TRUE},
+        {0, 6, TF_FALSE}, {1, 3, TF_FALSE}, {0, 15, TF_FALSE}, {15, 13, TF_FALSE}
+    };
+    for (u32 i = 0; i < sizeof(pairs) / sizeof(pairs[0]); i++) {
+        const b32 visible = tf_portal_graph_can_see(graph, pairs[i].from, pairs[i].to);
+        TEST_CHECK(visible == pairs[i].visible, "Cell %u %s cell %u", pairs[i].from,
+                   visible ? "sees" : "does not see", pairs[i].to);
+    }
+
+    // A few crates in every room, drawn only for the cells the camera can
+    // see and culled against the frustum each one is seen through
+    static TF_Mat4 crates[TEST_PORTAL_ROOMS * 2][4];
+    for (u32 cell = 0; cell < cell_count; cell++) {
+        const f32 x = cell % 2 ? 10.0f : 0.0f;
+        const f32 z = (f32)(cell / 2) * 10.0f + 5.0f;
+        for (u32 i = 0; i < 4; i++) {
+            const f32 dx = i % 2 ? 3.0f : -3.0f;
+            const f32 dz = i / 2 ? 3.0f : -3.0f;
+            crates[cell][i] = tf_mat4_translate(tf_vec3_create(x + dx, 0.5f, z + dz));
+        }
+    }
+
+    tf_camera_set_look_at(scene.camera, tf_vec3_create(0.0f, 1.7f, 1.0f), tf_vec3_create(-2.0f, 1.5f, 40.0f),
+                          tf_vec3_create(0.0f, 1.0f, 0.0f));
+    tf_renderer_set_camera(scene.renderer, scene.camera);
+
+    TF_VisibleCell visible[TEST_PORTAL_ROOMS * 2];
+    const u32 visible_count = tf_portal_graph_find_visible(graph, scene.camera, visible, TEST_PORTAL_ROOMS * 2);
+
+    tf_renderer_begin_frame(scene.renderer);
+    tf_renderer_clear(scene.renderer, TF_CLEAR_ALL);
+    for (u32 i = 0; i < visible_count; i++) {
+        tf_renderer_set_cull_frustum(scene.renderer, &visible[i].frustum);
+        tf_renderer_draw_mesh_instanced(scene.renderer, scene.cube, crates[visible[i].cell], TF_NULL, 4);
+    }
+    tf_renderer_set_cull_frustum(scene.renderer, TF_NULL);
+    tf_renderer_end_frame(scene.renderer);
+
+    const TF_PortalStats portal_stats = tf_portal_graph_get_stats(graph);
+    const TF_RendererStats stats = tf_renderer_get_stats(scene.renderer);
+    TF_DEBUG("Camera sees %u of %u cells (%u portals tested, %u skipped by the baked sets)", visible_count,
+             cell_count, portal_stats.portals_tested, portal_stats.portals_skipped);
+    for (u32 i = 0; i < visible_count; i++) {
+        TF_DEBUG("  cell %u through [%.2f, %.2f] x [%.2f, %.2f]", visible[i].cell, visible[i].min_x,
+                 visible[i].max_x, visible[i].min_y, visible[i].max_y);
+    }
+    TF_DEBUG("Drew %u of %u crates, %u culled by the cell frustums", stats.instances, cell_count * 4,
+             stats.instances_culled);
+
+    // From the first room, the door ahead shows only the second
+    TEST_CHECK(visible_count == 2 && visible[0].cell == 0 && visible[1].cell == 2,
+               "Camera sees %u cells, expected cells 0 and 2", visible_count);
+    TEST_CHECK(stats.instances > 0 && stats.instances + stats.instances_culled == visible_count * 4,
+               "Drew %u and culled %u crates of %u visible cells", stats.instances, stats.instances_culled,
+               visible_count);
+
+    tf_portal_graph_destroy(graph);
+    test_scene_destroy(&scene);
+    TF_INFO("Portal tests complete.");
+}
+
+static void test_draw_terrain(TF_Renderer *renderer, void *user_data) {
+    tf_renderer_draw_mesh(renderer, user_data, tf_mat4_identity());
+}
+
+void test_clusters(void) {
+    TF_INFO("Testing mesh cluster culling...");
+
+    TestScene scene;
+    if (!test_scene_create(&scene, "cluster")) {
+        return;
+    }
+
+    // A bumpy 128x128 quad terrain, one mesh of 32768 triangles
+    static f32 positions[(TEST_TERRAIN_QUADS + 1) * (TEST_TERRAIN_QUADS + 1) * 3];
+    static u32 indices[TEST_TERRAIN_QUADS * TEST_TERRAIN_QUADS * 6];
+    const u32 index_count = test_build_grid(TEST_TERRAIN_QUADS, TF_TRUE, positions, indices);
+    TF_Mesh *terrain = test_create_grid_mesh(TEST_TERRAIN_QUADS, positions, indices, index_count, TF_FALSE);
+
+    // Terrain is open, so only the frustum test applies. Clusters of 32
+    // triangles give the culler four tasks' worth, well past the point where
+    // it starts splitting a mesh over its threads.
+    const f64 build_start = tf_time_get_current();
+    if (!terrain || !tf_mesh_build_clusters(terrain, 32, TF_FALSE)) {
+        TEST_CHECK(TF_FALSE, "Failed to build the clustered terrain");
+        tf_mesh_destroy(terrain);
+        test_scene_destroy(&scene);
+        return;
+    }
+    const u32 cluster_count = tf_mesh_get_cluster_count(terrain);
+    TF_DEBUG("Split %u triangles into %u clusters in %.3fms", index_count / 3, cluster_count,
+             (tf_time_get_current() - build_start) * 1000.0);
+
+    const TF_ClusterCullerConfig culler_config = { .worker_threads = 3 };
+    TF_ClusterCuller *culler = tf_cluster_culler_create(&culler_config);
+    TEST_CHECK(culler, "Failed to create the cluster culler");
+
+    // Standing near one edge, looking along it: most clusters are behind or
+    // beside the camera
+    tf_camera_set_look_at(scene.camera, tf_vec3_create(10.0f, 4.0f, 10.0f), tf_vec3_create(60.0f, 0.0f, 20.0f),
+                          tf_vec3_create(0.0f, 1.0f, 0.0f));
+    tf_renderer_set_camera(scene.renderer, scene.camera);
+
+    // Culled on the recording thread, then on the culler's workers, which
+    // must leave the same clusters and ranges
+    static TF_IndexRange ranges[2][TEST_TERRAIN_QUADS * TEST_TERRAIN_QUADS * 2];
+    u32 range_counts[2];
+    TF_RendererStats pass_stats[2];
+    for (u32 pass = 0; pass < 2; pass++) {
+        TF_ClusterCuller *pass_culler = pass ? culler : TF_NULL;
+        tf_renderer_set_cluster_culler(scene.renderer, pass_culler);
+        const f64 frame_ms = test_run_frames(scene.renderer, 100, test_draw_terrain, terrain);
+        range_counts[pass] = tf_cluster_culler_cull(pass_culler, terrain, tf_mat4_identity(), scene.camera,
+                                                    ranges[pass]);
+
+        const TF_RendererStats stats = tf_renderer_get_stats(scene.renderer);
+        TF_DEBUG("Culled %u of %u clusters %s in %.3fms per frame, drew %u of %u triangles in %u ranges",
+                 stats.clusters_culled, stats.clusters_tested, pass ? "on workers" : "inline", frame_ms,
+                 stats.triangles, index_count / 3, range_counts[pass]);
+        TEST_CHECK(stats.clusters_tested == cluster_count && stats.clusters_culled > 0 &&
+                   stats.clusters_culled < cluster_count, "Culled %u of %u clusters, %u tested",
+                   stats.clusters_culled, cluster_count, stats.clusters_tested);
+        TEST_CHECK(stats.triangles > 0 && stats.triangles < index_count / 3, "Drew %u of %u triangles",
+                   stats.triangles, index_count / 3);
+        pass_stats[pass] = stats;
+    }
+    tf_renderer_set_cluster_culler(scene.renderer, TF_NULL);
+
+    TEST_CHECK(pass_stats[0].clusters_culled == pass_stats[1].clusters_culled &&
+               pass_stats[0].triangles == pass_stats[1].triangles,
+               "Worker culling kept %u triangles, inline culling %u", pass_stats[1].triangles,
+               pass_stats[0].triangles);
+    b32 same_ranges = range_counts[0] == range_counts[1];
+    for (u32 i = 0; same_ranges && i < range_counts[0]; i++) {
+        same_ranges = ranges[0][i].first_index == ranges[1][i].first_index &&
+                      ranges[0][i].index_count == ranges[1][i].index_count;
+    }
+    TEST_CHECK(same_ranges, "Worker culling left different ranges (%u, inline %u)", range_counts[1],
+               range_counts[0]);
+
+    tf_cluster_culler_destroy(culler);
+    tf_mesh_destroy(terrain);
+    test_scene_destroy(&scene);
+    TF_INFO("Cluster tests complete.");
+}
+
+#define TEST_LOD_CLUSTERS_WIDTH 160
+#define TEST_LOD_CLUSTERS_HEIGHT 120
+
+void test_cluster_lods(void) {
+    TF_INFO("Testing clustered meshes with levels of detail...");
+
+    // Rendered on the software backend, so the instances each level drew can
+    // be told apart by color
+    const TF_RendererConfig config = {
+        .backend = TF_RENDERER_BACKEND_SOFTWARE,
+        .enable_depth_test = TF_TRUE,
+        .clear_color = TF_COLOR_BLUE,
+        .width = TEST_LOD_CLUSTERS_WIDTH,
+        .height = TEST_LOD_CLUSTERS_HEIGHT,
+        .worker_threads = 1
+    };
+
+    // Two small triangles far apart, a cluster each, and a large quad as the
+    // reduced level
+    TF_VertexLayout layout = {0};
+    tf_vertex_layout_add(&layout, TF_VERTEX_ATTRIBUTE_POSITION, TF_VERTEX_FORMAT_FLOAT3);
+    const f32 positions[] = {
+        -21.0f, -0.5f, 0.0f, -19.0f, -0.5f, 0.0f, -20.0f, 0.5f, 0.0f,
+         19.0f, -0.5f, 0.0f,  21.0f, -0.5f, 0.0f,  20.0f, 0.5f, 0.0f
+    };
+    const u32 indices[] = { 0, 1, 2, 3, 4, 5 };
+    const f32 lod_positions[] = {
+        -20.0f, -20.0f, 0.0f, 20.0f, -20.0f, 0.0f, 20.0f, 20.0f, 0.0f, -20.0f, 20.0f, 0.0f
+    };
+    const u32 lod_indices[] = { 0, 1, 2, 0, 2, 3 };
+    const TF_MeshDesc desc = { &layout, positions, 6, indices, 6, TF_FALSE };
+    const TF_MeshDesc lod_desc = { &layout, lod_positions, 4, lod_indices, 6, TF_FALSE };
+
+    TF_Renderer *renderer = tf_renderer_create(TF_NULL, &config);
+    TF_Camera *camera = tf_camera_create_perspective(60.0f, (f32)TEST_LOD_CLUSTERS_WIDTH / TEST_LOD_CLUSTERS_HEIGHT,
+                                                     0.1f, 1000.0f);
+    TF_Mesh *mesh = tf_mesh_create(&desc);
+    TF_Mesh *lod = tf_mesh_create(&lod_desc);
+    if (!renderer || !camera || !mesh || !lod || !tf_mesh_build_clusters(mesh, 1, TF_FALSE) ||
+        !tf_mesh_add_lod(mesh, lod, 0.5f)) {
+        TEST_CHECK(TF_FALSE, "Failed to create clustered LOD test resources");
+        tf_mesh_destroy(lod);
+        tf_mesh_destroy(mesh);
+        tf_camera_destroy(camera);
+        tf_renderer_destroy(renderer);
+        return;
+    }
+    tf_camera_set_look_at(camera, tf_vec3_create(0.0f, 0.0f, 5.0f), tf_vec3_create(0.0f, 0.0f, 0.0f),
+                          tf_vec3_create(0.0f, 1.0f, 0.0f));
+    tf_renderer_set_camera(renderer, camera);
+
+    // The first instance straddles the view with both triangles outside it,
+    // so it passes the instance test but loses every cluster; the next two
+    // each show one triangle and the last is far enough for the quad
+    const TF_Mat4 transforms[4] = {
+        tf_mat4_identity(),
+        tf_mat4_translate(tf_vec3_create(20.0f, 1.0f, -2.0f)),
+        tf_mat4_translate(tf_vec3_create(-20.0f, -1.0f, -2.0f)),
+        tf_mat4_translate(tf_vec3_create(0.0f, 0.0f, -400.0f))
+    };
+    const TF_Color colors[4] = { TF_COLOR_WHITE, TF_COLOR_RED, TF_COLOR_GREEN, TF_COLOR_WHITE };
+
+    tf_renderer_begin_frame(renderer);
+    tf_renderer_clear(renderer, TF_CLEAR_ALL);
+    tf_renderer_draw_mesh_instanced(renderer, mesh, transforms, colors, 4);
+    tf_renderer_end_frame(renderer);
+
+    static u8 pixels[TEST_LOD_CLUSTERS_WIDTH * TEST_LOD_CLUSTERS_HEIGHT * 4];
+    u32 red = 0, green = 0, white = 0;
+    if (tf_renderer_read_pixels(renderer, 0, 0, TEST_LOD_CLUSTERS_WIDTH, TEST_LOD_CLUSTERS_HEIGHT, pixels)) {
+        for (u32 i = 0; i < TEST_LOD_CLUSTERS_WIDTH * TEST_LOD_CLUSTERS_HEIGHT; i++) {
+            const u8 *pixel = pixels + i * 4;
+            white += pixel[0] > 200 && pixel[1] > 200 && pixel[2] > 200 ? 1 : 0;
+            red += pixel[0] > 200 && pixel[1] < 50 ? 1 : 0;
+            green += pixel[0] < 50 && pixel[1] > 200 ? 1 : 0;
+        }
+    }
+
+    const TF_RendererStats stats = tf_renderer_get_stats(renderer);
+    TF_DEBUG("Drew %u instances, %u with the reduced mesh, %u triangles: %u red, %u green, %u white pixels",
+             stats.instances, stats.instances_lod, stats.triangles, red, green, white);
+    TEST_CHECK(stats.instances == 3 && stats.instances_lod == 1, "Drew %u instances, %u reduced, expected 3 and 1",
+               stats.instances, stats.instances_lod);
+    TEST_CHECK(red > 0 && green > 0 && white > 0, "An instance went missing (%u red, %u green, %u white pixels)",
+               red, green, white);
+
+    tf_renderer_set_camera(renderer, TF_NULL);
+    tf_mesh_destroy(lod);
+    tf_mesh_destroy(mesh);
+    tf_camera_destroy(camera);
+    tf_renderer_destroy(renderer);
+    TF_INFO("Clustered LOD tests complete.");
+}
+
+void test_mesh_optimization(void) {
+    TF_INFO("Testing mesh optimization...");
+
+    static f32 positions[(TEST_OPTIMIZE_QUADS + 1) * (TEST_OPTIMIZE_QUADS + 1) * 3];
+    static u32 indices[TEST_OPTIMIZE_QUADS * TEST_OPTIMIZE_QUADS * 6];
+    const u32 index_count = test_build_grid(TEST_OPTIMIZE_QUADS, TF_FALSE, positions, indices);
+    test_shuffle_triangles(indices, index_count);
+
+    TF_Mesh *grid = test_create_grid_mesh(TEST_OPTIMIZE_QUADS, positions, indices, index_count, TF_FALSE);
+    TF_MeshOptimizeStats stats = {0};
+    if (!grid || !tf_mesh_optimize(grid, &stats)) {
+        TEST_CHECK(TF_FALSE, "Failed to optimize the test grid");
+        tf_mesh_destroy(grid);
+        return;
+    }
+
+    TF_DEBUG("Vertex cache of %u entries: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f", TF_MESH_VERTEX_CACHE_SIZE,
+             stats.before.acmr, stats.after.acmr, stats.before.atvr, stats.after.atvr);
+    TEST_CHECK(stats.after.acmr < stats.before.acmr && stats.after.atvr < stats.before.atvr,
+               "Optimizing did not improve the vertex cache");
+
+    // Vertices were reordered too, so map each index back to its grid point by
+    // position before comparing the triangles with the ones given
+    const u32 side = TEST_OPTIMIZE_QUADS + 1;
+    const f32 *vertices = tf_mesh_get_vertices(grid);
+    const u32 *optimized = tf_mesh_get_indices(grid);
+    static u32 remapped[TEST_OPTIMIZE_QUADS * TEST_OPTIMIZE_QUADS * 6];
+    b32 same_triangles = tf_mesh_get_vertex_count(grid) == side * side && tf_mesh_get_index_count(grid) == index_count;
+    for (u32 i = 0; same_triangles && i < index_count; i++) {
+        const f32 *position = vertices + optimized[i] * 3;
+        remapped[i] = (u32)position[2] * side + (u32)position[0];
+    }
+    if (same_triangles) {
+        test_sort_triangles(indices, index_count);
+        test_sort_triangles(remapped, index_count);
+        for (u32 i = 0; same_triangles && i < index_count; i++) {
+            same_triangles = indices[i] == remapped[i];
+        }
+    }
+    TEST_CHECK(same_triangles, "Optimizing changed the triangles drawn");
+
+    tf_mesh_destroy(grid);
+    TF_INFO("Mesh optimization tests complete.");
+}
+
+// Bounds must come from positions decoded as the layout describes them
+void test_mesh_bounds(void) {
+    TF_INFO("Testing mesh bounds...");
+
+    // Position-only, so the stride is 4 bytes and any wider read overruns
+    TF_VertexLayout layout = {0};
+    tf_vertex_layout_add(&layout, TF_VERTEX_ATTRIBUTE_POSITION, TF_VERTEX_FORMAT_UBYTE4_NORM);
+    const u8 vertices[] = {0, 0, 0, 255, 255, 0, 0, 255, 0, 255, 0, 255};
+    const u32 indices[] = {0, 1, 2};
+    TF_Mesh *mesh = tf_mesh_create(&(TF_MeshDesc){&layout, vertices, 3, indices, 3, TF_FALSE});
+    TEST_CHECK(mesh, "Failed to create a mesh with normalized byte positions");
+    if (mesh) {
+        const TF_MeshBounds bounds = tf_mesh_get_bounds(mesh);
+        TF_DEBUG("Normalized byte triangle: center (%.2f, %.2f, %.2f), extents (%.2f, %.2f, %.2f)",
+                 bounds.center.x, bounds.center.y, bounds.center.z,
+                 bounds.extents.x, bounds.extents.y, bounds.extents.z);
+        TEST_CHECK(bounds.center.x == 0.5f && bounds.center.y == 0.5f && bounds.center.z == 0.0f &&
+                   bounds.extents.x == 0.5f && bounds.extents.y == 0.5f && bounds.extents.z == 0.0f,
+                   "Mesh bounds ignore the position format");
+    }
+
+    tf_mesh_destroy(mesh);
+    TF_INFO("Mesh bounds tests complete.");
+}
+
+// Two GL renderers share the variant registry and the program cache;
+// destroying one must leave the other's variants, the built-in includes and
+// the cache in place
+void test_shader_variants(TF_Window *window) {
+    TF_INFO("Testing shared shader variants...");
+
+    const TF_RendererConfig config = {
+        .backend = TF_RENDERER_BACKEND_OPENGL,
+        .enable_depth_test = TF_TRUE,
+        .clear_color = TF_COLOR_BLUE,
+        .shader_cache_dir = "shader_cache"
+    };
+
+    TF_Renderer *first = tf_renderer_create(window, &config);
+    TF_Renderer *second = tf_renderer_create(window, &config);
+    TEST_CHECK(first && second, "Failed to create two renderers");
+    if (!first || !second) {
+        tf_renderer_destroy(second);
+        tf_renderer_destroy(first);
+        return;
+    }
+
+    // The second renderer reuses the first's variants, so only the first looked any up
+    const u32 resident = tf_shader_variant_count();
+    const TF_ShaderCacheStats started = tf_shader_get_cache_stats();
+    TEST_CHECK(started.hits + started.misses >= resident, "Creating a renderer reset the shader cache stats");
+
+    tf_renderer_destroy(second);
+    TEST_CHECK(tf_shader_variant_count() == resident, "Destroying a renderer dropped %u of %u variants",
+               resident - tf_shader_variant_count(), resident);
+    TEST_CHECK(tf_shader_is_valid(tf_shader_get_fallback()), "Destroying a renderer dropped the fallback shader");
+
+    const TF_ShaderTemplateDesc desc = {
+        .vertex_source = "#version 330 core\n"
+                         "#include \"tunafish/frame.glsl\"\n"
+                         "void main() { gl_Position = vec4(tf_viewport.xy * 0.0, 0.0, 1.0); }\n",
+        .fragment_source = "#version 330 core\n"
+                           "out vec4 fragColor;\n"
+                           "void main() { fragColor = vec4(1.0); }\n"
+    };
+    TF_ShaderTemplate *shader_template = tf_shader_template_create(&desc);
+    TF_Shader *shader = tf_shader_variant_acquire(shader_template, 0);
+    TEST_CHECK(tf_shader_wait(shader) == TF_SHADER_STATUS_READY, "Built-in includes are gone after a renderer");
+    const TF_ShaderCacheStats acquired = tf_shader_get_cache_stats();
+    TEST_CHECK(acquired.hits + acquired.misses == started.hits + started.misses + 1,
+               "Destroying a renderer disabled the shader cache");
+    tf_shader_variant_release(shader);
+    tf_shader_template_destroy(shader_template);
+
+    tf_renderer_begin_frame(first);
+    tf_renderer_clear(first, TF_CLEAR_ALL);
+    tf_renderer_end_frame(first);
+    tf_renderer_destroy(first);
+    TEST_CHECK(tf_shader_variant_count() == 0, "%u variants outlived the last renderer", tf_shader_variant_count());
+
+    TF_INFO("Shader variant tests complete.");
+}
+
 int main(void) {
     printf("Tunafish Engine Test with Input System\n");
     printf("======================================\n");
@@ -267,6 +1182,27 @@ int main(void) {
         return -1;
     }
 
+    // Initialize engine (this will start logging, memory and time systems)
+    if (!tf_engine_initialize(engine)) {
+        printf("ERROR: Failed to initialize engine\n");
+        tf_engine_destroy(engine);
+        return -1;
+    }
+
+    // Systems and benchmarks that need no window, so they run headless too
+    test_math_library();
+    test_time_system();
+    test_memory_system();
+    test_renderer_submission();
+    test_command_lists();
+    test_culling();
+    test_occlusion();
+    test_portals();
+    test_clusters();
+    test_cluster_lods();
+    test_mesh_optimization();
+    test_mesh_bounds();
+
     // Test window creation
     TF_WindowConfig window_config = {
         .title = "Tunafish Input Test Window",
@@ -278,14 +1214,7 @@ int main(void) {
     TF_Window *window = tf_window_create(&window_config);
     if (!window) {
         printf("ERROR: Failed to create window\n");
-        tf_engine_destroy(engine);
-        return -1;
-    }
-
-    // Initialize engine (this will start logging, memory, time, and input systems)
-    if (!tf_engine_initialize(engine)) {
-        printf("ERROR: Failed to initialize engine\n");
-        tf_window_destroy(window);
+        tf_engine_shutdown(engine);
         tf_engine_destroy(engine);
         return -1;
     }
@@ -294,12 +1223,9 @@ int main(void) {
     tf_input_init();
     tf_input_set_window(window);
 
-    // Test all systems
-    test_math_library();
-    test_time_system();
-    test_memory_system();
     test_input_system();
     test_renderer_system(window);
+    test_shader_variants(window);
 
     // Interactive input testing
     test_input_interactive(window);
@@ -309,8 +1235,12 @@ int main(void) {
     TF_RendererConfig config = {
         .backend = TF_RENDERER_BACKEND_OPENGL,
         .enable_depth_test = TF_TRUE,
-        .enable_vsync = TF_TRUE,
-        .clear_color = TF_COLOR_BLUE
+        .clear_color = TF_COLOR_BLUE,
+        .shader_cache_dir = "shader_cache",
+        .enable_api_debug = TF_TRUE,
+        .render_thread = TF_TRUE,
+        .present_mode = TF_PRESENT_MODE_ADAPTIVE,
+        .max_frames_in_flight = 1
     };
     TF_Renderer *renderer = tf_renderer_create(window, &config);
 
@@ -324,16 +1254,20 @@ int main(void) {
 
         // Render a triangle
         tf_renderer_begin_frame(renderer);
+        tf_renderer_begin_pass(renderer, "clear");
         tf_renderer_clear(renderer, TF_CLEAR_ALL);
+        tf_renderer_end_pass(renderer);
 
         // Draw a colorful triangle in the center of the screen
+        tf_renderer_begin_pass(renderer, "triangle");
         TF_Vec3 p1 = tf_vec3_create( 0.0f,  0.5f, 0.0f);  // Top
         TF_Vec3 p2 = tf_vec3_create(-0.5f, -0.5f, 0.0f);  // Bottom left
         TF_Vec3 p3 = tf_vec3_create( 0.5f, -0.5f, 0.0f);  // Bottom right
         tf_renderer_draw_triangle(renderer, p1, p2, p3, TF_COLOR_RED);
+        tf_renderer_end_pass(renderer);
 
+        // Presented by the render thread while the next frame is simulated
         tf_renderer_end_frame(renderer);
-        tf_window_swap_buffers(window);
 
         frame_count++;
 
@@ -349,10 +1283,26 @@ int main(void) {
             f32 fps = tf_time_get_fps();
             f32 delta = tf_time_get_delta();
 
-            // Show input state in FPS reports
+            // Show input state and renderer stats in FPS reports
             TF_MousePos mouse_pos = tf_input_get_mouse_position();
-            TF_INFO("Frame %d - FPS: %.1f, Delta: %.3fms, Mouse: (%.0f,%.0f)",
-                    frame_count, fps, delta * 1000.0f, mouse_pos.x, mouse_pos.y);
+            TF_RendererStats stats = tf_renderer_get_stats(renderer);
+            TF_INFO("Frame %d - FPS: %.1f, Delta: %.3fms, GPU: %.3fms, Mouse: (%.0f,%.0f), Draws: %u, Triangles: %u",
+                    frame_count, fps, delta * 1000.0f, stats.gpu_frame_ms, mouse_pos.x, mouse_pos.y,
+                    stats.draw_calls, stats.triangles);
+
+            TF_INFO("  Binds: %u programs, %u vertex arrays, %u buffers; GL calls: %u (%u redundant binds)",
+                    stats.program_binds, stats.vertex_array_binds, stats.buffer_binds,
+                    stats.api_calls, stats.api_redundant_binds);
+            TF_INFO("  Latency: %.3fms begin to swap, %.3fms waiting, %u frames in flight",
+                    stats.cpu_to_swap_ms, stats.present_wait_ms, stats.frames_in_flight);
+
+            // GPU times lag a few frames behind, since they are never waited on
+            TF_GPUTimings timings;
+            if (tf_renderer_get_gpu_timings(renderer, &timings)) {
+                for (u32 i = 0; i < timings.pass_count; i++) {
+                    TF_INFO("  GPU pass %-12s %.3fms", timings.passes[i].name, timings.passes[i].gpu_ms);
+                }
+            }
             last_fps_report = current_time;
         }
     }
@@ -374,6 +1324,10 @@ int main(void) {
     tf_window_destroy(window);
     tf_engine_destroy(engine);
 
+    if (s_test_failures > 0) {
+        printf("\n%u checks FAILED - see the errors above!\n", s_test_failures);
+        return 1;
+    }
     printf("\nTest completed - check the detailed output above!\n");
     return 0;
 }